@@ -0,0 +1,77 @@
+// Servidor de inferência para campeões salvos com Rede::salvar.
+//
+//   servidor_inferencia [--socket caminho] [--lote N] [--prazo-us N] modelo0.bin [modelo1.bin ...]
+//
+// Os modelos são numerados na ordem da linha de comando. As estatísticas são
+// impressas a cada 10 s; SIGINT ou SIGTERM encerram o servidor.
+#include "../include/ServidorInferencia.h"
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+
+namespace {
+
+volatile std::sig_atomic_t encerrar = 0;
+
+void tratarSinal(int) {
+    encerrar = 1;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    NEAT::ServidorInferencia::Configuracao config;
+    std::vector<std::string> arquivos;
+    for (int i = 1; i < argc; i++) {
+        std::string argumento = argv[i];
+        if (argumento == "--socket" && i + 1 < argc) {
+            config.caminhoSocket = argv[++i];
+        } else if (argumento == "--lote" && i + 1 < argc) {
+            config.tamanhoMaximoLote = std::atoi(argv[++i]);
+        } else if (argumento == "--prazo-us" && i + 1 < argc) {
+            config.prazoMicros = std::atoi(argv[++i]);
+        } else {
+            arquivos.push_back(argumento);
+        }
+    }
+    if (arquivos.empty()) {
+        std::wcerr << L"Uso: servidor_inferencia [--socket caminho] [--lote N] [--prazo-us N] modelo.bin..." << std::endl;
+        return 1;
+    }
+    
+    try {
+        NEAT::ServidorInferencia servidor(config);
+        for (const auto& arquivo : arquivos) {
+            int indice = servidor.adicionarModelo(arquivo);
+            std::wcout << L"Modelo " << indice << L": " << arquivo.c_str() << std::endl;
+        }
+        
+        std::signal(SIGINT, tratarSinal);
+        std::signal(SIGTERM, tratarSinal);
+        servidor.iniciar();
+        std::wcout << L"Escutando em " << config.caminhoSocket.c_str() << std::endl;
+        
+        auto ultimoRelatorio = std::chrono::steady_clock::now();
+        while (!encerrar) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            if (std::chrono::steady_clock::now() - ultimoRelatorio < std::chrono::seconds(10)) continue;
+            ultimoRelatorio = std::chrono::steady_clock::now();
+            
+            NEAT::EstatisticasInferencia estatisticas = servidor.obterEstatisticas();
+            std::wcout << L"Requisições: " << estatisticas.requisicoes
+                       << L" (" << estatisticas.requisicoesPorSegundo << L"/s), lote médio "
+                       << estatisticas.loteMedio << L", p50 " << estatisticas.latenciaP50Us
+                       << L" us, p99 " << estatisticas.latenciaP99Us << L" us, descartadas "
+                       << estatisticas.descartadas << std::endl;
+            servidor.zerarEstatisticas();
+        }
+        servidor.parar();
+    } catch (const std::exception& erro) {
+        std::wcerr << L"Erro: " << erro.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include "Rede.h"
+#include "ContextoAvaliacao.h"
+#include <vector>
+#include <functional>
+
+namespace NEAT {
+
+// Avaliação em corrida: interrompe avaliações que comprovadamente não
+// alcançam o corte de sobrevivência (nem o melhor da própria espécie) e
+// repete episódios ruidosos apenas para os candidatos que ainda disputam.
+class AgendadorCorrida {
+public:
+    struct Configuracao {
+        int orcamentoPassos;        // passos por episódio (0 = ilimitado)
+        double orcamentoSegundos;   // tempo por episódio (0 = ilimitado)
+        float ganhoMaximoPorPasso;  // maior aumento de aptidão num passo (< 0 = desconhecido, sem corte)
+        float fracaoSobrevivencia;  // fração da população que define o corte
+        int episodiosMinimos;
+        int episodiosMaximos;       // episódios extras só para quem está acima do corte
+
+        Configuracao() {
+            orcamentoPassos = 0;
+            orcamentoSegundos = 0;
+            ganhoMaximoPorPasso = -1.0f;
+            fracaoSobrevivencia = 0.1f;
+            episodiosMinimos = 1;
+            episodiosMaximos = 1;
+        }
+    };
+
+    struct Estatisticas {
+        int avaliacoes;
+        int cortadas;
+        int episodios;
+        long long passos;
+
+        Estatisticas() : avaliacoes(0), cortadas(0), episodios(0), passos(0) {}
+    };
+
+private:
+    Configuracao config;
+    Estatisticas estatisticas;
+
+public:
+    AgendadorCorrida(const Configuracao& config = Configuracao());
+    
+    // 'especies' é opcional (id por indivíduo, -1 = sem espécie): quando
+    // informado, ninguém é cortado enquanto puder ser o melhor da espécie.
+    // A aptidão de cada rede é a média dos valores retornados pela função nos
+    // episódios que rodou; para uma rede cortada, o episódio interrompido
+    // entra com o que a função retornou ao parar (a pontuação parcial), e é
+    // esse valor que pesa na média da espécie ao dividir os filhos.
+    void avaliar(std::vector<Rede>& redes,
+                 const std::function<float(Rede&, ContextoAvaliacao&)>& funcaoAvaliacao,
+                 const std::vector<int>& especies = std::vector<int>());
+    
+    const Estatisticas& obterEstatisticas() const { return estatisticas; }
+    void definirConfiguracao(const Configuracao& novaConfig) { config = novaConfig; }
+};
+
+} // namespace NEAT
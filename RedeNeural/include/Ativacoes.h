@@ -0,0 +1,26 @@
+#pragma once
+#include <cstdint>
+
+namespace NEAT {
+
+enum class TipoAtivacao : int32_t {
+    IDENTIDADE = 0,
+    SIGMOIDE,
+    TANH,
+    RELU,
+    DEGRAU,
+    GAUSSIANA,
+    NUM_TIPOS
+};
+
+// Aplica a ativação a um bloco contíguo de valores. Os laços não têm desvios
+// nem chamadas à libm (exp por aproximação polinomial de 2^x), então o
+// compilador vetoriza cada grupo de nós com a mesma ativação.
+void aplicarAtivacao(TipoAtivacao tipo, float* valores, int quantidade);
+
+// Versão escalar, com a mesma aproximação
+float ativar(TipoAtivacao tipo, float x);
+
+const char* nomeAtivacao(TipoAtivacao tipo);
+
+} // namespace NEAT
@@ -0,0 +1,75 @@
+#pragma once
+#include "Rede.h"
+#include <vector>
+#include <functional>
+#include <sys/types.h>
+
+namespace NEAT {
+
+// Avaliação de aptidão em processos trabalhadores locais (apenas Linux).
+// O mestre serializa os genomas diretamente num anel de slots em memória
+// compartilhada e sinaliza os trabalhadores via eventfd. Cada trabalhador é
+// um fork do processo que criou o avaliador, então a função de avaliação (e o
+// simulador que ela usa) existe isoladamente em cada processo.
+class AvaliadorProcessos {
+public:
+    struct Configuracao {
+        int numTrabalhadores;
+        int capacidadeAnel;         // slots no anel (0 = 2 por trabalhador)
+        size_t tamanhoMaximoGenoma; // bytes reservados por slot
+        int tempoLimiteMs;          // tempo máximo de uma avaliação (0 = sem limite)
+        int maxTentativas;          // reenvios após falha ou tempo esgotado
+        float aptidaoFalha;         // aptidão atribuída quando as tentativas acabam
+
+        Configuracao() {
+            numTrabalhadores = 4;
+            capacidadeAnel = 0;
+            tamanhoMaximoGenoma = 64 * 1024;
+            tempoLimiteMs = 10000;
+            maxTentativas = 2;
+            aptidaoFalha = 0.0f;
+        }
+    };
+
+private:
+    struct Cabecalho;
+    struct Slot;
+
+    Configuracao config;
+    std::function<float(Rede&)> funcaoAvaliacao;
+    void* memoria;
+    size_t tamanhoMemoria;
+    size_t tamanhoSlot;
+    int eventoTrabalho;    // mestre -> trabalhadores (modo semáforo)
+    int eventoResultado;   // trabalhadores -> mestre
+    std::vector<pid_t> trabalhadores;
+    int reinicios;
+    int temposEsgotados;
+
+    Cabecalho* cabecalho() const;
+    Slot* slot(int indice) const;
+    char* dadosSlot(int indice) const;
+
+    void iniciarTrabalhador(int posicao);
+    void loopTrabalhador();
+    void sinalizarTrabalho(int quantidade);
+    void recuperarTrabalhador(pid_t pid, std::vector<Rede>& redes, int& concluidos);
+    void verificarTemposLimite();
+    void encerrar();
+
+public:
+    AvaliadorProcessos(std::function<float(Rede&)> funcaoAvaliacao,
+                       const Configuracao& config = Configuracao());
+    ~AvaliadorProcessos();
+
+    AvaliadorProcessos(const AvaliadorProcessos&) = delete;
+    AvaliadorProcessos& operator=(const AvaliadorProcessos&) = delete;
+
+    // Avalia todas as redes e grava a aptidão de cada uma
+    void avaliar(std::vector<Rede>& redes);
+
+    int obterReinicios() const { return reinicios; }
+    int obterTemposEsgotados() const { return temposEsgotados; }
+};
+
+} // namespace NEAT
@@ -0,0 +1,154 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace NEAT {
+
+// Vetor em blocos de tamanho fixo com cópia na escrita. Copiar o vetor copia
+// só os ponteiros dos blocos (com contagem de referências); um bloco é
+// duplicado apenas quando alterado por uma cópia que ainda o compartilha.
+// Assim um filho feito a partir do pai duplica só os blocos que a mutação
+// tocou, e cópias de elite não duplicam nada.
+//
+// Ler e copiar o mesmo vetor de várias threads é seguro; alterar, como num
+// std::vector, exige acesso exclusivo àquela cópia.
+template <typename T, size_t TAMANHO_BLOCO = 16>
+class BlocosCompartilhados {
+    static_assert(std::is_trivially_copyable<T>::value, "T precisa ser copiável por memcpy");
+
+private:
+    using Bloco = std::array<T, TAMANHO_BLOCO>;
+
+    std::vector<std::shared_ptr<Bloco>> blocos;
+    size_t quantidade;
+
+    // Garante que o bloco pertence só a esta cópia antes de escrever nele
+    Bloco& exclusivo(size_t indiceBloco) {
+        std::shared_ptr<Bloco>& bloco = blocos[indiceBloco];
+        if (bloco.use_count() > 1) {
+            bloco = std::make_shared<Bloco>(*bloco);
+        } else {
+            // Sincroniza com a liberação da última outra cópia, que pode ter
+            // lido o bloco em outra thread
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+        return *bloco;
+    }
+
+public:
+    class const_iterator {
+    private:
+        const BlocosCompartilhados* vetor;
+        size_t indice;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        const_iterator(const BlocosCompartilhados* vetor, size_t indice) : vetor(vetor), indice(indice) {}
+
+        reference operator*() const { return (*vetor)[indice]; }
+        pointer operator->() const { return &(*vetor)[indice]; }
+        reference operator[](difference_type n) const { return (*vetor)[indice + n]; }
+        const_iterator& operator++() { ++indice; return *this; }
+        const_iterator operator++(int) { const_iterator anterior = *this; ++indice; return anterior; }
+        const_iterator& operator--() { --indice; return *this; }
+        const_iterator operator--(int) { const_iterator anterior = *this; --indice; return anterior; }
+        const_iterator& operator+=(difference_type n) { indice += n; return *this; }
+        const_iterator& operator-=(difference_type n) { indice -= n; return *this; }
+        const_iterator operator+(difference_type n) const { return const_iterator(vetor, indice + n); }
+        const_iterator operator-(difference_type n) const { return const_iterator(vetor, indice - n); }
+        difference_type operator-(const const_iterator& outro) const {
+            return static_cast<difference_type>(indice) - static_cast<difference_type>(outro.indice);
+        }
+        bool operator==(const const_iterator& outro) const { return indice == outro.indice; }
+        bool operator!=(const const_iterator& outro) const { return indice != outro.indice; }
+        bool operator<(const const_iterator& outro) const { return indice < outro.indice; }
+    };
+
+    BlocosCompartilhados() : quantidade(0) {}
+    explicit BlocosCompartilhados(const std::vector<T>& valores) : quantidade(0) { atribuir(valores); }
+
+    size_t size() const { return quantidade; }
+    bool empty() const { return quantidade == 0; }
+    const T& operator[](size_t i) const { return (*blocos[i / TAMANHO_BLOCO])[i % TAMANHO_BLOCO]; }
+    const T& back() const { return (*this)[quantidade - 1]; }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, quantidade); }
+
+    // Referência para escrita; duplica o bloco se ele for compartilhado
+    T& editar(size_t i) { return exclusivo(i / TAMANHO_BLOCO)[i % TAMANHO_BLOCO]; }
+
+    void push_back(const T& valor) {
+        if (quantidade % TAMANHO_BLOCO == 0) {
+            blocos.push_back(std::make_shared<Bloco>());
+        }
+        exclusivo(quantidade / TAMANHO_BLOCO)[quantidade % TAMANHO_BLOCO] = valor;
+        quantidade++;
+    }
+
+    void clear() {
+        blocos.clear();
+        quantidade = 0;
+    }
+
+    // Mantém só os 'n' primeiros elementos (n <= size())
+    void truncar(size_t n) {
+        blocos.resize((n + TAMANHO_BLOCO - 1) / TAMANHO_BLOCO);
+        quantidade = n;
+    }
+
+    // Substitui o conteúdo por 'n' elementos lidos de 'origem' (sem exigir
+    // alinhamento, como um buffer serializado)
+    void atribuir(const void* origem, size_t n) {
+        blocos.resize((n + TAMANHO_BLOCO - 1) / TAMANHO_BLOCO);
+        const char* bytes = static_cast<const char*>(origem);
+        for (size_t b = 0; b < blocos.size(); b++) {
+            blocos[b] = std::make_shared<Bloco>();
+            size_t noBloco = std::min(TAMANHO_BLOCO, n - b * TAMANHO_BLOCO);
+            std::memcpy(blocos[b]->data(), bytes + b * TAMANHO_BLOCO * sizeof(T), noBloco * sizeof(T));
+        }
+        quantidade = n;
+    }
+
+    void atribuir(const std::vector<T>& valores) { atribuir(valores.data(), valores.size()); }
+
+    // Copia os elementos em sequência para 'destino' (size() * sizeof(T) bytes)
+    void copiarPara(void* destino) const {
+        char* bytes = static_cast<char*>(destino);
+        for (size_t b = 0; b < blocos.size(); b++) {
+            size_t noBloco = std::min(TAMANHO_BLOCO, quantidade - b * TAMANHO_BLOCO);
+            std::memcpy(bytes + b * TAMANHO_BLOCO * sizeof(T), blocos[b]->data(), noBloco * sizeof(T));
+        }
+    }
+
+    std::vector<T> paraVetor() const {
+        std::vector<T> valores(quantidade);
+        copiarPara(valores.data());
+        return valores;
+    }
+
+    // Bytes dos blocos que só esta cópia referencia (o que ela custa a mais
+    // em memória em relação às cópias com quem compartilha o resto)
+    size_t bytesExclusivos() const {
+        size_t total = 0;
+        for (const auto& bloco : blocos) {
+            if (bloco.use_count() == 1) total += sizeof(Bloco);
+        }
+        return total;
+    }
+
+    size_t bytesTotais() const { return blocos.size() * sizeof(Bloco); }
+};
+
+} // namespace NEAT
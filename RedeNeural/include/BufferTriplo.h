@@ -0,0 +1,45 @@
+#pragma once
+#include <atomic>
+
+namespace NEAT {
+
+// Buffer triplo sem travas para um produtor e um consumidor.
+// O produtor preenche obterEscrita() e chama publicar(); o consumidor chama
+// atualizar() e lê obterLeitura() no próprio ritmo. Nenhum lado espera o outro.
+template <typename T>
+class BufferTriplo {
+private:
+    static constexpr int INDICE = 0x3;
+    static constexpr int NOVO = 0x4;
+
+    T buffers[3];
+    std::atomic<int> intermediario;  // índice do buffer do meio + bit NOVO
+    int escrita;
+    int leitura;
+
+public:
+    BufferTriplo() : intermediario(1), escrita(0), leitura(2) {}
+
+    BufferTriplo(const BufferTriplo&) = delete;
+    BufferTriplo& operator=(const BufferTriplo&) = delete;
+
+    // Lado do produtor
+    T& obterEscrita() { return buffers[escrita]; }
+
+    void publicar() {
+        escrita = intermediario.exchange(escrita | NOVO, std::memory_order_acq_rel) & INDICE;
+    }
+
+    // Lado do consumidor: retorna true se havia um valor novo
+    bool atualizar() {
+        if (!(intermediario.load(std::memory_order_relaxed) & NOVO)) {
+            return false;
+        }
+        leitura = intermediario.exchange(leitura, std::memory_order_acq_rel) & INDICE;
+        return true;
+    }
+
+    const T& obterLeitura() const { return buffers[leitura]; }
+};
+
+} // namespace NEAT
@@ -0,0 +1,103 @@
+#pragma once
+#include "Rede.h"
+#include "RedeEsparsa.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NEAT {
+
+// Compila genomas para código nativo em tempo de execução: o código C do
+// ExportadorCodigo é compilado pelo compilador local como biblioteca
+// compartilhada e carregado com dlopen (apenas Linux). Cada instância compila
+// num diretório próprio criado com mkdtemp (modo 0700) e apaga os arquivos
+// logo após carregá-los; nada é reaproveitado entre execuções. As funções
+// ficam em cache, em memória, pelo hash do código gerado.
+//
+// As funções devolvidas apontam para bibliotecas que o destrutor descarrega:
+// não as chame depois que o CompiladorJIT for destruído.
+class CompiladorJIT {
+public:
+    using FuncaoCompilada = void (*)(const float* entradas, float* saidas);
+
+    struct Configuracao {
+        // Programa e opções são divididos em palavras nos espaços e passados
+        // direto ao posix_spawnp, sem shell
+        std::string compilador;
+        std::string opcoes;
+        std::string diretorio;        // onde criar o diretório privado; vazio = $TMPDIR ou /tmp
+        long long chamadasMinimas;    // abaixo disso a compilação não se paga
+
+        Configuracao() {
+            compilador = "cc";
+            opcoes = "-O2";
+            chamadasMinimas = 200000;
+        }
+    };
+
+private:
+    Configuracao config;
+    std::once_flag verificacao;
+    bool disponivel;
+    std::string diretorioPrivado;     // criado por estaDisponivel()
+    // Protege o cache e os contadores; o compilador roda fora dele
+    std::mutex mutex;
+    std::unordered_map<uint64_t, FuncaoCompilada> cache;
+    std::vector<void*> bibliotecas;
+    std::atomic<int> compilacoes;
+    std::atomic<int> acertosCache;
+    int proximoArquivo;
+
+public:
+    CompiladorJIT(const Configuracao& config = Configuracao());
+    ~CompiladorJIT();
+
+    CompiladorJIT(const CompiladorJIT&) = delete;
+    CompiladorJIT& operator=(const CompiladorJIT&) = delete;
+
+    // Verifica (uma vez) se há compilador e dlopen nesta plataforma e cria o
+    // diretório privado
+    bool estaDisponivel();
+
+    // Retorna a função nativa, ou nullptr se o JIT não estiver disponível ou
+    // falhar. Threads diferentes podem compilar ao mesmo tempo.
+    FuncaoCompilada compilar(const RedeEsparsa& rede);
+
+    long long obterChamadasMinimas() const { return config.chamadasMinimas; }
+    int obterCompilacoes() const { return compilacoes; }
+    int obterAcertosCache() const { return acertosCache; }
+    // Vazio até estaDisponivel() ter sucesso
+    const std::string& obterDiretorio() const { return diretorioPrivado; }
+};
+
+// Avalia um genoma pelo interpretador esparso e troca para o código nativo
+// quando as chamadas previstas (ou já feitas) passam de chamadasMinimas.
+// Sem JIT disponível, continua no interpretador. Não deve viver mais que o
+// CompiladorJIT que recebeu.
+class AvaliadorJIT {
+private:
+    CompiladorJIT& compilador;
+    RedeEsparsa interpretador;
+    CompiladorJIT::FuncaoCompilada funcao;
+    long long chamadas;
+    bool tentouCompilar;
+    std::vector<float> saidas;
+
+    void tentarCompilar();
+
+public:
+    // chamadasPrevistas = 0 quando desconhecido: decide pela contagem real
+    AvaliadorJIT(CompiladorJIT& compilador, const Rede& rede, long long chamadasPrevistas = 0);
+
+    void avaliar(const float* entradas, float* destinoSaidas);
+    const std::vector<float>& avaliar(const std::vector<float>& entradas);
+
+    bool usandoJIT() const { return funcao != nullptr; }
+    long long obterChamadas() const { return chamadas; }
+};
+
+} // namespace NEAT
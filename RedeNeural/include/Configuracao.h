@@ -1,24 +1,31 @@
-#pragma once
-
-namespace NEAT {
-
-struct ConfiguracaoNEAT {
-    // Parâmetros de compatibilidade
-    static float COEF_EXCESSO;
-    static float COEF_DISJUNTO;
-    static float COEF_PESO;
-    
-    // Parâmetros de mutação
-    static float CHANCE_PESO_PERTURBADO;
-    static float CHANCE_CONEXAO_TOGGLE;
-    static float CHANCE_NOVO_NO;
-    static float CHANCE_NOVA_CONEXAO;
-    
-    // Limites
-    static int MAX_NOS;
-    static int MAX_CONEXOES;
-    
-    static void inicializarPadrao();
-};
-
+#pragma once
+
+namespace NEAT {
+
+// Parâmetros do NEAT de um experimento. Cada Populacao tem a sua cópia
+// (Populacao::Configuracao::neat), então populações no mesmo processo não
+// interferem umas nas outras.
+struct ConfiguracaoNEAT {
+    // Parâmetros de compatibilidade
+    float COEF_EXCESSO;
+    float COEF_DISJUNTO;
+    float COEF_PESO;
+    
+    // Parâmetros de mutação
+    float CHANCE_PESO_PERTURBADO;
+    float CHANCE_CONEXAO_TOGGLE;
+    float CHANCE_NOVO_NO;
+    float CHANCE_NOVA_CONEXAO;
+    float CHANCE_BIAS_PERTURBADO;
+    float CHANCE_TROCA_ATIVACAO;
+    
+    // Limites
+    int MAX_NOS;
+    int MAX_CONEXOES;
+    
+    ConfiguracaoNEAT() { inicializarPadrao(); }
+    
+    void inicializarPadrao();
+};
+
 } // namespace NEAT 
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+
+namespace NEAT {
+
+// Contexto entregue à função de avaliação: orçamento de passos e de tempo,
+// cancelamento cooperativo e relatório da aptidão parcial.
+//
+// Uso típico dentro da função de avaliação:
+//     while (simulacao.ativa()) {
+//         ...
+//         if (!contexto.passo(pontuacao)) break;
+//     }
+//     return pontuacao;
+class ContextoAvaliacao {
+private:
+    std::atomic<bool> cancelado;
+    bool cortado;
+    int passos;
+    int orcamentoPassos;        // 0 = ilimitado
+    double orcamentoSegundos;   // 0 = ilimitado
+    std::chrono::steady_clock::time_point inicio;
+    float aptidaoParcial;
+    
+    // Corte da corrida: só é aplicado quando o ganho máximo por passo é conhecido
+    bool possuiCorte;
+    float corte;
+    float ganhoMaximoPorPasso;
+
+public:
+    ContextoAvaliacao(int orcamentoPassos = 0, double orcamentoSegundos = 0);
+    
+    // Registra um passo com a aptidão acumulada até aqui.
+    // Retorna false quando a avaliação deve parar.
+    bool passo(float aptidaoAtual);
+    
+    void cancelar() { cancelado.store(true); }
+    bool foiCancelado() const { return cancelado.load(); }
+    // true quando a parada veio do corte da corrida (a aptidão não alcança mais o corte)
+    bool foiCortado() const { return cortado; }
+    
+    int obterPassos() const { return passos; }
+    float obterAptidaoParcial() const { return aptidaoParcial; }
+    double obterSegundosDecorridos() const;
+    
+    // Usados pelo agendador entre episódios
+    void reiniciar();
+    void definirOrcamento(int passos, double segundos);
+    void definirCorte(float valorCorte, float ganhoMaximo);
+    void removerCorte() { possuiCorte = false; }
+};
+
+} // namespace NEAT
@@ -1,27 +1,39 @@
-#pragma once
-#include "Rede.h"
-#include <vector>
-
-namespace NEAT {
-
-class Especie {
-private:
-    std::vector<Rede*> membros;
-    float aptidaoAjustada;
-    Rede representante;
-    int geracoesSemMelhoria;
-    float melhorAptidao;
-
-public:
-    Especie(const Rede& primeiro);
-    
-    void adicionarMembro(Rede* rede);
-    void calcularAptidaoAjustada();
-    bool verificarCompatibilidade(const Rede& rede) const;
-    
-    float obterAptidaoAjustada() const { return aptidaoAjustada; }
-    const std::vector<Rede*>& obterMembros() const { return membros; }
-    void limparMembros() { membros.clear(); }
-};
-
+#pragma once
+#include "Rede.h"
+#include "Configuracao.h"
+#include <vector>
+
+namespace NEAT {
+
+class Especie {
+private:
+    int id;
+    std::vector<int> membros;  // índices em Populacao::individuos
+    float aptidaoAjustada;
+    GenomaCompacto representante;  // cópia das colunas, independente do indivíduo
+    int geracoesSemMelhoria;
+    float melhorAptidao;
+
+public:
+    Especie(int id, const Rede& primeiro);
+    
+    void adicionarMembro(int indice);
+    void calcularAptidaoAjustada(const std::vector<Rede>& individuos);
+    float calcularDistancia(const Rede& rede, const ConfiguracaoNEAT& config) const;
+    static float calcularDistancia(const GenomaCompacto& a, const GenomaCompacto& b,
+                                   const ConfiguracaoNEAT& config);
+    // Compatível quando a distância ao representante fica abaixo de 'limiar'
+    // (Populacao::Configuracao::limiarCompatibilidade)
+    bool verificarCompatibilidade(const Rede& rede, const ConfiguracaoNEAT& config,
+                                  float limiar) const;
+    void definirRepresentante(const Rede& rede);
+    
+    int obterId() const { return id; }
+    float obterAptidaoAjustada() const { return aptidaoAjustada; }
+    float obterMelhorAptidao() const { return melhorAptidao; }
+    int obterGeracoesSemMelhoria() const { return geracoesSemMelhoria; }
+    const std::vector<int>& obterMembros() const { return membros; }
+    void limparMembros() { membros.clear(); }
+};
+
 } // namespace NEAT 
\ No newline at end of file
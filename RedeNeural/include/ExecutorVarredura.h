@@ -0,0 +1,53 @@
+#pragma once
+#include "Populacao.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace NEAT {
+
+// Executa várias configurações de Populacao no mesmo processo, em paralelo
+// num conjunto fixo de threads. Cada experimento tem seu próprio estado
+// (ConfiguracaoNEAT, inovações e gerador), então os resultados não dependem
+// de quantos rodam juntos. A função de avaliação é chamada de várias threads.
+class ExecutorVarredura {
+public:
+    struct Experimento {
+        std::string nome;
+        Populacao::Configuracao config;
+        int numEntradas;
+        int numSaidas;
+        int geracoes;
+
+        Experimento() {
+            numEntradas = 5;
+            numSaidas = 1;
+            geracoes = 50;
+        }
+    };
+
+    struct Resultado {
+        std::string nome;
+        float melhorAptidao;
+        int geracoes;
+        double segundos;
+        Rede melhorRede;
+        std::string erro;  // vazio se o experimento terminou normalmente
+    };
+
+    using FuncaoAvaliacao = std::function<float(Rede&)>;
+
+private:
+    int numThreads;
+
+public:
+    // 0 = std::thread::hardware_concurrency()
+    ExecutorVarredura(int numThreads = 0);
+
+    // Resultados na mesma ordem dos experimentos. Cada população reproduz em
+    // uma thread e sem log detalhado, para não disputar as threads da varredura.
+    std::vector<Resultado> executar(const std::vector<Experimento>& experimentos,
+                                    FuncaoAvaliacao funcaoAvaliacao);
+};
+
+} // namespace NEAT
@@ -0,0 +1,30 @@
+#pragma once
+#include "Rede.h"
+#include "RedeEsparsa.h"
+#include <string>
+
+namespace NEAT {
+
+// Gera código-fonte autônomo que avalia uma rede fixa: pesos em um array
+// constante e uma função em linha reta, um nó por linha em ordem topológica
+// com seu bias e sua ativação, sem laços. As ativações usam as mesmas
+// aproximações de Ativacoes.cpp, então o resultado é o de Rede::avaliar.
+// Redes recorrentes não são aceitas. O modo C++ produz um cabeçalho para
+// implantação; o modo C é usado pelo compilador JIT.
+class ExportadorCodigo {
+public:
+    enum class Linguagem { C, CPP };
+
+    // C++: namespace 'nome' com NUM_ENTRADAS, NUM_SAIDAS, PESOS e
+    //      void avaliar(const float* entradas, float* saidas)
+    // C:   void nome(const float* entradas, float* saidas)
+    static std::string gerar(const RedeEsparsa& rede, const std::string& nome,
+                             Linguagem linguagem = Linguagem::CPP);
+    static std::string gerar(const Rede& rede, const std::string& nome,
+                             Linguagem linguagem = Linguagem::CPP);
+
+    // Grava o cabeçalho C++ em 'arquivo'
+    static void exportar(const Rede& rede, const std::string& arquivo, const std::string& nome);
+};
+
+} // namespace NEAT
@@ -0,0 +1,21 @@
+#pragma once
+#include "Ativacoes.h"
+
+namespace NEAT {
+
+struct Conexao {
+    int deNo;
+    int paraNo;
+    float peso;
+    bool ativo;
+    int inovacao;
+};
+
+struct No {
+    int id;
+    int camada;  // 0=entrada, 1=oculta, 2=saida
+    float bias;
+    TipoAtivacao ativacao;
+};
+
+} // namespace NEAT
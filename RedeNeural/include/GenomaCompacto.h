@@ -0,0 +1,108 @@
+#pragma once
+#include "BlocosCompartilhados.h"
+#include "Genes.h"
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace NEAT {
+
+// Conexões de um genoma em colunas (structure-of-arrays), ordenadas por número
+// de inovação: inovações, origens, destinos e pesos em colunas separadas e os
+// flags de ativo num bitset. É o armazenamento das conexões de Rede. Cada etapa
+// lê só as colunas de que precisa -- a distância de compatibilidade percorre
+// inovações e pesos, o cruzamento alinha por inovação e a compilação do
+// fenótipo lê extremos, pesos e bits. Ids de nó usam 16 bits enquanto couberem;
+// acima disso, 32 bits.
+//
+// Cada coluna fica em blocos com cópia na escrita: copiar o genoma copia só
+// ponteiros, e mutar pesos duplica só os blocos de pesos alterados. Conexões
+// com inovação negativa (pendente) ficam no fim, na ordem em que entraram.
+class GenomaCompacto {
+private:
+    static constexpr size_t ELEMENTOS_POR_BLOCO = 64;
+    template <typename T>
+    using Coluna = BlocosCompartilhados<T, ELEMENTOS_POR_BLOCO>;
+
+    Coluna<int32_t> inovacoes;
+    Coluna<uint16_t> de16, para16;
+    Coluna<int32_t> de32, para32;
+    Coluna<float> pesos;
+    Coluna<uint64_t> bitsAtivos;
+    bool idsCompactos;
+
+    // Acrescenta no fim, sem conferir a ordem
+    void anexar(int inovacao, int deNo, int paraNo, float peso, bool ativo);
+    // Descarta as conexões a partir de 'quantidade'
+    void truncar(int quantidade);
+
+public:
+    struct Distancia {
+        int coincidentes;
+        int disjuntos;
+        int excessos;
+        float somaDiferencasPesos;
+    };
+
+    GenomaCompacto();
+    explicit GenomaCompacto(const std::vector<Conexao>& conexoes);
+
+    void limpar();
+    // Mantém a ordem por inovação. Fora de ordem (uma inovação menor que a
+    // última, vinda de outro genoma) as colunas são refeitas.
+    void adicionar(int inovacao, int deNo, int paraNo, float peso, bool ativo);
+    std::vector<Conexao> paraConexoes() const;
+    void paraConexoes(std::vector<Conexao>& destino) const;  // reaproveita a capacidade
+
+    int tamanho() const { return static_cast<int>(inovacoes.size()); }
+    bool vazio() const { return inovacoes.empty(); }
+    bool usaIds16() const { return idsCompactos; }
+
+    // Colunas
+    int inovacao(int i) const { return inovacoes[i]; }
+    float peso(int i) const { return pesos[i]; }
+    int origem(int i) const { return idsCompactos ? de16[i] : de32[i]; }
+    int destino(int i) const { return idsCompactos ? para16[i] : para32[i]; }
+    bool ativo(int i) const { return (bitsAtivos[i >> 6] >> (i & 63)) & 1u; }
+    Conexao conexao(int i) const { return {origem(i), destino(i), peso(i), ativo(i), inovacao(i)}; }
+    int contarAtivos() const;
+
+    void definirPeso(int i, float novoPeso) { pesos.editar(i) = novoPeso; }
+    void definirAtivo(int i, bool novoAtivo);
+
+    // Numera as conexões pendentes, na ordem em que entraram, com
+    // numerar(origem, destino), e as recoloca na ordem por inovação
+    template <typename Funcao>
+    void resolverPendentes(Funcao numerar) {
+        int inicio = tamanho();
+        while (inicio > 0 && inovacao(inicio - 1) < 0) inicio--;
+        if (inicio == tamanho()) return;
+        std::vector<Conexao> pendentes;
+        for (int i = inicio; i < tamanho(); i++) {
+            pendentes.push_back(conexao(i));
+            pendentes.back().inovacao = numerar(pendentes.back().deNo, pendentes.back().paraNo);
+        }
+        truncar(inicio);
+        for (const Conexao& c : pendentes) {
+            adicionar(c.inovacao, c.deNo, c.paraNo, c.peso, c.ativo);
+        }
+    }
+
+    size_t bytesUsados() const;
+    // Bytes dos blocos que só esta cópia referencia
+    size_t bytesExclusivos() const;
+
+    // Termos da distância de compatibilidade, num único passe sobre inovações e pesos
+    static Distancia comparar(const GenomaCompacto& a, const GenomaCompacto& b);
+
+    // Cruzamento alinhado por inovação: genes em comum vêm de um dos pais ao
+    // acaso; disjuntos e excedentes vêm de 'estrutura', que deve ser o pai mais
+    // apto (o filho também herda os nós dele). Gene desativado em algum dos
+    // pais fica desativado com 75% de chance.
+    static void cruzar(const GenomaCompacto& estrutura, const GenomaCompacto& outro,
+                       std::mt19937& gerador, GenomaCompacto& filho);
+    static GenomaCompacto cruzar(const GenomaCompacto& estrutura, const GenomaCompacto& outro);
+};
+
+} // namespace NEAT
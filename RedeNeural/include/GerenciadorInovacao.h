@@ -1,24 +1,29 @@
-#pragma once
-#include <map>
-#include <utility>
-
-namespace NEAT {
-
-class GerenciadorInovacao {
-private:
-    std::map<std::pair<int, int>, int> historicoInovacoes;
-    int proximaInovacao;
-
-public:
-    GerenciadorInovacao() : proximaInovacao(0) {}
-    
-    int obterInovacao(int deNo, int paraNo);
-    void limpar();
-    
-    static GerenciadorInovacao& instancia() {
-        static GerenciadorInovacao inst;
-        return inst;
-    }
-};
-
+#pragma once
+#include <map>
+#include <utility>
+
+namespace NEAT {
+
+// Números de inovação de um experimento: a mesma conexão (deNo, paraNo)
+// recebe o mesmo número em todos os genomas que a criarem. Cada Populacao
+// tem o seu gerenciador.
+class GerenciadorInovacao {
+public:
+    // Inovação de uma conexão criada durante a reprodução, antes de se saber
+    // se o filho sobrevive à pré-seleção; Rede::resolverInovacoes troca pelo
+    // número definitivo só nos filhos mantidos.
+    static constexpr int PENDENTE = -1;
+
+private:
+    std::map<std::pair<int, int>, int> historicoInovacoes;
+    int proximaInovacao;
+
+public:
+    GerenciadorInovacao() : proximaInovacao(0) {}
+    
+    int obterInovacao(int deNo, int paraNo);
+    int obterProximaInovacao() const { return proximaInovacao; }
+    void limpar();
+};
+
 } // namespace NEAT 
\ No newline at end of file
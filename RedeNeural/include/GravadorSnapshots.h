@@ -0,0 +1,36 @@
+#pragma once
+#include "BufferTriplo.h"
+#include "RasterizadorPNG.h"
+#include "Snapshot.h"
+#include <atomic>
+#include <string>
+#include <thread>
+
+namespace NEAT {
+
+// Thread que consome snapshots publicados pelo treino e grava quadros PNG
+// no próprio ritmo. O treino nunca espera pela gravação.
+class GravadorSnapshots {
+private:
+    BufferTriplo<SnapshotRede>& buffer;
+    RasterizadorPNG rasterizador;
+    std::string prefixo;
+    int intervaloMs;
+    std::atomic<bool> executando;
+    std::atomic<int> quadrosGravados;
+    std::thread thread;
+
+    void loop();
+
+public:
+    GravadorSnapshots(BufferTriplo<SnapshotRede>& buffer, const std::string& prefixo,
+                      int intervaloMs = 100,
+                      const RasterizadorPNG::Configuracao& config = RasterizadorPNG::Configuracao());
+    ~GravadorSnapshots();
+
+    void iniciar();
+    void parar();
+    int obterQuadrosGravados() const { return quadrosGravados.load(); }
+};
+
+} // namespace NEAT
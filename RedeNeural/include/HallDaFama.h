@@ -0,0 +1,107 @@
+#pragma once
+#include "Rede.h"
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NEAT {
+
+// Arquivo persistente dos melhores genomas de todas as gerações.
+//
+// Cada genoma é identificado por um hash do conteúdo (nós e conexões ativas;
+// inovações e conexões desativadas não entram), então a mesma rede oferecida
+// em várias gerações é guardada uma vez só, com a maior aptidão vista.
+// Os genomas são acrescentados a 'arquivo' no formato versionado de
+// Rede::salvar; o índice (hash, aptidão, geração e posição no arquivo) fica
+// em memória ordenado por aptidão e é gravado em 'arquivo.indice' por
+// sincronizar() e no destrutor. Registros gravados depois do último índice
+// (execução interrompida) são recuperados ao abrir. Arquivos da versão
+// anterior, com a cópia direta de No, são recusados.
+//
+// Não é seguro entre threads.
+class HallDaFama {
+public:
+    struct Configuracao {
+        std::string arquivo;
+        int porGeracao;     // melhores de cada geração guardados por adicionarGeracao
+
+        Configuracao() {
+            arquivo = "hall.bin";
+            porGeracao = 5;
+        }
+    };
+
+    struct Entrada {
+        uint64_t hash;
+        float aptidao;
+        int geracao;            // geração em que a aptidão foi obtida
+        uint64_t deslocamento;  // início do genoma em 'arquivo'
+        uint32_t tamanho;
+    };
+
+private:
+    // Aptidão decrescente; empates pela geração mais antiga
+    struct OrdemAptidao {
+        bool operator()(const Entrada& a, const Entrada& b) const {
+            if (a.aptidao != b.aptidao) return a.aptidao > b.aptidao;
+            if (a.geracao != b.geracao) return a.geracao < b.geracao;
+            return a.hash < b.hash;
+        }
+    };
+
+    Configuracao config;
+    std::set<Entrada, OrdemAptidao> porAptidao;
+    std::unordered_map<uint64_t, std::set<Entrada, OrdemAptidao>::iterator> porHash;
+    std::fstream dados;
+    uint64_t tamanhoDados;
+    bool indiceAlterado;
+
+    void abrir();
+    bool lerIndice(uint64_t& dadosIndexados);
+    void recuperarRegistros(uint64_t inicio);
+    bool registrar(const Entrada& entrada);
+    Rede lerGenoma(const Entrada& entrada);
+
+public:
+    HallDaFama(const Configuracao& config = Configuracao());
+    ~HallDaFama();
+
+    HallDaFama(const HallDaFama&) = delete;
+    HallDaFama& operator=(const HallDaFama&) = delete;
+
+    // Retorna true se o genoma ainda não estava no arquivo
+    bool adicionar(const Rede& rede, int geracao);
+    // Guarda os config.porGeracao melhores da geração; retorna quantos eram novos
+    int adicionarGeracao(const std::vector<Rede>& individuos, int geracao);
+
+    // As k maiores aptidões, em ordem decrescente: O(k) sobre o índice ordenado
+    std::vector<Entrada> melhores(int k) const;
+    // Carrega do disco as k melhores redes, com a aptidão arquivada
+    std::vector<Rede> carregarMelhores(int k);
+    Rede carregar(const Entrada& entrada);
+    bool contem(const Rede& rede) const;
+
+    // Avalia todos os genomas arquivados com outra função de aptidão, em lotes
+    // de 'lote' genomas lidos do disco e distribuídos entre as threads
+    // (0 = hardware_concurrency). Retorna as entradas com a nova aptidão, em
+    // ordem decrescente; o índice não é alterado. A função é chamada de várias
+    // threads ao mesmo tempo, cada uma com a própria Rede.
+    std::vector<Entrada> reavaliar(std::function<float(Rede&)> funcaoAvaliacao,
+                                   int numThreads = 0, int lote = 256);
+
+    // Grava o índice (arquivo temporário + rename)
+    void sincronizar();
+
+    size_t tamanho() const { return porAptidao.size(); }
+    const Configuracao& obterConfiguracao() const { return config; }
+
+    // FNV-1a sobre nós (camada, ativação, bias) e conexões ativas (origem,
+    // destino, peso) na ordem de inovação
+    static uint64_t calcularHash(const Rede& rede);
+};
+
+} // namespace NEAT
@@ -0,0 +1,131 @@
+#pragma once
+#include "Rede.h"
+#include "Especie.h"
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace NEAT {
+
+// Quantil por streaming com o algoritmo P² (Jain e Chlamtac): cinco marcadores
+// ajustados a cada amostra, memória constante e sem guardar os valores.
+class EstimadorQuantil {
+private:
+    double p;
+    int contagem;
+    double alturas[5];
+    double posicoes[5];
+    double desejadas[5];
+    double incrementos[5];
+
+public:
+    explicit EstimadorQuantil(double p);
+
+    void adicionar(double valor);
+    double obter() const;
+    int obterContagem() const { return contagem; }
+};
+
+struct MetricasGeracao {
+    int geracao;
+    int individuos;
+    int especies;
+    float melhor;
+    float media;
+    float pior;
+    float desvio;
+    float p10;
+    float p50;
+    float p90;
+    float diversidade;      // distância de compatibilidade média entre pares amostrados
+    float nosMedio;
+    float conexoesAtivasMedio;
+    float maxConexoesAtivas;
+};
+
+struct MetricasEspecie {
+    int geracao;
+    int especie;
+    int membros;
+    float melhor;
+    float media;
+    float aptidaoAjustada;
+    float conexoesAtivasMedio;
+    int geracoesSemMelhoria;
+};
+
+// Calcula as métricas de cada geração (e de cada espécie) numa passada sobre
+// a população, guarda só as últimas 'janela' gerações em memória e acrescenta
+// tudo a dois logs colunares em disco por uma thread de gravação:
+// 'arquivo' (uma linha por geração) e 'arquivo.especies' (uma por espécie).
+//
+// Formato: "NEATMET1", número de colunas e seus nomes; depois blocos com o
+// número de linhas seguido de cada coluna inteira (float32). LeitorMetricas
+// lê uma coluna pulando as demais, sem reprocessar o log. Ao continuar um log
+// existente, um bloco incompleto no fim é truncado.
+class RegistroMetricas {
+public:
+    struct Configuracao {
+        std::string arquivo;
+        int janela;             // gerações mantidas em memória
+        int paresDiversidade;   // pares amostrados para a diversidade
+
+        Configuracao() {
+            arquivo = "metricas.bin";
+            janela = 1000;
+            paresDiversidade = 256;
+        }
+    };
+
+private:
+    Configuracao config;
+    std::deque<MetricasGeracao> janela;
+    std::vector<MetricasEspecie> especiesRecentes;
+
+    std::mutex mutex;
+    std::condition_variable aviso;
+    std::vector<MetricasGeracao> pendentesGeracao;
+    std::vector<MetricasEspecie> pendentesEspecie;
+    bool executando;
+    long long linhasGravadas;
+    std::thread thread;
+
+    void loop();
+
+public:
+    RegistroMetricas(const Configuracao& config = Configuracao());
+    ~RegistroMetricas();
+
+    RegistroMetricas(const RegistroMetricas&) = delete;
+    RegistroMetricas& operator=(const RegistroMetricas&) = delete;
+
+    // Chamado por Populacao::evoluir com a geração já avaliada e especiada
+    const MetricasGeracao& registrar(int geracao, const std::vector<Rede>& individuos,
+                                     const std::vector<int>& especieDosIndividuos,
+                                     const std::vector<Especie>& especies,
+                                     const ConfiguracaoNEAT& configNEAT);
+
+    // Espera a thread gravar tudo o que está pendente e a encerra
+    void parar();
+
+    const std::deque<MetricasGeracao>& obterJanela() const { return janela; }
+    const std::vector<MetricasEspecie>& obterEspeciesRecentes() const { return especiesRecentes; }
+    long long obterLinhasGravadas();
+
+    static const std::vector<std::string>& colunasGeracao();
+    static const std::vector<std::string>& colunasEspecie();
+};
+
+// Leitura offline dos logs de RegistroMetricas
+class LeitorMetricas {
+public:
+    static std::vector<std::string> lerColunas(const std::string& arquivo);
+    // Lança std::runtime_error se o arquivo ou a coluna não existirem
+    static std::vector<float> lerColuna(const std::string& arquivo, const std::string& coluna);
+};
+
+} // namespace NEAT
@@ -0,0 +1,41 @@
+#pragma once
+#include "Rede.h"
+#include "RegressaoRidge.h"
+#include <vector>
+
+namespace NEAT {
+
+// Modelo barato de aptidão (regressão ridge treinada online) usado para
+// pré-selecionar filhos antes da avaliação completa. As características
+// são estatísticas da topologia e dos pesos, com os pesos agrupados por
+// número de inovação para que genomas parentes caiam nas mesmas colunas.
+class ModeloSubstituto {
+public:
+    static constexpr int GRUPOS_INOVACAO = 16;
+    static constexpr int NUM_CARACTERISTICAS = 9 + GRUPOS_INOVACAO;
+
+private:
+    mutable RegressaoRidge regressao;
+
+    void extrairCaracteristicas(const Rede& rede, double* destino) const;
+
+public:
+    ModeloSubstituto(double regularizacao = 1.0, double fatorEsquecimento = 0.9);
+    
+    // Desconta as amostras antigas; chamado uma vez por geração
+    void envelhecer();
+    void adicionarAmostra(const Rede& rede, float aptidao);
+    // Amostras de uma geração avaliada; genomas repetidos contam uma vez só
+    void adicionarGeracao(const std::vector<Rede>& redes);
+    float prever(const Rede& rede) const;
+    
+    // Resolve os coeficientes pendentes; depois disso prever() pode ser
+    // chamado de várias threads ao mesmo tempo
+    void preparar() const;
+    
+    // Só ranqueia com amostras suficientes para o número de características
+    bool estaPronto() const { return regressao.obterAmostras() >= 2 * NUM_CARACTERISTICAS; }
+    double obterAmostras() const { return regressao.obterAmostras(); }
+};
+
+} // namespace NEAT
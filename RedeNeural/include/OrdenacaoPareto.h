@@ -0,0 +1,127 @@
+#pragma once
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace NEAT {
+
+// Ordenação não dominada e distância de aglomeração do NSGA-II sobre
+// 'objetivos' com numObjetivos valores por indivíduo, em sequência, todos
+// maximizados. Só cabeçalho e genérica no tipo dos valores, porque também
+// serve à SelecaoMultiobjetivo de Redeneural_2 (double).
+template <typename T>
+struct ClassificacaoPareto {
+    int frente;      // 0 = não dominado
+    T aglomeracao;   // maior = região menos povoada da frente (extremos = infinito)
+};
+
+template <typename T>
+bool dominaPareto(const T* a, const T* b, int numObjetivos) {
+    bool estritamente = false;
+    for (int m = 0; m < numObjetivos; m++) {
+        if (a[m] < b[m]) return false;
+        if (a[m] > b[m]) estritamente = true;
+    }
+    return estritamente;
+}
+
+// ENS com busca binária: depois de uma ordenação lexicográfica, cada indivíduo
+// vai para a primeira frente em que ninguém o domina. Com dois objetivos só o
+// último da frente precisa ser comparado, O(N log N). Com M > 2 o teste
+// percorre a frente, e o pior caso (quase todos numa frente) é O(M·N²).
+template <typename T>
+std::vector<std::vector<int>> ordenarNaoDominados(const std::vector<T>& objetivos, int numObjetivos) {
+    const int n = numObjetivos > 0 ? static_cast<int>(objetivos.size()) / numObjetivos : 0;
+    std::vector<std::vector<int>> frentes;
+    if (n == 0) return frentes;
+
+    // Ordem lexicográfica decrescente: quem domina um indivíduo vem antes dele
+    std::vector<int> ordem(n);
+    std::iota(ordem.begin(), ordem.end(), 0);
+    std::sort(ordem.begin(), ordem.end(), [&](int a, int b) {
+        const T* x = &objetivos[static_cast<size_t>(a) * numObjetivos];
+        const T* y = &objetivos[static_cast<size_t>(b) * numObjetivos];
+        for (int m = 0; m < numObjetivos; m++) {
+            if (x[m] != y[m]) return x[m] > y[m];
+        }
+        return a < b;
+    });
+
+    auto dominadoNaFrente = [&](const std::vector<int>& frente, const T* s) {
+        if (numObjetivos == 2) {
+            // Na frente o segundo objetivo só cresce: o último é o único candidato
+            return dominaPareto(&objetivos[static_cast<size_t>(frente.back()) * 2], s, 2);
+        }
+        for (auto it = frente.rbegin(); it != frente.rend(); ++it) {
+            if (dominaPareto(&objetivos[static_cast<size_t>(*it) * numObjetivos], s, numObjetivos)) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    for (int indice : ordem) {
+        const T* s = &objetivos[static_cast<size_t>(indice) * numObjetivos];
+        // Ser dominado na frente k implica ser dominado em todas as anteriores
+        int inicio = 0, fim = static_cast<int>(frentes.size());
+        while (inicio < fim) {
+            int meio = (inicio + fim) / 2;
+            if (dominadoNaFrente(frentes[meio], s)) {
+                inicio = meio + 1;
+            } else {
+                fim = meio;
+            }
+        }
+        if (inicio == static_cast<int>(frentes.size())) {
+            frentes.emplace_back();
+        }
+        frentes[inicio].push_back(indice);
+    }
+    return frentes;
+}
+
+// Frente e aglomeração de cada indivíduo. A aglomeração ordena cada frente
+// por objetivo: O(M·F log F) por frente de tamanho F.
+template <typename T>
+std::vector<ClassificacaoPareto<T>> classificarPareto(const std::vector<T>& objetivos, int numObjetivos) {
+    const int n = numObjetivos > 0 ? static_cast<int>(objetivos.size()) / numObjetivos : 0;
+    const T infinito = std::numeric_limits<T>::infinity();
+    std::vector<ClassificacaoPareto<T>> classificacao(n, ClassificacaoPareto<T>{0, T(0)});
+
+    std::vector<std::vector<int>> frentes = ordenarNaoDominados(objetivos, numObjetivos);
+    for (size_t f = 0; f < frentes.size(); f++) {
+        std::vector<int>& frente = frentes[f];
+        for (int indice : frente) {
+            classificacao[indice].frente = static_cast<int>(f);
+        }
+        if (frente.size() <= 2) {
+            for (int indice : frente) classificacao[indice].aglomeracao = infinito;
+            continue;
+        }
+
+        for (int m = 0; m < numObjetivos; m++) {
+            auto valor = [&](int indice) { return objetivos[static_cast<size_t>(indice) * numObjetivos + m]; };
+            std::sort(frente.begin(), frente.end(), [&](int a, int b) { return valor(a) < valor(b); });
+
+            T amplitude = valor(frente.back()) - valor(frente.front());
+            classificacao[frente.front()].aglomeracao = infinito;
+            classificacao[frente.back()].aglomeracao = infinito;
+            if (amplitude <= T(0)) continue;
+
+            for (size_t i = 1; i + 1 < frente.size(); i++) {
+                classificacao[frente[i]].aglomeracao += (valor(frente[i + 1]) - valor(frente[i - 1])) / amplitude;
+            }
+        }
+    }
+    return classificacao;
+}
+
+// Comparação de aglomeração: frente menor, depois aglomeração maior
+template <typename T>
+bool melhorPareto(const ClassificacaoPareto<T>& a, const ClassificacaoPareto<T>& b) {
+    if (a.frente != b.frente) return a.frente < b.frente;
+    return a.aglomeracao > b.aglomeracao;
+}
+
+} // namespace NEAT
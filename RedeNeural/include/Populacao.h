@@ -1,76 +1,155 @@
-#pragma once
-#include "Rede.h"
-#include "Especie.h"
-#include <vector>
-#include <functional>
-
-namespace NEAT {
-
-class Populacao {
-public:
-    struct Configuracao {
-        int tamanhoPopulacao;
-        float taxaElitismo;
-        float taxaMutacao;
-        float taxaCruzamento;
-        float limiarCompatibilidade;
-        int tamanhoTorneio;
-        int maxEspecies;
-        int geracoesSemMelhoria;
-
-        Configuracao() {
-            tamanhoPopulacao = 50;
-            taxaElitismo = 0.1f;
-            taxaMutacao = 0.3f;
-            taxaCruzamento = 0.8f;
-            limiarCompatibilidade = 3.0f;
-            tamanhoTorneio = 3;
-            maxEspecies = 10;
-            geracoesSemMelhoria = 15;
-        }
-    };
-
-private:
-    Configuracao config;
-    std::vector<Rede> individuos;
-    std::vector<Especie> especies;
-    int geracao;
-    float melhorAptidao;
-    
-    std::function<void(int, float, float, float)> onGeracaoCallback;
-
-public:
-    Populacao(int numEntradas, int numSaidas, const Configuracao& config = Configuracao());
-    
-    void evoluir();
-    void avaliarPopulacao(std::function<float(Rede&)> funcaoAvaliacao);
-    void selecao();
-    void cruzamento();
-    void mutacao();
-    void especiar();
-    void ajustarAptidoes();
-    void eliminarEspeciesFracas();
-    
-    int obterGeracao() const { return geracao; }
-    float obterMelhorAptidao() const { return melhorAptidao; }
-    std::vector<Rede>& obterIndividuos() { return individuos; }
-    const std::vector<Rede>& obterIndividuos() const { return individuos; }
-    const std::vector<Especie>& obterEspecies() const { return especies; }
-    
-    void definirCallbackGeracao(std::function<void(int, float, float, float)> callback) {
-        onGeracaoCallback = callback;
-    }
-    
-    void salvarMelhorRede(const std::string& arquivo);
-    void carregarMelhorRede(const std::string& arquivo);
-    
-    void definirConfiguracao(const Configuracao& novaConfig) {
-        config = novaConfig;
-    }
-
-protected:
-    Rede* selecaoTorneio(int tamanhoTorneio);
-    Rede cruzarRedes(const Rede& rede1, const Rede& rede2);
-};
-
+#pragma once
+#include "Rede.h"
+#include "Configuracao.h"
+#include "GerenciadorInovacao.h"
+#include "Especie.h"
+#include "AgendadorCorrida.h"
+#include "ModeloSubstituto.h"
+#include "BufferTriplo.h"
+#include "Snapshot.h"
+#include "SelecaoMultiobjetivo.h"
+#include <vector>
+#include <functional>
+#include <ostream>
+#include <random>
+
+namespace NEAT {
+
+class AvaliadorProcessos;
+class RegistroMetricas;
+class HallDaFama;
+
+class Populacao {
+public:
+    struct Configuracao {
+        int tamanhoPopulacao;
+        float taxaElitismo;
+        float taxaMutacao;
+        float taxaCruzamento;
+        float limiarCompatibilidade;
+        int tamanhoTorneio;
+        int maxEspecies;
+        int geracoesSemMelhoria;
+        int fatorPoolSubstituto;  // filhos gerados por vaga antes da pré-seleção (1 = desativado)
+        int threadsReproducao;    // 0 = std::thread::hardware_concurrency()
+        unsigned int semente;     // gerador da população (0 = sorteada com rand())
+        bool logDetalhado;        // mensagens de cada geração em std::wcout
+        ConfiguracaoNEAT neat;
+
+        Configuracao() {
+            tamanhoPopulacao = 50;
+            taxaElitismo = 0.1f;
+            taxaMutacao = 0.3f;
+            taxaCruzamento = 0.8f;
+            limiarCompatibilidade = 3.0f;
+            tamanhoTorneio = 3;
+            maxEspecies = 10;
+            geracoesSemMelhoria = 15;
+            fatorPoolSubstituto = 1;
+            threadsReproducao = 0;
+            semente = 0;
+            logDetalhado = true;
+        }
+    };
+
+private:
+    Configuracao config;
+    std::vector<Rede> individuos;
+    std::vector<Especie> especies;
+    std::vector<int> especieDosIndividuos;  // id da espécie de cada indivíduo (-1 = sem espécie)
+    std::vector<int> dicasEspecie;          // espécie dos pais, testada primeiro na especiação
+    int geracao;
+    float melhorAptidao;
+    int proximoIdEspecie;
+    
+    std::function<void(int, float, float, float)> onGeracaoCallback;
+    BufferTriplo<SnapshotRede>* bufferSnapshots;
+    RegistroMetricas* registroMetricas;
+    HallDaFama* hallDaFama;
+    std::vector<float> objetivos;  // da última avaliação multiobjetivo, numObjetivos por indivíduo
+    std::vector<SelecaoMultiobjetivo::Classificacao> classificacao;
+    int numObjetivos;
+    ModeloSubstituto modeloSubstituto;
+    GerenciadorInovacao inovacoes;
+    std::mt19937 gerador;
+
+public:
+    Populacao(int numEntradas, int numSaidas, const Configuracao& config = Configuracao());
+    
+    void evoluir();
+    void avaliarPopulacao(std::function<float(Rede&)> funcaoAvaliacao);
+    void avaliarPopulacao(AvaliadorProcessos& avaliador);
+    // Vários objetivos, todos maximizados: a função preenche numObjetivos valores
+    // por rede. A aptidão de seleção passa a ser a posição de Pareto (frentes
+    // melhores e, dentro da frente, regiões menos povoadas valem mais), então
+    // divisão de vagas, elitismo e torneio seguem a ordem do NSGA-II. A aptidão
+    // medida é o primeiro objetivo: é ela que melhorAptidao, a estagnação das
+    // espécies, o hall da fama, as métricas, o substituto e o callback veem.
+    void avaliarPopulacao(std::function<void(Rede&, float* objetivos)> funcaoObjetivos, int numObjetivos);
+    void avaliarComCorrida(std::function<float(Rede&, ContextoAvaliacao&)> funcaoAvaliacao,
+                           AgendadorCorrida& agendador);
+    void selecao();
+    void cruzamento();
+    void mutacao();
+    void especiar();
+    void ajustarAptidoes();
+    void eliminarEspeciesFracas();
+    
+    int obterGeracao() const { return geracao; }
+    float obterMelhorAptidao() const { return melhorAptidao; }
+    std::vector<Rede>& obterIndividuos() { return individuos; }
+    const std::vector<Rede>& obterIndividuos() const { return individuos; }
+    const std::vector<Especie>& obterEspecies() const { return especies; }
+    const std::vector<int>& obterEspeciesDosIndividuos() const { return especieDosIndividuos; }
+    const Configuracao& obterConfiguracao() const { return config; }
+    GerenciadorInovacao& obterGerenciadorInovacao() { return inovacoes; }
+    // Da última avaliação multiobjetivo, válidos até a próxima chamada de evoluir()
+    const std::vector<float>& obterObjetivos() const { return objetivos; }
+    const std::vector<SelecaoMultiobjetivo::Classificacao>& obterClassificacao() const { return classificacao; }
+    int obterNumObjetivos() const { return numObjetivos; }
+    std::vector<int> obterFrentePareto() const;
+    
+    void definirCallbackGeracao(std::function<void(int, float, float, float)> callback) {
+        onGeracaoCallback = callback;
+    }
+    
+    // Publica o campeão de cada geração para consumo assíncrono (nullptr desativa)
+    void definirBufferSnapshots(BufferTriplo<SnapshotRede>* buffer) {
+        bufferSnapshots = buffer;
+    }
+    
+    // Registra as métricas de cada geração avaliada (nullptr desativa)
+    void definirRegistroMetricas(RegistroMetricas* registro) {
+        registroMetricas = registro;
+    }
+    
+    // Arquiva os melhores de cada geração avaliada (nullptr desativa)
+    void definirHallDaFama(HallDaFama* hall) {
+        hallDaFama = hall;
+    }
+    
+    void salvarMelhorRede(const std::string& arquivo);
+    void carregarMelhorRede(const std::string& arquivo);
+    
+    void definirConfiguracao(const Configuracao& novaConfig) {
+        config = novaConfig;
+    }
+
+protected:
+    // Estado de uma thread de reprodução, reaproveitado entre filhos
+    struct EspacoReproducao {
+        std::mt19937 gerador;
+    };
+
+    Rede* selecaoTorneio(int tamanhoTorneio);
+    Rede cruzarRedes(const Rede& rede1, const Rede& rede2);
+    Rede cruzarRedes(const Rede& rede1, const Rede& rede2, EspacoReproducao& espaco);
+    Rede gerarFilho(const Especie& especie, EspacoReproducao& espaco, bool& porCruzamento);
+    int obterNumThreads() const;
+    std::wostream& log();
+    void ordenarIndividuos();
+    void ajustarIndicesEspecie();
+    Especie* buscarEspecie(int id);
+};
+
 } // namespace NEAT 
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+#include "Snapshot.h"
+#include <string>
+#include <vector>
+
+namespace NEAT {
+
+// Desenha uma rede num buffer RGBA em memória e grava como PNG, sem depender
+// de SDL ou de bibliotecas de imagem. Usa o mesmo layout do Visualizador.
+class RasterizadorPNG {
+public:
+    struct Cor {
+        unsigned char r, g, b, a;
+    };
+
+    struct Configuracao {
+        int largura;
+        int altura;
+        int raioNo;
+        bool mostrarBordas;
+        Cor corFundo;
+        Cor corEntrada;
+        Cor corOculta;
+        Cor corSaida;
+
+        Configuracao() {
+            largura = 200;
+            altura = 300;
+            raioNo = 5;
+            mostrarBordas = true;
+            corFundo = {0, 0, 0, 255};
+            corEntrada = {255, 0, 0, 255};
+            corOculta = {0, 255, 0, 255};
+            corSaida = {0, 0, 255, 255};
+        }
+    };
+
+private:
+    Configuracao config;
+    std::vector<unsigned char> pixels;  // RGBA, linha a linha
+
+    void pintar(int x, int y, Cor cor);
+    void desenharLinha(int x0, int y0, int x1, int y1, Cor cor);
+    void desenharRetangulo(int x, int y, int w, int h, Cor cor);
+
+public:
+    RasterizadorPNG(const Configuracao& config = Configuracao());
+
+    void desenhar(const SnapshotRede& snapshot);
+    bool salvar(const std::string& arquivo) const;
+
+    const std::vector<unsigned char>& obterPixels() const { return pixels; }
+};
+
+} // namespace NEAT
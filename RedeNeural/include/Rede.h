@@ -1,64 +1,123 @@
-#pragma once
-#include <vector>
-#include <string>
-
-namespace NEAT {
-
-struct Conexao {
-    int deNo;
-    int paraNo;
-    float peso;
-    bool ativo;
-    int inovacao;
-};
-
-struct No {
-    int id;
-    int camada;  // 0=entrada, 1=oculta, 2=saida
-    float valor;
-};
-
-class Rede {
-private:
-    static int proximaInovacao;
-    float aptidao;
-    int proximoIdNo;
-    std::vector<No> nos;
-    std::vector<Conexao> conexoes;
-    std::vector<float> entradas;
-    std::vector<float> saidas;
-
-    float sigmoid(float x);
-
-public:
-    Rede(int numEntradas = 5, int numSaidas = 1);
-    
-    // Métodos principais
-    void definirEntradas(const std::vector<float>& novasEntradas);
-    void avaliar();
-    void mutar();
-    void limpar();
-    
-    // Métodos de modificação da rede
-    void adicionarNoAleatorio();
-    void adicionarConexaoAleatoria();
-    void adicionarNo(int camada);
-    void adicionarConexao(int deNo, int paraNo, float peso);
-    
-    // Getters e Setters
-    const std::vector<No>& obterNos() const { return nos; }
-    void definirNos(const std::vector<No>& novosNos) { nos = novosNos; }
-    const std::vector<Conexao>& obterConexoes() const { return conexoes; }
-    void definirConexoes(const std::vector<Conexao>& novasConexoes) { conexoes = novasConexoes; }
-    const std::vector<float>& obterSaidas() const { return saidas; }
-    float obterAptidao() const { return aptidao; }
-    void definirAptidao(float f) { aptidao = f; }
-    static int obterProximaInovacao() { return proximaInovacao; }
-    int obterProximoIdNo() const { return proximoIdNo; }
-    
-    // Serialização
-    void salvar(const std::string& arquivo);
-    void carregar(const std::string& arquivo);
-};
-
+#pragma once
+#include "BlocosCompartilhados.h"
+#include "Configuracao.h"
+#include "Genes.h"
+#include "GenomaCompacto.h"
+#include "GerenciadorInovacao.h"
+#include "RedeEsparsa.h"
+#include <iosfwd>
+#include <memory>
+#include <random>
+#include <vector>
+#include <string>
+
+namespace NEAT {
+
+class Rede {
+private:
+    float aptidao;
+    float aptidaoSelecao;
+    int proximoIdNo;
+    // Genoma em blocos com cópia na escrita: cópias da rede (filhos, elite)
+    // compartilham os blocos que não alteram. As conexões ficam em colunas,
+    // ordenadas por inovação.
+    BlocosCompartilhados<No> nos;
+    GenomaCompacto conexoes;
+    std::vector<float> entradas;
+    std::vector<float> saidas;
+
+    // Plano de avaliação compilado do genoma, descartado após qualquer mudança
+    // nele e compartilhado entre cópias até lá. Guarda os valores dos nós e o
+    // estado recorrente, então é duplicado antes de avaliar se for
+    // compartilhado. Só é criado por métodos não-const.
+    std::shared_ptr<RedeEsparsa> plano;
+    std::vector<float> entradasPlano;
+
+    void genomaAlterado() { plano.reset(); }
+    RedeEsparsa& planoExclusivo();
+
+public:
+    // Sem gerenciador, as conexões iniciais recebem as inovações que um
+    // gerenciador novo daria (entrada * numSaidas + saída) e os pesos vêm de rand()
+    Rede(int numEntradas = 5, int numSaidas = 1);
+    Rede(int numEntradas, int numSaidas, GerenciadorInovacao& inovacoes, std::mt19937& gerador);
+    
+    // Métodos principais
+    void definirEntradas(const std::vector<float>& novasEntradas);
+    void definirEntradas(const float* novasEntradas, int quantidade);  // reaproveita o buffer
+    void avaliar();
+    void mutar();
+    // Não usa rand() nem o gerenciador de inovações: seguro entre threads.
+    // Conexões novas entram com GerenciadorInovacao::PENDENTE.
+    void mutar(std::mt19937& gerador, const ConfiguracaoNEAT& config);
+    void limpar();
+    
+    // Métodos de modificação da rede
+    void adicionarNoAleatorio();
+    void adicionarConexaoAleatoria();
+    void adicionarNo(int camada);
+    void adicionarNo(int camada, TipoAtivacao ativacao);
+    void adicionarConexao(int deNo, int paraNo, float peso, int inovacao);
+    void adicionarConexao(int deNo, int paraNo, float peso, GerenciadorInovacao& inovacoes);
+    // Dá às conexões com inovação pendente o número do gerenciador
+    void resolverInovacoes(GerenciadorInovacao& inovacoes);
+    void definirAtivacao(int indiceNo, TipoAtivacao ativacao);
+    void definirBias(int indiceNo, float bias);
+    
+    // Getters e Setters
+    // Visão só de leitura (size, [], iteração); paraVetor() copia
+    const BlocosCompartilhados<No>& obterNos() const { return nos; }
+    void definirNos(const std::vector<No>& novosNos) {
+        nos.atribuir(novosNos);
+        genomaAlterado();
+    }
+    void definirNos(const BlocosCompartilhados<No>& novosNos) {  // compartilha os blocos
+        nos = novosNos;
+        genomaAlterado();
+    }
+    // Conexões em colunas (conexao(i), peso(i), ...); paraConexoes() copia
+    const GenomaCompacto& obterGenomaCompacto() const { return conexoes; }
+    void definirConexoes(const std::vector<Conexao>& novasConexoes) {
+        conexoes = GenomaCompacto(novasConexoes);
+        genomaAlterado();
+    }
+    void definirConexoes(const GenomaCompacto& novasConexoes) {  // compartilha os blocos
+        conexoes = novasConexoes;
+        genomaAlterado();
+    }
+    // Valor do nó na última avaliação; nós eliminados na simplificação do
+    // fenótipo valem zero
+    float obterValorNo(int indiceNo) const;
+    // Memória do genoma que só esta rede referencia, em bytes
+    size_t bytesExclusivos() const { return nos.bytesExclusivos() + conexoes.bytesExclusivos(); }
+    const std::vector<float>& obterSaidas() const { return saidas; }
+    // Aptidão medida (no modo multiobjetivo, o primeiro objetivo): é o que
+    // métricas, estagnação, hall da fama, substituto e callback registram
+    float obterAptidao() const { return aptidao; }
+    void definirAptidao(float f) { aptidao = f; aptidaoSelecao = f; }
+    // O que a seleção compara (ordenação, elitismo, torneio, cruzamento e
+    // divisão de vagas): a própria aptidão, salvo no modo multiobjetivo, em
+    // que é a posição de Pareto
+    float obterAptidaoSelecao() const { return aptidaoSelecao; }
+    void definirAptidaoSelecao(float f) { aptidaoSelecao = f; }
+    int obterProximoIdNo() const { return proximoIdNo; }
+    
+    // Serialização. O arquivo tem assinatura e versão; carregar também lê o
+    // formato antigo, sem assinatura, com bias zero e sigmoide só nas saídas.
+    // Contagens maiores que o arquivo e ativações desconhecidas são recusadas
+    // com runtime_error, sem alterar a rede.
+    void salvar(const std::string& arquivo);
+    void carregar(const std::string& arquivo);
+    // O mesmo formato a partir da posição atual de um stream (o hall da fama
+    // grava cada registro assim); 'nome' identifica a origem nos erros
+    void salvar(std::ostream& out) const;
+    void carregar(std::istream& in, const std::string& nome);
+    
+    // Serialização em memória entre processos do mesmo binário: cópia direta
+    // de No e Conexao, sem versão
+    size_t tamanhoSerializado() const;
+    void serializar(char* destino) const;
+    void desserializar(const char* origem);
+};
+
 } // namespace NEAT 
\ No newline at end of file
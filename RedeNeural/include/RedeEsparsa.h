@@ -0,0 +1,132 @@
+#pragma once
+#include "Genes.h"
+#include "GenomaCompacto.h"
+#include <cmath>
+#include <vector>
+
+namespace NEAT {
+
+class Rede;
+
+// Fenótipo compilado de uma Rede para inferência: conexões desativadas e
+// pesos com |peso| <= limiar de poda são descartados, conexões paralelas são
+// somadas, nós sem caminho até uma saída são eliminados e nós que não
+// dependem de nenhuma entrada (nem de ciclos) são dobrados em constantes no
+// bias de quem os lê. O restante vira uma matriz CSR por nó de destino. Os
+// nós são renumerados em posições: entradas primeiro, depois por nível
+// topológico e, dentro do nível, por tipo de ativação. Cada grupo (nível,
+// ativação) é um bloco contíguo que recebe a ativação vetorizada de uma vez.
+// Nós em ciclo ficam num último nível e leem pelas conexões recorrentes o
+// valor da avaliação anterior.
+class RedeEsparsa {
+public:
+    struct RelatorioPoda {
+        int conexoesTotais;       // no genoma, incluindo desativadas
+        int conexoesMantidas;     // entradas não nulas da matriz CSR
+        float esparsidade;        // fração das conexões do genoma descartada
+        double nsOriginal;        // tempo médio do genoma completo (sem poda nem simplificação)
+        double nsEsparsa;         // tempo médio de RedeEsparsa::avaliar
+        double aceleracao;
+        float maiorDiferencaSaida; // entre as saídas das duas, nas mesmas entradas
+        bool saidasPreservadas;   // maiorDiferencaSaida <= tolerância
+    };
+
+    // Quanto o fenótipo encolheu em relação ao genoma; o genoma não é alterado
+    struct RelatorioSimplificacao {
+        int nosOriginais;
+        int nosMantidos;          // posições: entradas, saídas e nós calculados
+        int nosMortos;            // sem caminho até uma saída
+        int nosConstantes;        // sem caminho a partir de uma entrada, fora de ciclos
+        int conexoesOriginais;    // no genoma, incluindo desativadas
+        int conexoesDesativadas;
+        int conexoesPodadas;      // |peso| <= limiar de poda
+        int conexoesParalelas;    // somadas a outra de mesma origem e destino
+        int conexoesMantidas;
+    };
+
+private:
+    int numEntradas;                  // posições [0, numEntradas) são as entradas
+    std::vector<int> nosPorPosicao;   // índice em Rede::obterNos() de cada nó mantido
+    std::vector<int> posicoesSaida;   // na ordem de Rede::obterSaidas
+    std::vector<int> posicaoDoNo;     // inverso de nosPorPosicao; -1 = eliminado
+    std::vector<int> inicioGrupo;     // linhas de cada grupo; grupos + 1 posições
+    std::vector<TipoAtivacao> ativacaoGrupo;
+    std::vector<int> inicioLinha;     // linha r calcula a posição numEntradas + r
+    std::vector<int> colunas;         // posição de origem de cada peso
+    std::vector<float> pesos;
+    std::vector<float> bias;          // por linha
+    bool recorrente;
+    int conexoesTotais;
+    RelatorioSimplificacao simplificacao;
+    std::vector<float> valores;       // por posição; guarda o estado recorrente
+    std::vector<float> somas;
+    std::vector<float> saidas;
+    std::vector<float> valoresLote;   // posição-major: tamanhoLote valores por posição
+    std::vector<float> somasLote;
+
+    void compilar(const std::vector<No>& nos, const GenomaCompacto& genoma, float limiarPoda,
+                  bool simplificar);
+
+public:
+    RedeEsparsa();
+    RedeEsparsa(const Rede& rede, float limiarPoda = 0.0f);
+    RedeEsparsa(const std::vector<No>& nos, const std::vector<Conexao>& conexoes,
+                float limiarPoda = 0.0f);
+    // Sem 'simplificar', o plano executa o genoma como está: nenhuma poda e
+    // nenhuma eliminação de nós mortos, constantes ou conexões paralelas
+    RedeEsparsa(const std::vector<No>& nos, const GenomaCompacto& genoma, float limiarPoda = 0.0f,
+                bool simplificar = true);
+
+    void avaliar(const float* entradas, float* destinoSaidas);
+    const std::vector<float>& avaliar(const std::vector<float>& entradas);
+
+    // Avalia 'tamanhoLote' amostras independentes de uma vez. Entradas e saídas
+    // ficam por coluna: entradas[i * tamanhoLote + amostra], idem nas saídas.
+    // Cada peso vira um laço contíguo sobre o lote e cada grupo recebe a
+    // ativação num bloco só, então tudo vetoriza. Sem estado: conexões
+    // recorrentes leem zero.
+    void avaliarLote(const float* entradas, int tamanhoLote, float* destinoSaidas);
+
+    // Zera o estado das conexões recorrentes
+    void limpar();
+
+    int obterNumEntradas() const { return numEntradas; }
+    int obterNumSaidas() const { return static_cast<int>(posicoesSaida.size()); }
+    int obterNumConexoes() const { return static_cast<int>(pesos.size()); }
+    bool possuiRecorrencia() const { return recorrente; }
+    float obterEsparsidade() const;
+    const RelatorioSimplificacao& obterRelatorioSimplificacao() const { return simplificacao; }
+
+    // Estrutura compilada, para geradores de código
+    int obterNumPosicoes() const { return static_cast<int>(nosPorPosicao.size()); }
+    const std::vector<int>& obterNosPorPosicao() const { return nosPorPosicao; }
+    const std::vector<int>& obterPosicoesSaida() const { return posicoesSaida; }
+    const std::vector<int>& obterInicioGrupo() const { return inicioGrupo; }
+    const std::vector<TipoAtivacao>& obterAtivacaoGrupo() const { return ativacaoGrupo; }
+    const std::vector<int>& obterInicioLinha() const { return inicioLinha; }
+    const std::vector<int>& obterColunas() const { return colunas; }
+    const std::vector<float>& obterPesos() const { return pesos; }
+    const std::vector<float>& obterBias() const { return bias; }
+    const std::vector<float>& obterValores() const { return valores; }
+    // Valor do nó (índice em Rede::obterNos()) na última avaliação; zero se eliminado
+    float obterValorNo(int indiceNo) const {
+        int p = indiceNo < static_cast<int>(posicaoDoNo.size()) ? posicaoDoNo[indiceNo] : -1;
+        return p < 0 ? 0.0f : valores[p];
+    }
+
+    // Mede a aceleração em relação ao genoma completo de 'original', compilado
+    // sem poda nem simplificação (o mesmo kernel, então a diferença é só o que
+    // foi removido), e confere nas mesmas entradas que as saídas não mudaram
+    // além da tolerância
+    RelatorioPoda compararCom(const Rede& original, int repeticoes = 10000, float tolerancia = 1e-4f);
+
+    // Critério único de poda, usado ao compilar e em podarGenoma
+    static bool deveSerPodada(float peso, float limiarPoda) { return std::abs(peso) <= limiarPoda; }
+
+    // Desativa no próprio genoma as conexões com |peso| <= limiar, para que a
+    // evolução continue (e reajuste os pesos restantes) a partir da rede
+    // podada. Retorna quantas conexões foram desativadas.
+    static int podarGenoma(Rede& rede, float limiarPoda);
+};
+
+} // namespace NEAT
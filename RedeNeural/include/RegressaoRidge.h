@@ -0,0 +1,152 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+namespace NEAT {
+
+// Regressão ridge online com esquecimento: acumula X^T X e X^T y e resolve
+// (X^T X + λI) w = X^T y por Cholesky quando os coeficientes são pedidos. A
+// característica 0 é o intercepto e não é regularizada. Só cabeçalho, porque
+// também serve ao ModeloSubstituto de Redeneural_2.
+class RegressaoRidge {
+private:
+    int numCaracteristicas;
+    double regularizacao;
+    double fatorEsquecimento;
+    double amostras;                    // peso efetivo das amostras acumuladas
+    std::vector<double> xtx;            // X^T X (numCaracteristicas²)
+    std::vector<double> xty;            // X^T y
+    std::vector<double> coeficientes;
+    bool desatualizado;
+
+public:
+    RegressaoRidge(int numCaracteristicas = 0, double regularizacao = 1.0, double fatorEsquecimento = 0.9)
+        : numCaracteristicas(0), regularizacao(regularizacao), fatorEsquecimento(fatorEsquecimento),
+          amostras(0), desatualizado(false) {
+        redimensionar(numCaracteristicas);
+    }
+
+    // Descarta as amostras acumuladas
+    void redimensionar(int novoNumCaracteristicas) {
+        numCaracteristicas = novoNumCaracteristicas;
+        xtx.assign(static_cast<size_t>(numCaracteristicas) * numCaracteristicas, 0.0);
+        xty.assign(numCaracteristicas, 0.0);
+        coeficientes.assign(numCaracteristicas, 0.0);
+        amostras = 0;
+        desatualizado = false;
+    }
+
+    int obterNumCaracteristicas() const { return numCaracteristicas; }
+    double obterAmostras() const { return amostras; }
+
+    // Desconta as amostras antigas; chamado uma vez por geração
+    void envelhecer() {
+        for (double& valor : xtx) valor *= fatorEsquecimento;
+        for (double& valor : xty) valor *= fatorEsquecimento;
+        amostras *= fatorEsquecimento;
+        desatualizado = true;
+    }
+
+    void adicionarAmostra(const double* x, double y) {
+        const int n = numCaracteristicas;
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                xtx[i * n + j] += x[i] * x[j];
+            }
+            xty[i] += x[i] * y;
+        }
+        amostras += 1.0;
+        desatualizado = true;
+    }
+
+    // 'quantidade' linhas de características em sequência. Linhas idênticas
+    // (o mesmo genoma copiado por elitismo ou para completar a população)
+    // entram uma vez só, com a média dos alvos, para não pesarem mais no ajuste.
+    void adicionarLote(const double* x, const double* y, int quantidade) {
+        const int n = numCaracteristicas;
+        auto linha = [x, n](int r) { return x + static_cast<size_t>(r) * n; };
+        std::vector<int> ordem(quantidade);
+        std::iota(ordem.begin(), ordem.end(), 0);
+        std::sort(ordem.begin(), ordem.end(), [&](int a, int b) {
+            return std::lexicographical_compare(linha(a), linha(a) + n, linha(b), linha(b) + n);
+        });
+
+        for (size_t inicio = 0; inicio < ordem.size();) {
+            const double* primeira = linha(ordem[inicio]);
+            size_t fim = inicio + 1;
+            double soma = y[ordem[inicio]];
+            while (fim < ordem.size() && std::equal(primeira, primeira + n, linha(ordem[fim]))) {
+                soma += y[ordem[fim]];
+                fim++;
+            }
+            adicionarAmostra(primeira, soma / static_cast<double>(fim - inicio));
+            inicio = fim;
+        }
+    }
+
+    // Resolve os coeficientes pendentes; depois disso prever() pode ser
+    // chamado de várias threads ao mesmo tempo
+    void resolver() {
+        if (!desatualizado) return;
+        const int n = numCaracteristicas;
+
+        std::vector<double> a = xtx;
+        for (int i = 1; i < n; i++) {
+            a[i * n + i] += regularizacao;
+        }
+        if (n > 0) a[0] += 1e-9;
+
+        for (int j = 0; j < n; j++) {
+            double diagonal = a[j * n + j];
+            for (int k = 0; k < j; k++) {
+                diagonal -= a[j * n + k] * a[j * n + k];
+            }
+            if (diagonal <= 0) {
+                // Sistema degenerado: manter os coeficientes anteriores
+                desatualizado = false;
+                return;
+            }
+            a[j * n + j] = std::sqrt(diagonal);
+            for (int i = j + 1; i < n; i++) {
+                double valor = a[i * n + j];
+                for (int k = 0; k < j; k++) {
+                    valor -= a[i * n + k] * a[j * n + k];
+                }
+                a[i * n + j] = valor / a[j * n + j];
+            }
+        }
+
+        // L z = b, depois L^T w = z
+        std::vector<double> z(n);
+        for (int i = 0; i < n; i++) {
+            double valor = xty[i];
+            for (int k = 0; k < i; k++) {
+                valor -= a[i * n + k] * z[k];
+            }
+            z[i] = valor / a[i * n + i];
+        }
+        for (int i = n - 1; i >= 0; i--) {
+            double valor = z[i];
+            for (int k = i + 1; k < n; k++) {
+                valor -= a[k * n + i] * coeficientes[k];
+            }
+            coeficientes[i] = valor / a[i * n + i];
+        }
+        desatualizado = false;
+    }
+
+    bool estaDesatualizado() const { return desatualizado; }
+
+    // Usa os coeficientes da última chamada a resolver()
+    double prever(const double* x) const {
+        double previsao = 0;
+        for (int i = 0; i < numCaracteristicas; i++) {
+            previsao += coeficientes[i] * x[i];
+        }
+        return previsao;
+    }
+};
+
+} // namespace NEAT
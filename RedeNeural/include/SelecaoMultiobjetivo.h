@@ -0,0 +1,44 @@
+#pragma once
+#include "OrdenacaoPareto.h"
+#include "Rede.h"
+#include <vector>
+
+namespace NEAT {
+
+// Seleção multiobjetivo no estilo NSGA-II: ordenação em frentes não dominadas
+// e distância de aglomeração dentro de cada frente (OrdenacaoPareto.h). Todos
+// os objetivos são maximizados (custos entram com sinal trocado); 'objetivos'
+// guarda numObjetivos valores por indivíduo, em sequência.
+class SelecaoMultiobjetivo {
+public:
+    using Classificacao = ClassificacaoPareto<float>;
+
+    static bool domina(const float* a, const float* b, int numObjetivos) {
+        return dominaPareto(a, b, numObjetivos);
+    }
+
+    // O(N log N) com dois objetivos; com M > 2, pior caso O(M·N²)
+    static std::vector<std::vector<int>> ordenarNaoDominados(const std::vector<float>& objetivos,
+                                                             int numObjetivos) {
+        return NEAT::ordenarNaoDominados(objetivos, numObjetivos);
+    }
+
+    // Frente e aglomeração de cada indivíduo
+    static std::vector<Classificacao> classificar(const std::vector<float>& objetivos, int numObjetivos) {
+        return classificarPareto(objetivos, numObjetivos);
+    }
+
+    // Comparação de aglomeração: frente menor, depois aglomeração maior
+    static bool melhor(const Classificacao& a, const Classificacao& b) { return melhorPareto(a, b); }
+
+    // Os 'quantidade' melhores: frentes inteiras, a última cortada pela aglomeração
+    static std::vector<int> selecionar(const std::vector<Classificacao>& classificacao, int quantidade);
+
+    // Objetivos de custo prontos (use com sinal trocado)
+    static float tamanhoRede(const Rede& rede) { return static_cast<float>(rede.obterNos().size()); }
+    static float custoInferencia(const Rede& rede) {
+        return static_cast<float>(rede.obterGenomaCompacto().contarAtivos());
+    }
+};
+
+} // namespace NEAT
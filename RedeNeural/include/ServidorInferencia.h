@@ -0,0 +1,161 @@
+#pragma once
+
+#ifndef __linux__
+#error "ServidorInferencia usa epoll, eventfd, timerfd e sockets SOCK_SEQPACKET: só compila no Linux"
+#endif
+
+#include "Rede.h"
+#include "RedeEsparsa.h"
+#include "Metricas.h"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace NEAT {
+
+// Protocolo do servidor de inferência: um pacote SOCK_SEQPACKET por mensagem,
+// com este cabeçalho seguido dos dados. Em INFERENCIA os dados são
+// 'quantidade' floats (entradas na requisição, saídas na resposta); em
+// ESTATISTICAS e ERRO, 'quantidade' bytes (EstatisticasInferencia ou o texto
+// do erro). A resposta repete o id da requisição.
+struct MensagemInferencia {
+    enum Tipo : uint32_t { INFERENCIA = 0, ESTATISTICAS = 1, ERRO = 2 };
+
+    uint32_t tipo;
+    uint32_t modelo;
+    uint32_t id;
+    uint32_t quantidade;
+};
+
+struct EstatisticasInferencia {
+    long long requisicoes;
+    long long lotes;
+    long long descartadas;      // respostas que o cliente não pôde receber
+    float loteMedio;
+    float latenciaP50Us;        // da chegada da requisição ao envio da resposta
+    float latenciaP99Us;
+    float requisicoesPorSegundo;
+};
+
+// Socket padrão, por usuário: $XDG_RUNTIME_DIR/neat_inferencia.sock ou, sem a
+// variável, /tmp/neat_inferencia-<uid>/inferencia.sock, num diretório 0700
+// criado pelo servidor
+std::string caminhoSocketInferenciaPadrao();
+
+// Servidor de inferência local (apenas Linux): carrega campeões salvos com
+// Rede::salvar e atende vários processos por um socket Unix. As requisições
+// de cada modelo se acumulam em micro-lotes, avaliados por
+// RedeEsparsa::avaliarLote quando o lote enche ou quando a mais antiga atinge
+// o prazo. Uma thread faz E/S e inferência, sem travas no caminho quente.
+// A avaliação em lote não tem estado: conexões recorrentes leem zero.
+// Ao iniciar, um socket antigo no caminho é substituído; qualquer outro tipo
+// de arquivo ali faz iniciar() falhar, sem apagá-lo.
+class ServidorInferencia {
+public:
+    struct Configuracao {
+        std::string caminhoSocket;
+        int tamanhoMaximoLote;
+        int prazoMicros;           // espera máxima da requisição mais antiga
+        int maximoEntradas;        // floats aceitos por requisição
+
+        Configuracao() {
+            caminhoSocket = caminhoSocketInferenciaPadrao();
+            tamanhoMaximoLote = 64;
+            prazoMicros = 500;
+            maximoEntradas = 4096;
+        }
+    };
+
+private:
+    struct Pendente {
+        int cliente;
+        uint32_t id;
+        long long chegadaNs;
+    };
+
+    struct Modelo {
+        std::string arquivo;
+        RedeEsparsa rede;
+        std::vector<Pendente> pendentes;
+        std::vector<float> entradas;     // uma linha por pendente
+        std::vector<float> loteEntradas; // por coluna, para avaliarLote
+        std::vector<float> loteSaidas;
+    };
+
+    Configuracao config;
+    std::vector<Modelo> modelos;
+    int socketServidor;
+    int epoll;
+    int evento;       // acorda o loop para encerrar
+    int temporizador; // dispara no prazo da requisição mais antiga
+    bool socketCriado;  // só remove o caminho do socket se foi este servidor que o criou
+    std::atomic<bool> executando;
+    std::thread thread;
+    std::vector<int> clientes;
+    std::vector<char> buffer;
+
+    std::mutex mutexEstatisticas;
+    long long requisicoes;
+    long long lotes;
+    long long descartadas;
+    long long inicioNs;
+    EstimadorQuantil latenciaP50;
+    EstimadorQuantil latenciaP99;
+
+    void loop();
+    void aceitarClientes();
+    void lerCliente(int cliente);
+    void fecharCliente(int cliente);
+    void processar(Modelo& modelo);
+    void processarVencidos(long long agora);
+    void armarTemporizador();
+    void responder(int cliente, const MensagemInferencia& cabecalho, const void* dados, size_t bytes);
+    void responderErro(int cliente, uint32_t id, const std::string& mensagem);
+    void encerrar();
+
+public:
+    ServidorInferencia(const Configuracao& config = Configuracao());
+    ~ServidorInferencia();
+
+    ServidorInferencia(const ServidorInferencia&) = delete;
+    ServidorInferencia& operator=(const ServidorInferencia&) = delete;
+
+    // Retorna o índice do modelo, usado nas requisições; antes de iniciar()
+    int adicionarModelo(const std::string& arquivo);
+
+    void iniciar();
+    void parar();
+
+    int obterNumModelos() const { return static_cast<int>(modelos.size()); }
+    EstatisticasInferencia obterEstatisticas();
+    void zerarEstatisticas();
+};
+
+// Cliente bloqueante: uma requisição por vez. Lança std::runtime_error em
+// falha de conexão ou resposta de erro.
+class ClienteInferencia {
+private:
+    int socketCliente;
+    uint32_t proximoId;
+    std::vector<char> buffer;
+
+    // Envia e espera a resposta de mesmo id; 'bytesDados' recebe quantos bytes
+    // chegaram depois do cabeçalho, o limite para ler o corpo
+    const MensagemInferencia& trocar(const MensagemInferencia& requisicao, const float* dados,
+                                     size_t& bytesDados);
+
+public:
+    explicit ClienteInferencia(const std::string& caminhoSocket = caminhoSocketInferenciaPadrao());
+    ~ClienteInferencia();
+
+    ClienteInferencia(const ClienteInferencia&) = delete;
+    ClienteInferencia& operator=(const ClienteInferencia&) = delete;
+
+    std::vector<float> inferir(int modelo, const std::vector<float>& entradas);
+    EstatisticasInferencia obterEstatisticas();
+};
+
+} // namespace NEAT
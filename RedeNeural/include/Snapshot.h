@@ -0,0 +1,33 @@
+#pragma once
+#include "Rede.h"
+#include <vector>
+
+namespace NEAT {
+
+// Cópia imutável de uma rede e das suas ativações, para consumo fora da
+// thread de treino (visualização, gravação de quadros)
+struct SnapshotRede {
+    int geracao;
+    float aptidao;
+    std::vector<No> nos;
+    std::vector<float> valores;   // de cada nó na última avaliação, na ordem de nos
+    std::vector<Conexao> conexoes;
+    std::vector<float> saidas;
+
+    SnapshotRede() : geracao(0), aptidao(0) {}
+
+    // Reaproveita a capacidade dos vetores: sem alocação depois do primeiro uso
+    void capturar(const Rede& rede, int numeroGeracao) {
+        geracao = numeroGeracao;
+        aptidao = rede.obterAptidao();
+        nos.assign(rede.obterNos().begin(), rede.obterNos().end());
+        valores.resize(nos.size());
+        for (size_t i = 0; i < nos.size(); i++) {
+            valores[i] = rede.obterValorNo(static_cast<int>(i));
+        }
+        rede.obterGenomaCompacto().paraConexoes(conexoes);
+        saidas.assign(rede.obterSaidas().begin(), rede.obterSaidas().end());
+    }
+};
+
+} // namespace NEAT
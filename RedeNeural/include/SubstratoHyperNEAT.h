@@ -0,0 +1,62 @@
+#pragma once
+#include "Rede.h"
+#include <vector>
+
+namespace NEAT {
+
+// HyperNEAT: uma Rede evoluída serve de CPPN e gera os pesos de uma rede
+// densa muito maior. Cada camada do substrato tem neurônios com coordenadas
+// (x, y) em [-1, 1]; o peso da ligação j -> i entre camadas consecutivas é
+// a saída da CPPN para (xj, yj, xi, yi, distância), consultada em lotes; o
+// bias do neurônio i é a saída para (0, 0, xi, yi, distância).
+//
+// Os pesos saem no layout de RedeNeural::copiarCamadasParaVetor (Redeneural_2):
+// para cada camada depois da entrada, uma linha contígua por neurônio com um
+// peso por neurônio da camada anterior seguido do bias. Com camadas
+// {entradas, escondidas..., saídas} o vetor vai direto para
+// copiarVetorParaCamadas ou para calcularSaidaComPesos.
+class SubstratoHyperNEAT {
+public:
+    static constexpr int NUM_ENTRADAS_CPPN = 5;
+
+    struct Configuracao {
+        float limiarExpressao;  // |saída| abaixo disso não expressa a ligação (peso ou bias 0)
+        float escalaPeso;       // pesos expressos ficam em (-escala, escala)
+        int tamanhoLote;        // consultas avaliadas de uma vez pela CPPN
+
+        Configuracao() {
+            limiarExpressao = 0.2f;
+            escalaPeso = 3.0f;
+            tamanhoLote = 1024;
+        }
+    };
+
+private:
+    Configuracao config;
+    std::vector<int> camadas;
+    std::vector<std::vector<float>> coordenadasX;
+    std::vector<std::vector<float>> coordenadasY;
+
+public:
+    // Por padrão cada camada é uma linha horizontal em y = 0
+    SubstratoHyperNEAT(const std::vector<int>& camadas, const Configuracao& config = Configuracao());
+
+    // Dispõe a camada numa grade de 'largura' colunas (entradas de imagem, por exemplo)
+    void definirGrade(int camada, int largura);
+    void definirCoordenadas(int camada, const std::vector<float>& x, const std::vector<float>& y);
+
+    // Uma saída por par de camadas consecutivas; uma CPPN com uma saída só
+    // serve a todas as camadas
+    int obterNumSaidasCPPN() const { return static_cast<int>(camadas.size()) - 1; }
+    // Σ neurônios * (neurônios da camada anterior + 1), como RedeNeural::getQuantidadePesos
+    int obterQuantidadePesos() const;
+    const std::vector<int>& obterCamadas() const { return camadas; }
+
+    // Saídas da CPPN em tanh, para que os pesos tenham os dois sinais
+    static void configurarCPPN(Rede& cppn);
+
+    void gerarPesos(const Rede& cppn, std::vector<double>& pesos) const;
+    void gerarPesos(const Rede& cppn, double* pesos) const;
+};
+
+} // namespace NEAT
@@ -1,48 +1,69 @@
-#pragma once
-#include "Rede.h"
-#include <SDL2/SDL.h>
-
-namespace NEAT {
-
-class Visualizador {
-public:
-    struct Configuracao {
-        int largura;
-        int altura;
-        int raioNo;
-        bool mostrarPesos;
-        bool mostrarBordas;
-        SDL_Color corFundo;
-        SDL_Color corEntrada;
-        SDL_Color corOculta;
-        SDL_Color corSaida;
-
-        // Construtor com valores padrão
-        Configuracao() {
-            largura = 200;
-            altura = 300;
-            raioNo = 5;
-            mostrarPesos = true;
-            mostrarBordas = true;
-            corFundo = {0, 0, 0, 128};
-            corEntrada = {255, 0, 0, 255};
-            corOculta = {0, 255, 0, 255};
-            corSaida = {0, 0, 255, 255};
-        }
-    };
-
-private:
-    SDL_Renderer* renderer;
-    SDL_Rect area;
-    Configuracao config;
-
-public:
-    Visualizador(SDL_Renderer* renderer, const SDL_Rect& area, 
-                 const Configuracao& config = Configuracao());
-    
-    void renderizar(const Rede& rede);
-    void definirArea(const SDL_Rect& novaArea) { area = novaArea; }
-    void definirConfiguracao(const Configuracao& novaConfig) { config = novaConfig; }
-};
-
+#pragma once
+#include "Rede.h"
+#include "Snapshot.h"
+#include <SDL2/SDL.h>
+#include <vector>
+
+namespace NEAT {
+
+class Visualizador {
+public:
+    struct Configuracao {
+        int largura;
+        int altura;
+        int raioNo;
+        bool mostrarPesos;
+        bool mostrarBordas;
+        SDL_Color corFundo;
+        SDL_Color corEntrada;
+        SDL_Color corOculta;
+        SDL_Color corSaida;
+
+        // Construtor com valores padrão
+        Configuracao() {
+            largura = 200;
+            altura = 300;
+            raioNo = 5;
+            mostrarPesos = true;
+            mostrarBordas = true;
+            corFundo = {0, 0, 0, 128};
+            corEntrada = {255, 0, 0, 255};
+            corOculta = {0, 255, 0, 255};
+            corSaida = {0, 0, 255, 255};
+        }
+    };
+
+private:
+    SDL_Renderer* renderer;
+    SDL_Rect area;
+    Configuracao config;
+    
+    // Geometria em cache, reconstruída apenas quando a topologia ou a área mudam
+    bool cacheValido;
+    size_t hashTopologia;
+    std::vector<int> conexoesDesenhadas;         // índices no genoma da rede
+    std::vector<SDL_Vertex> verticesConexoes;    // 4 vértices por conexão
+    std::vector<int> indicesConexoes;            // 6 índices por conexão
+    std::vector<SDL_Vertex> verticesNos;         // borda + preenchimento por nó
+    std::vector<int> indicesNos;
+    
+    // Nos: std::vector<No> ou BlocosCompartilhados<No>; Conexoes: std::vector<Conexao>
+    // ou GenomaCompacto. A Rede é lida direto das visões, sem cópia por quadro.
+    template <typename Nos, typename Conexoes>
+    void reconstruirGeometria(const Nos& nos, const Conexoes& conexoes);
+    template <typename Conexoes>
+    void atualizarCoresConexoes(const Conexoes& conexoes);
+    template <typename Nos, typename Conexoes>
+    void renderizar(const Nos& nos, const Conexoes& conexoes);
+
+public:
+    Visualizador(SDL_Renderer* renderer, const SDL_Rect& area, 
+                 const Configuracao& config = Configuracao());
+    
+    void renderizar(const Rede& rede);
+    void renderizar(const SnapshotRede& snapshot);
+    void definirArea(const SDL_Rect& novaArea) { area = novaArea; cacheValido = false; }
+    void definirConfiguracao(const Configuracao& novaConfig) { config = novaConfig; cacheValido = false; }
+};
+
 } // namespace NEAT 
\ No newline at end of file
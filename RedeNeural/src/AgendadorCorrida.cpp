@@ -0,0 +1,97 @@
+#include "../include/AgendadorCorrida.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <unordered_map>
+
+namespace NEAT {
+
+AgendadorCorrida::AgendadorCorrida(const Configuracao& config) : config(config) {
+}
+
+void AgendadorCorrida::avaliar(std::vector<Rede>& redes,
+                               const std::function<float(Rede&, ContextoAvaliacao&)>& funcaoAvaliacao,
+                               const std::vector<int>& especies) {
+    estatisticas = Estatisticas();
+    if (redes.empty()) return;
+    
+    const float semCorte = -std::numeric_limits<float>::infinity();
+    const bool podeCortar = config.ganhoMaximoPorPasso >= 0 && config.orcamentoPassos > 0;
+    const int episodiosMinimos = std::max(1, config.episodiosMinimos);
+    const int episodiosMaximos = std::max(episodiosMinimos, config.episodiosMaximos);
+    
+    // Os k melhores resultados completos definem o corte de sobrevivência
+    size_t k = std::max<size_t>(1, static_cast<size_t>(std::ceil(config.fracaoSobrevivencia * redes.size())));
+    std::priority_queue<float, std::vector<float>, std::greater<float>> melhores;
+    std::unordered_map<int, float> melhorPorEspecie;
+    
+    ContextoAvaliacao contexto(config.orcamentoPassos, config.orcamentoSegundos);
+    
+    for (size_t i = 0; i < redes.size(); i++) {
+        Rede& rede = redes[i];
+        int especie = i < especies.size() ? especies[i] : -1;
+        
+        float corte = melhores.size() >= k ? melhores.top() : semCorte;
+        if (especie >= 0) {
+            // Ainda pode ser o campeão da espécie: corte não se aplica acima disso
+            auto it = melhorPorEspecie.find(especie);
+            corte = std::min(corte, it != melhorPorEspecie.end() ? it->second : semCorte);
+        }
+        
+        float soma = 0;
+        int episodios = 0;
+        bool cortado = false;
+        
+        while (episodios < episodiosMaximos) {
+            contexto.reiniciar();
+            
+            // Num episódio extra, o corte vale para a média: este episódio
+            // precisa de pelo menos corte * (e + 1) - soma
+            float corteEpisodio = corte == semCorte ? semCorte : corte * (episodios + 1) - soma;
+            if (podeCortar && corteEpisodio != semCorte) {
+                contexto.definirCorte(corteEpisodio, config.ganhoMaximoPorPasso);
+            } else {
+                contexto.removerCorte();
+            }
+            
+            float aptidao = funcaoAvaliacao(rede, contexto);
+            soma += aptidao;
+            episodios++;
+            estatisticas.episodios++;
+            estatisticas.passos += contexto.obterPassos();
+            
+            if (contexto.foiCortado()) {
+                cortado = true;
+                break;
+            }
+            // Episódios extras apenas para quem ainda disputa o corte
+            if (episodios >= episodiosMinimos && soma / episodios < corte) {
+                break;
+            }
+        }
+        
+        float media = soma / episodios;
+        rede.definirAptidao(media);
+        estatisticas.avaliacoes++;
+        
+        if (cortado) {
+            estatisticas.cortadas++;
+            continue;
+        }
+        
+        melhores.push(media);
+        if (melhores.size() > k) {
+            melhores.pop();
+        }
+        if (especie >= 0) {
+            auto it = melhorPorEspecie.find(especie);
+            if (it == melhorPorEspecie.end() || media > it->second) {
+                melhorPorEspecie[especie] = media;
+            }
+        }
+    }
+}
+
+} // namespace NEAT
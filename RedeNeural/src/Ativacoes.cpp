@@ -0,0 +1,100 @@
+#include "../include/Ativacoes.h"
+#include <algorithm>
+#include <cstring>
+
+namespace NEAT {
+
+namespace {
+
+// exp(x) = 2^i * 2^f, com i = round(x / ln 2) montado direto no expoente do
+// float e 2^f por polinômio de grau 6 em [-0.5, 0.5] (erro relativo ~1e-7).
+// Requer x em [-87, 88]: quem chama satura a entrada num laço separado,
+// porque comparações no mesmo laço impedem a vetorização.
+inline float expRapido(float x) {
+    float t = x * 1.44269504f;
+
+    // Arredondamento pela soma de 1.5 * 2^23: os bits da mantissa guardam o
+    // inteiro, sem conversão float -> int
+    float m = t + 12582912.0f;
+    int32_t inteiro;
+    std::memcpy(&inteiro, &m, sizeof(inteiro));
+    inteiro -= 0x4B400000;
+    float f = t - (m - 12582912.0f);
+
+    float p = 1.54035304e-4f;
+    p = p * f + 1.33335581e-3f;
+    p = p * f + 9.61812911e-3f;
+    p = p * f + 5.55041087e-2f;
+    p = p * f + 2.40226507e-1f;
+    p = p * f + 6.93147181e-1f;
+    p = p * f + 1.0f;
+    int32_t bits;
+    std::memcpy(&bits, &p, sizeof(bits));
+    bits += inteiro * (1 << 23);
+    float resultado;
+    std::memcpy(&resultado, &bits, sizeof(resultado));
+    return resultado;
+}
+
+// Fora desses limites as funções já estão saturadas em float
+void saturar(float* valores, int quantidade, float limite) {
+    for (int i = 0; i < quantidade; i++) {
+        valores[i] = std::min(limite, std::max(-limite, valores[i]));
+    }
+}
+
+} // namespace
+
+void aplicarAtivacao(TipoAtivacao tipo, float* valores, int quantidade) {
+    switch (tipo) {
+        case TipoAtivacao::SIGMOIDE:
+            saturar(valores, quantidade, 80.0f);
+            for (int i = 0; i < quantidade; i++) {
+                valores[i] = 1.0f / (1.0f + expRapido(-valores[i]));
+            }
+            break;
+        case TipoAtivacao::TANH:
+            saturar(valores, quantidade, 40.0f);
+            for (int i = 0; i < quantidade; i++) {
+                valores[i] = 2.0f / (1.0f + expRapido(-2.0f * valores[i])) - 1.0f;
+            }
+            break;
+        case TipoAtivacao::RELU:
+            for (int i = 0; i < quantidade; i++) {
+                valores[i] = std::max(0.0f, valores[i]);
+            }
+            break;
+        case TipoAtivacao::DEGRAU:
+            for (int i = 0; i < quantidade; i++) {
+                valores[i] = valores[i] > 0.0f ? 1.0f : 0.0f;
+            }
+            break;
+        case TipoAtivacao::GAUSSIANA:
+            saturar(valores, quantidade, 9.0f);
+            for (int i = 0; i < quantidade; i++) {
+                valores[i] = expRapido(-valores[i] * valores[i]);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+float ativar(TipoAtivacao tipo, float x) {
+    aplicarAtivacao(tipo, &x, 1);
+    return x;
+}
+
+const char* nomeAtivacao(TipoAtivacao tipo) {
+    switch (tipo) {
+        case TipoAtivacao::IDENTIDADE: return "identidade";
+        case TipoAtivacao::SIGMOIDE: return "sigmoide";
+        case TipoAtivacao::TANH: return "tanh";
+        case TipoAtivacao::RELU: return "relu";
+        case TipoAtivacao::DEGRAU: return "degrau";
+        case TipoAtivacao::GAUSSIANA: return "gaussiana";
+        default: return "desconhecida";
+    }
+}
+
+} // namespace NEAT
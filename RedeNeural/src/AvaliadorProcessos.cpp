@@ -0,0 +1,321 @@
+#include "../include/AvaliadorProcessos.h"
+
+#ifdef __linux__
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace NEAT {
+
+namespace {
+
+// Estados de um slot; valores positivos são o pid do trabalhador que o avalia
+constexpr int SLOT_LIVRE = 0;
+constexpr int SLOT_PRONTO = -1;
+constexpr int SLOT_CONCLUIDO = -2;
+
+size_t alinhar(size_t tamanho) {
+    return (tamanho + 63) & ~size_t(63);
+}
+
+long long agoraNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+struct AvaliadorProcessos::Cabecalho {
+    std::atomic<int> encerrar;
+    int numSlots;
+};
+
+struct AvaliadorProcessos::Slot {
+    std::atomic<int> estado;
+    std::atomic<long long> inicioNs;
+    int indice;
+    int tentativas;
+    float aptidao;
+};
+
+AvaliadorProcessos::AvaliadorProcessos(std::function<float(Rede&)> funcaoAvaliacao,
+                                       const Configuracao& config)
+    : config(config), funcaoAvaliacao(funcaoAvaliacao), memoria(nullptr),
+      tamanhoMemoria(0), tamanhoSlot(0), eventoTrabalho(-1), eventoResultado(-1),
+      reinicios(0), temposEsgotados(0) {
+
+    if (this->config.numTrabalhadores <= 0) {
+        throw std::runtime_error("Número de trabalhadores inválido");
+    }
+    int numSlots = this->config.capacidadeAnel > 0
+        ? this->config.capacidadeAnel
+        : 2 * this->config.numTrabalhadores;
+
+    // Layout: cabeçalho seguido de numSlots slots (metadados + bytes do genoma)
+    tamanhoSlot = alinhar(sizeof(Slot)) + alinhar(this->config.tamanhoMaximoGenoma);
+    tamanhoMemoria = alinhar(sizeof(Cabecalho)) + numSlots * tamanhoSlot;
+    memoria = mmap(nullptr, tamanhoMemoria, PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (memoria == MAP_FAILED) {
+        memoria = nullptr;
+        throw std::runtime_error("Erro ao mapear memória compartilhada");
+    }
+
+    Cabecalho* cab = new (memoria) Cabecalho();
+    cab->encerrar.store(0);
+    cab->numSlots = numSlots;
+    for (int i = 0; i < numSlots; i++) {
+        Slot* s = new (slot(i)) Slot();
+        s->estado.store(SLOT_LIVRE);
+        s->inicioNs.store(0);
+    }
+
+    eventoTrabalho = eventfd(0, EFD_SEMAPHORE | EFD_CLOEXEC);
+    eventoResultado = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (eventoTrabalho < 0 || eventoResultado < 0) {
+        encerrar();
+        throw std::runtime_error("Erro ao criar eventfd");
+    }
+
+    trabalhadores.assign(this->config.numTrabalhadores, -1);
+    for (int i = 0; i < this->config.numTrabalhadores; i++) {
+        iniciarTrabalhador(i);
+    }
+}
+
+AvaliadorProcessos::~AvaliadorProcessos() {
+    encerrar();
+}
+
+AvaliadorProcessos::Cabecalho* AvaliadorProcessos::cabecalho() const {
+    return static_cast<Cabecalho*>(memoria);
+}
+
+AvaliadorProcessos::Slot* AvaliadorProcessos::slot(int indice) const {
+    char* base = static_cast<char*>(memoria) + alinhar(sizeof(Cabecalho));
+    return reinterpret_cast<Slot*>(base + indice * tamanhoSlot);
+}
+
+char* AvaliadorProcessos::dadosSlot(int indice) const {
+    return reinterpret_cast<char*>(slot(indice)) + alinhar(sizeof(Slot));
+}
+
+void AvaliadorProcessos::iniciarTrabalhador(int posicao) {
+    std::wcout.flush();
+    pid_t pid = fork();
+    if (pid < 0) {
+        throw std::runtime_error("Erro ao criar processo trabalhador");
+    }
+    if (pid == 0) {
+        loopTrabalhador();
+        _exit(0);
+    }
+    trabalhadores[posicao] = pid;
+}
+
+void AvaliadorProcessos::loopTrabalhador() {
+    Cabecalho* cab = cabecalho();
+    int pid = static_cast<int>(getpid());
+    int inicioBusca = 0;
+    Rede rede(0, 0);
+
+    while (true) {
+        uint64_t valor;
+        if (read(eventoTrabalho, &valor, sizeof(valor)) != sizeof(valor)) {
+            if (errno == EINTR) continue;
+            _exit(1);
+        }
+        if (cab->encerrar.load()) {
+            _exit(0);
+        }
+
+        // Reivindicar o próximo slot pronto; o CAS já registra o dono
+        for (int k = 0; k < cab->numSlots; k++) {
+            int i = (inicioBusca + k) % cab->numSlots;
+            Slot* s = slot(i);
+            int esperado = SLOT_PRONTO;
+            if (!s->estado.compare_exchange_strong(esperado, pid)) continue;
+
+            s->inicioNs.store(agoraNs());
+            rede.desserializar(dadosSlot(i));
+            rede.definirAptidao(0);
+
+            float aptidao;
+            try {
+                aptidao = funcaoAvaliacao(rede);
+            } catch (...) {
+                // Tratado pelo mestre como queda do trabalhador
+                _exit(1);
+            }
+
+            s->aptidao = aptidao;
+            s->inicioNs.store(0);
+            s->estado.store(SLOT_CONCLUIDO, std::memory_order_release);
+
+            uint64_t um = 1;
+            if (write(eventoResultado, &um, sizeof(um)) != sizeof(um)) {
+                _exit(1);
+            }
+            inicioBusca = i + 1;
+            break;
+        }
+    }
+}
+
+void AvaliadorProcessos::sinalizarTrabalho(int quantidade) {
+    uint64_t valor = quantidade;
+    if (write(eventoTrabalho, &valor, sizeof(valor)) != sizeof(valor)) {
+        throw std::runtime_error("Erro ao sinalizar trabalhadores");
+    }
+}
+
+void AvaliadorProcessos::recuperarTrabalhador(pid_t pid, std::vector<Rede>& redes,
+                                              int& concluidos) {
+    // Reenviar o genoma que estava com o trabalhador; os bytes continuam no slot
+    int reenviados = 0;
+    for (int i = 0; i < cabecalho()->numSlots; i++) {
+        Slot* s = slot(i);
+        if (s->estado.load() != static_cast<int>(pid)) continue;
+
+        s->inicioNs.store(0);
+        s->tentativas++;
+        if (s->tentativas > config.maxTentativas) {
+            std::wcout << L"Genoma " << s->indice << L" descartado após "
+                       << s->tentativas << L" tentativas" << std::endl;
+            redes[s->indice].definirAptidao(config.aptidaoFalha);
+            s->estado.store(SLOT_LIVRE);
+            concluidos++;
+        } else {
+            s->estado.store(SLOT_PRONTO, std::memory_order_release);
+            reenviados++;
+        }
+    }
+
+    for (size_t i = 0; i < trabalhadores.size(); i++) {
+        if (trabalhadores[i] == pid) {
+            reinicios++;
+            iniciarTrabalhador(static_cast<int>(i));
+            break;
+        }
+    }
+
+    // Um sinal extra cobre o caso de o trabalhador ter morrido entre o read e o CAS
+    sinalizarTrabalho(reenviados + 1);
+}
+
+void AvaliadorProcessos::verificarTemposLimite() {
+    if (config.tempoLimiteMs <= 0) return;
+
+    long long limite = static_cast<long long>(config.tempoLimiteMs) * 1000000LL;
+    long long agora = agoraNs();
+    for (int i = 0; i < cabecalho()->numSlots; i++) {
+        Slot* s = slot(i);
+        int dono = s->estado.load();
+        long long inicio = s->inicioNs.load();
+        if (dono > 0 && inicio != 0 && agora - inicio > limite) {
+            std::wcout << L"Tempo esgotado no genoma " << s->indice
+                       << L", reiniciando trabalhador " << dono << std::endl;
+            kill(static_cast<pid_t>(dono), SIGKILL);
+            s->inicioNs.store(0);
+            temposEsgotados++;
+        }
+    }
+}
+
+void AvaliadorProcessos::avaliar(std::vector<Rede>& redes) {
+    int total = static_cast<int>(redes.size());
+    for (const auto& rede : redes) {
+        if (rede.tamanhoSerializado() > config.tamanhoMaximoGenoma) {
+            throw std::runtime_error("Genoma maior que o slot de memória compartilhada");
+        }
+    }
+
+    Cabecalho* cab = cabecalho();
+    int proximo = 0;
+    int concluidos = 0;
+
+    while (concluidos < total) {
+        // Serializar genomas pendentes direto nos slots livres
+        int enviados = 0;
+        for (int i = 0; i < cab->numSlots && proximo < total; i++) {
+            Slot* s = slot(i);
+            if (s->estado.load(std::memory_order_acquire) != SLOT_LIVRE) continue;
+
+            redes[proximo].serializar(dadosSlot(i));
+            s->indice = proximo;
+            s->tentativas = 0;
+            s->estado.store(SLOT_PRONTO, std::memory_order_release);
+            proximo++;
+            enviados++;
+        }
+        if (enviados > 0) {
+            sinalizarTrabalho(enviados);
+        }
+
+        // Aguardar resultados, acordando periodicamente para checar falhas
+        pollfd pfd = {eventoResultado, POLLIN, 0};
+        poll(&pfd, 1, 50);
+        if (pfd.revents & POLLIN) {
+            uint64_t valor;
+            if (read(eventoResultado, &valor, sizeof(valor)) < 0 && errno != EAGAIN) {
+                throw std::runtime_error("Erro ao ler resultados dos trabalhadores");
+            }
+        }
+
+        for (int i = 0; i < cab->numSlots; i++) {
+            Slot* s = slot(i);
+            if (s->estado.load(std::memory_order_acquire) != SLOT_CONCLUIDO) continue;
+
+            redes[s->indice].definirAptidao(s->aptidao);
+            s->estado.store(SLOT_LIVRE);
+            concluidos++;
+        }
+
+        verificarTemposLimite();
+
+        for (size_t i = 0; i < trabalhadores.size(); i++) {
+            pid_t pid = trabalhadores[i];
+            int status;
+            if (pid > 0 && waitpid(pid, &status, WNOHANG) == pid) {
+                std::wcout << L"Trabalhador " << pid << L" encerrou inesperadamente" << std::endl;
+                recuperarTrabalhador(pid, redes, concluidos);
+            }
+        }
+    }
+}
+
+void AvaliadorProcessos::encerrar() {
+    if (memoria) {
+        cabecalho()->encerrar.store(1);
+    }
+    for (pid_t pid : trabalhadores) {
+        if (pid > 0) {
+            kill(pid, SIGKILL);
+            waitpid(pid, nullptr, 0);
+        }
+    }
+    trabalhadores.clear();
+
+    if (eventoTrabalho >= 0) close(eventoTrabalho);
+    if (eventoResultado >= 0) close(eventoResultado);
+    eventoTrabalho = eventoResultado = -1;
+
+    if (memoria) {
+        munmap(memoria, tamanhoMemoria);
+        memoria = nullptr;
+    }
+}
+
+} // namespace NEAT
+
+#endif // __linux__
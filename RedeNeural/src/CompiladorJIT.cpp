@@ -0,0 +1,234 @@
+#include "../include/CompiladorJIT.h"
+#include "../include/ExportadorCodigo.h"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <cerrno>
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+#endif
+
+namespace NEAT {
+
+namespace {
+
+// Nome do símbolo em todas as bibliotecas geradas (cada uma carregada com RTLD_LOCAL)
+const char* SIMBOLO = "neat_avaliar";
+
+uint64_t calcularHashCodigo(const std::string& codigo) {
+    // FNV-1a sobre o código gerado: mesma estrutura e mesmos pesos, mesma função
+    uint64_t hash = 1469598103934665603ULL;
+    for (unsigned char c : codigo) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+#ifdef __linux__
+void adicionarPalavras(std::vector<std::string>& argumentos, const std::string& texto) {
+    std::istringstream palavras(texto);
+    std::string palavra;
+    while (palavras >> palavra) {
+        argumentos.push_back(palavra);
+    }
+}
+
+// Executa o programa sem shell e espera terminar; true se saiu com código 0.
+// Com 'silencioso', a saída padrão e a de erros vão para /dev/null.
+bool executar(const std::vector<std::string>& argumentos, bool silencioso) {
+    if (argumentos.empty()) return false;
+    std::vector<char*> argv;
+    for (const auto& argumento : argumentos) {
+        argv.push_back(const_cast<char*>(argumento.c_str()));
+    }
+    argv.push_back(nullptr);
+
+    posix_spawn_file_actions_t acoes;
+    posix_spawn_file_actions_init(&acoes);
+    if (silencioso) {
+        posix_spawn_file_actions_addopen(&acoes, 1, "/dev/null", O_WRONLY, 0);
+        posix_spawn_file_actions_adddup2(&acoes, 1, 2);
+    }
+    pid_t processo;
+    int erro = posix_spawnp(&processo, argv[0], &acoes, nullptr, argv.data(), environ);
+    posix_spawn_file_actions_destroy(&acoes);
+    if (erro != 0) return false;
+
+    int estado;
+    while (waitpid(processo, &estado, 0) < 0) {
+        if (errno != EINTR) return false;
+    }
+    return WIFEXITED(estado) && WEXITSTATUS(estado) == 0;
+}
+#endif
+
+} // namespace
+
+CompiladorJIT::CompiladorJIT(const Configuracao& config)
+    : config(config), disponivel(false), compilacoes(0), acertosCache(0), proximoArquivo(0) {
+}
+
+CompiladorJIT::~CompiladorJIT() {
+#ifdef __linux__
+    for (void* biblioteca : bibliotecas) {
+        dlclose(biblioteca);
+    }
+    // Os arquivos são apagados logo depois de carregados; sobra o diretório
+    if (!diretorioPrivado.empty()) {
+        rmdir(diretorioPrivado.c_str());
+    }
+#endif
+}
+
+bool CompiladorJIT::estaDisponivel() {
+#ifdef __linux__
+    std::call_once(verificacao, [this] {
+        std::vector<std::string> comando;
+        adicionarPalavras(comando, config.compilador);
+        comando.push_back("--version");
+        if (!executar(comando, true)) {
+            std::wcout << L"JIT indisponível: compilador não encontrado" << std::endl;
+            return;
+        }
+
+        // Diretório exclusivo deste processo (mkdtemp cria com modo 0700):
+        // ninguém mais consegue colocar ou trocar bibliotecas nele
+        std::string base = config.diretorio;
+        if (base.empty()) {
+            const char* tmpdir = std::getenv("TMPDIR");
+            base = tmpdir && *tmpdir ? tmpdir : "/tmp";
+        }
+        std::string modelo = base + "/neat_jit_XXXXXX";
+        if (!mkdtemp(&modelo[0])) {
+            std::wcout << L"JIT indisponível: não foi possível criar o diretório de trabalho" << std::endl;
+            return;
+        }
+        diretorioPrivado = modelo;
+        disponivel = true;
+    });
+    return disponivel;
+#else
+    return false;
+#endif
+}
+
+CompiladorJIT::FuncaoCompilada CompiladorJIT::compilar(const RedeEsparsa& rede) {
+#ifdef __linux__
+    // Redes recorrentes guardam estado entre chamadas: ficam no interpretador
+    if (rede.possuiRecorrencia() || !estaDisponivel()) return nullptr;
+
+    std::string codigo = ExportadorCodigo::gerar(rede, SIMBOLO, ExportadorCodigo::Linguagem::C);
+    uint64_t hash = calcularHashCodigo(codigo);
+
+    int numeroArquivo;
+    {
+        std::lock_guard<std::mutex> trava(mutex);
+        auto encontrado = cache.find(hash);
+        if (encontrado != cache.end()) {
+            acertosCache++;
+            return encontrado->second;
+        }
+        numeroArquivo = proximoArquivo++;
+    }
+
+    // Sem a trava: outras threads continuam usando o cache enquanto o
+    // compilador roda. Cada compilação usa seus próprios arquivos.
+    std::string base = diretorioPrivado + "/genoma_" + std::to_string(numeroArquivo);
+    std::string arquivoFonte = base + ".c";
+    std::string arquivoBiblioteca = base + ".so";
+    {
+        std::ofstream out(arquivoFonte);
+        if (!out) {
+            std::wcout << L"JIT: erro ao escrever o código gerado" << std::endl;
+            return nullptr;
+        }
+        out << codigo;
+    }
+
+    std::vector<std::string> comando;
+    adicionarPalavras(comando, config.compilador);
+    adicionarPalavras(comando, config.opcoes);
+    for (const char* argumento : {"-shared", "-fPIC", "-o"}) {
+        comando.push_back(argumento);
+    }
+    comando.push_back(arquivoBiblioteca);
+    comando.push_back(arquivoFonte);
+    comando.push_back("-lm");
+    bool compilou = executar(comando, false);
+    std::remove(arquivoFonte.c_str());
+
+    void* biblioteca = compilou ? dlopen(arquivoBiblioteca.c_str(), RTLD_NOW | RTLD_LOCAL) : nullptr;
+    // A biblioteca carregada continua válida sem o arquivo
+    std::remove(arquivoBiblioteca.c_str());
+    if (!biblioteca) {
+        std::wcout << (compilou ? L"JIT: falha ao carregar a biblioteca gerada"
+                                : L"JIT: falha ao compilar o genoma") << std::endl;
+        return nullptr;
+    }
+    auto funcao = reinterpret_cast<FuncaoCompilada>(dlsym(biblioteca, SIMBOLO));
+    if (!funcao) {
+        dlclose(biblioteca);
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> trava(mutex);
+    compilacoes++;
+    // Outra thread pode ter compilado o mesmo código enquanto isso
+    auto [posicao, inserido] = cache.emplace(hash, funcao);
+    if (!inserido) {
+        dlclose(biblioteca);
+        return posicao->second;
+    }
+    bibliotecas.push_back(biblioteca);
+    return funcao;
+#else
+    (void)rede;
+    return nullptr;
+#endif
+}
+
+AvaliadorJIT::AvaliadorJIT(CompiladorJIT& compilador, const Rede& rede, long long chamadasPrevistas)
+    : compilador(compilador), interpretador(rede), funcao(nullptr), chamadas(0),
+      tentouCompilar(false), saidas(interpretador.obterNumSaidas(), 0.0f) {
+    if (chamadasPrevistas >= compilador.obterChamadasMinimas()) {
+        tentarCompilar();
+    }
+}
+
+void AvaliadorJIT::tentarCompilar() {
+    tentouCompilar = true;
+    funcao = compilador.compilar(interpretador);
+}
+
+void AvaliadorJIT::avaliar(const float* entradas, float* destinoSaidas) {
+    chamadas++;
+    if (funcao) {
+        funcao(entradas, destinoSaidas);
+        return;
+    }
+    if (!tentouCompilar && chamadas >= compilador.obterChamadasMinimas()) {
+        tentarCompilar();
+    }
+    interpretador.avaliar(entradas, destinoSaidas);
+}
+
+const std::vector<float>& AvaliadorJIT::avaliar(const std::vector<float>& entradas) {
+    if (entradas.size() < static_cast<size_t>(interpretador.obterNumEntradas())) {
+        throw std::runtime_error("Número de entradas menor que o da rede");
+    }
+    avaliar(entradas.data(), saidas.data());
+    return saidas;
+}
+
+} // namespace NEAT
@@ -0,0 +1,63 @@
+#include "../include/ContextoAvaliacao.h"
+
+namespace NEAT {
+
+ContextoAvaliacao::ContextoAvaliacao(int orcamentoPassos, double orcamentoSegundos)
+    : cancelado(false), cortado(false), passos(0),
+      orcamentoPassos(orcamentoPassos), orcamentoSegundos(orcamentoSegundos),
+      inicio(std::chrono::steady_clock::now()), aptidaoParcial(0),
+      possuiCorte(false), corte(0), ganhoMaximoPorPasso(0) {
+}
+
+void ContextoAvaliacao::reiniciar() {
+    cancelado.store(false);
+    cortado = false;
+    passos = 0;
+    aptidaoParcial = 0;
+    inicio = std::chrono::steady_clock::now();
+}
+
+void ContextoAvaliacao::definirOrcamento(int novosPassos, double segundos) {
+    orcamentoPassos = novosPassos;
+    orcamentoSegundos = segundos;
+}
+
+void ContextoAvaliacao::definirCorte(float valorCorte, float ganhoMaximo) {
+    possuiCorte = true;
+    corte = valorCorte;
+    ganhoMaximoPorPasso = ganhoMaximo;
+}
+
+double ContextoAvaliacao::obterSegundosDecorridos() const {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+}
+
+bool ContextoAvaliacao::passo(float aptidaoAtual) {
+    passos++;
+    aptidaoParcial = aptidaoAtual;
+    
+    if (cancelado.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    if (orcamentoPassos > 0 && passos >= orcamentoPassos) {
+        return false;
+    }
+    // Consultar o relógio a cada 64 passos para não pesar no laço da simulação
+    if (orcamentoSegundos > 0 && (passos & 63) == 0 &&
+        obterSegundosDecorridos() > orcamentoSegundos) {
+        return false;
+    }
+    
+    // Limite superior: tudo o que ainda pode ser ganho nos passos restantes
+    if (possuiCorte && orcamentoPassos > 0) {
+        float limiteSuperior = aptidaoParcial + ganhoMaximoPorPasso * (orcamentoPassos - passos);
+        if (limiteSuperior < corte) {
+            cortado = true;
+            cancelar();
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace NEAT
@@ -1,86 +1,74 @@
-#include "../include/Especie.h"
-#include "../include/Configuracao.h"
-#include <cmath>
-
-namespace NEAT {
-
-Especie::Especie(const Rede& primeiro) 
-    : representante(primeiro), 
-      aptidaoAjustada(0), 
-      geracoesSemMelhoria(0), 
-      melhorAptidao(0) {
-}
-
-void Especie::adicionarMembro(Rede* rede) {
-    membros.push_back(rede);
-}
-
-void Especie::calcularAptidaoAjustada() {
-    if (membros.empty()) return;
-    
-    aptidaoAjustada = 0;
-    for (auto membro : membros) {
-        aptidaoAjustada += membro->obterAptidao();
-    }
-    aptidaoAjustada /= membros.size();
-    
-    // Atualizar melhor aptidão
-    float melhorAtual = membros[0]->obterAptidao();
-    for (size_t i = 1; i < membros.size(); i++) {
-        melhorAtual = std::max(melhorAtual, membros[i]->obterAptidao());
-    }
-    
-    if (melhorAtual > melhorAptidao) {
-        melhorAptidao = melhorAtual;
-        geracoesSemMelhoria = 0;
-    } else {
-        geracoesSemMelhoria++;
-    }
-}
-
-bool Especie::verificarCompatibilidade(const Rede& rede) const {
-    const auto& conexoesA = representante.obterConexoes();
-    const auto& conexoesB = rede.obterConexoes();
-    
-    int disjuntos = 0;
-    int excessos = 0;
-    float somaDiferencasPesos = 0.0f;
-    int coincidentes = 0;
-    
-    size_t i = 0, j = 0;
-    while (i < conexoesA.size() && j < conexoesB.size()) {
-        if (conexoesA[i].inovacao == conexoesB[j].inovacao) {
-            somaDiferencasPesos += std::abs(conexoesA[i].peso - conexoesB[j].peso);
-            coincidentes++;
-            i++;
-            j++;
-        } else if (conexoesA[i].inovacao < conexoesB[j].inovacao) {
-            disjuntos++;
-            i++;
-        } else {
-            disjuntos++;
-            j++;
-        }
-    }
-    
-    // Genes excedentes
-    excessos = (conexoesA.size() - i) + (conexoesB.size() - j);
-    
-    // Normalização
-    float N = std::max(conexoesA.size(), conexoesB.size());
-    if (N < 20) N = 1;
-    
-    float diferencaMedia = coincidentes > 0 ? somaDiferencasPesos / coincidentes : 0;
-    
-    // Cálculo de compatibilidade com pesos ajustados
-    float compatibilidade = (
-        NEAT::ConfiguracaoNEAT::COEF_EXCESSO * excessos / N +
-        NEAT::ConfiguracaoNEAT::COEF_DISJUNTO * disjuntos / N +
-        NEAT::ConfiguracaoNEAT::COEF_PESO * diferencaMedia
-    );
-    
-    // Usar o limiar de compatibilidade da configuração
-    return compatibilidade < 1.0f;
-}
-
-} // namespace NEAT 
\ No newline at end of file
+#include "../include/Especie.h"
+#include <algorithm>
+#include <cmath>
+
+namespace NEAT {
+
+Especie::Especie(int id, const Rede& primeiro) 
+    : id(id),
+      aptidaoAjustada(0), 
+      geracoesSemMelhoria(0), 
+      melhorAptidao(0) {
+    definirRepresentante(primeiro);
+}
+
+void Especie::adicionarMembro(int indice) {
+    membros.push_back(indice);
+}
+
+void Especie::definirRepresentante(const Rede& rede) {
+    representante = rede.obterGenomaCompacto();
+}
+
+void Especie::calcularAptidaoAjustada(const std::vector<Rede>& individuos) {
+    if (membros.empty()) return;
+    
+    aptidaoAjustada = 0;
+    for (int membro : membros) {
+        aptidaoAjustada += individuos[membro].obterAptidaoSelecao();
+    }
+    aptidaoAjustada /= membros.size();
+    
+    // Estagnação pela aptidão medida, comparável entre gerações (a de seleção
+    // no modo multiobjetivo é uma posição relativa à geração)
+    float melhorAtual = individuos[membros[0]].obterAptidao();
+    for (size_t i = 1; i < membros.size(); i++) {
+        melhorAtual = std::max(melhorAtual, individuos[membros[i]].obterAptidao());
+    }
+    
+    if (melhorAtual > melhorAptidao) {
+        melhorAptidao = melhorAtual;
+        geracoesSemMelhoria = 0;
+    } else {
+        geracoesSemMelhoria++;
+    }
+}
+
+float Especie::calcularDistancia(const Rede& rede, const ConfiguracaoNEAT& config) const {
+    return calcularDistancia(representante, rede.obterGenomaCompacto(), config);
+}
+
+float Especie::calcularDistancia(const GenomaCompacto& a, const GenomaCompacto& b,
+                                 const ConfiguracaoNEAT& config) {
+    GenomaCompacto::Distancia termos = GenomaCompacto::comparar(a, b);
+    
+    // Normalização
+    float N = std::max(a.tamanho(), b.tamanho());
+    if (N < 20) N = 1;
+    
+    float diferencaMedia = termos.coincidentes > 0 ? termos.somaDiferencasPesos / termos.coincidentes : 0;
+    
+    // Cálculo de compatibilidade com pesos ajustados
+    return (
+        config.COEF_EXCESSO * termos.excessos / N +
+        config.COEF_DISJUNTO * termos.disjuntos / N +
+        config.COEF_PESO * diferencaMedia
+    );
+}
+
+bool Especie::verificarCompatibilidade(const Rede& rede, const ConfiguracaoNEAT& config,
+                                       float limiar) const {
+    return calcularDistancia(rede, config) < limiar;
+}
+
+} // namespace NEAT
@@ -0,0 +1,82 @@
+#include "../include/ExecutorVarredura.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace NEAT {
+
+ExecutorVarredura::ExecutorVarredura(int numThreads)
+    : numThreads(numThreads > 0 ? numThreads : std::max(1u, std::thread::hardware_concurrency())) {
+}
+
+std::vector<ExecutorVarredura::Resultado> ExecutorVarredura::executar(
+    const std::vector<Experimento>& experimentos, FuncaoAvaliacao funcaoAvaliacao) {
+    
+    std::vector<Resultado> resultados(experimentos.size());
+    std::atomic<size_t> proximo(0);
+    std::mutex mutexLog;
+    
+    auto trabalhar = [&]() {
+        for (size_t e = proximo.fetch_add(1); e < experimentos.size(); e = proximo.fetch_add(1)) {
+            const Experimento& experimento = experimentos[e];
+            Resultado& resultado = resultados[e];
+            resultado.nome = experimento.nome;
+            resultado.melhorAptidao = 0.0f;
+            resultado.geracoes = 0;
+            
+            auto inicio = std::chrono::steady_clock::now();
+            try {
+                Populacao::Configuracao config = experimento.config;
+                config.threadsReproducao = 1;
+                config.logDetalhado = false;
+                Populacao populacao(experimento.numEntradas, experimento.numSaidas, config);
+                
+                // A última geração é só avaliada, para escolher o campeão
+                for (int g = 0; g < experimento.geracoes; g++) {
+                    populacao.avaliarPopulacao(funcaoAvaliacao);
+                    resultado.geracoes = g + 1;
+                    if (g + 1 < experimento.geracoes) {
+                        populacao.evoluir();
+                    }
+                }
+                
+                const auto& individuos = populacao.obterIndividuos();
+                if (!individuos.empty()) {
+                    auto melhor = std::max_element(individuos.begin(), individuos.end(),
+                        [](const Rede& a, const Rede& b) {
+                            return a.obterAptidao() < b.obterAptidao();
+                        });
+                    resultado.melhorRede = *melhor;
+                }
+                resultado.melhorAptidao = std::max(populacao.obterMelhorAptidao(),
+                                                   resultado.melhorRede.obterAptidao());
+            } catch (const std::exception& erro) {
+                resultado.erro = erro.what();
+            }
+            resultado.segundos = std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - inicio).count();
+            
+            std::lock_guard<std::mutex> trava(mutexLog);
+            std::wcout << L"Varredura: " << experimento.nome.c_str() << L" concluído em "
+                       << resultado.segundos << L" s, melhor aptidão " << resultado.melhorAptidao
+                       << (resultado.erro.empty() ? L"" : L" (com erro)") << std::endl;
+        }
+    };
+    
+    int totalThreads = std::min(numThreads, static_cast<int>(experimentos.size()));
+    std::vector<std::thread> threads;
+    for (int t = 1; t < totalThreads; t++) {
+        threads.emplace_back(trabalhar);
+    }
+    trabalhar();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return resultados;
+}
+
+} // namespace NEAT
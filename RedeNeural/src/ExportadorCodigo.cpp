@@ -0,0 +1,180 @@
+#include "../include/ExportadorCodigo.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace NEAT {
+
+namespace {
+
+// Literal float que reproduz exatamente o valor (9 dígitos significativos).
+// NaN e infinitos usam as macros de <math.h>/<cmath>, válidas em C e C++.
+std::string literal(float valor) {
+    if (std::isnan(valor)) return "NAN";
+    if (std::isinf(valor)) return valor > 0 ? "INFINITY" : "(-INFINITY)";
+    char texto[32];
+    std::snprintf(texto, sizeof(texto), "%.9g", valor);
+    std::string resultado(texto);
+    if (resultado.find_first_of(".eE") == std::string::npos) {
+        resultado += ".0";
+    }
+    return resultado + "f";
+}
+
+void validarNome(const std::string& nome) {
+    bool valido = !nome.empty() && !std::isdigit(static_cast<unsigned char>(nome[0]));
+    for (char c : nome) {
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_') valido = false;
+    }
+    if (!valido) {
+        throw std::runtime_error("Nome inválido para o código gerado: " + nome);
+    }
+}
+
+// Funções de ativação do código gerado: as mesmas contas de Ativacoes.cpp
+// (saturação, exp por 2^i * polinômio) na mesma ordem, então o resultado é o
+// de Rede::avaliar. 'cpp' escolhe inline/std:: ou static inline.
+std::string funcoesAtivacao(bool cpp) {
+    const std::string prefixo = cpp ? "inline" : "static inline";
+    const std::string std_ = cpp ? "std::" : "";
+    std::ostringstream codigo;
+    codigo << prefixo << " float neat_saturar(float x, float limite) {\n"
+           << "    float y = -limite < x ? x : -limite;\n"
+           << "    return y < limite ? y : limite;\n"
+           << "}\n"
+           << prefixo << " float neat_exp(float x) {\n"
+           << "    float t = x * 1.44269504f;\n"
+           << "    float m = t + 12582912.0f;\n"
+           << "    " << std_ << "int32_t inteiro;\n"
+           << "    " << std_ << "memcpy(&inteiro, &m, sizeof(inteiro));\n"
+           << "    inteiro -= 0x4B400000;\n"
+           << "    float f = t - (m - 12582912.0f);\n"
+           << "    float p = 1.54035304e-4f;\n"
+           << "    p = p * f + 1.33335581e-3f;\n"
+           << "    p = p * f + 9.61812911e-3f;\n"
+           << "    p = p * f + 5.55041087e-2f;\n"
+           << "    p = p * f + 2.40226507e-1f;\n"
+           << "    p = p * f + 6.93147181e-1f;\n"
+           << "    p = p * f + 1.0f;\n"
+           << "    " << std_ << "int32_t bits;\n"
+           << "    " << std_ << "memcpy(&bits, &p, sizeof(bits));\n"
+           << "    bits += inteiro * (1 << 23);\n"
+           << "    float resultado;\n"
+           << "    " << std_ << "memcpy(&resultado, &bits, sizeof(resultado));\n"
+           << "    return resultado;\n"
+           << "}\n"
+           << prefixo << " float neat_sigmoide(float x) { return 1.0f / (1.0f + neat_exp(-neat_saturar(x, 80.0f))); }\n"
+           << prefixo << " float neat_tanh(float x) { return 2.0f / (1.0f + neat_exp(-2.0f * neat_saturar(x, 40.0f))) - 1.0f; }\n"
+           << prefixo << " float neat_relu(float x) { return 0.0f < x ? x : 0.0f; }\n"
+           << prefixo << " float neat_degrau(float x) { return x > 0.0f ? 1.0f : 0.0f; }\n"
+           << prefixo << " float neat_gaussiana(float x) { x = neat_saturar(x, 9.0f); return neat_exp(-x * x); }\n\n";
+    return codigo.str();
+}
+
+// Expressão da ativação aplicada à soma, com as funções de funcoesAtivacao()
+std::string aplicarAtivacaoTexto(TipoAtivacao tipo, const std::string& soma) {
+    switch (tipo) {
+        case TipoAtivacao::SIGMOIDE: return "neat_sigmoide(" + soma + ")";
+        case TipoAtivacao::TANH: return "neat_tanh(" + soma + ")";
+        case TipoAtivacao::RELU: return "neat_relu(" + soma + ")";
+        case TipoAtivacao::DEGRAU: return "neat_degrau(" + soma + ")";
+        case TipoAtivacao::GAUSSIANA: return "neat_gaussiana(" + soma + ")";
+        default: return soma;
+    }
+}
+
+} // namespace
+
+std::string ExportadorCodigo::gerar(const RedeEsparsa& rede, const std::string& nome,
+                                    Linguagem linguagem) {
+    validarNome(nome);
+    if (rede.possuiRecorrencia()) {
+        throw std::runtime_error("Rede com conexões recorrentes não pode ser exportada");
+    }
+    const bool cpp = linguagem == Linguagem::CPP;
+    const int numEntradas = rede.obterNumEntradas();
+    const auto& saidas = rede.obterPosicoesSaida();
+    const auto& inicioGrupo = rede.obterInicioGrupo();
+    const auto& ativacaoGrupo = rede.obterAtivacaoGrupo();
+    const auto& inicioLinha = rede.obterInicioLinha();
+    const auto& colunas = rede.obterColunas();
+    const auto& pesos = rede.obterPesos();
+    const auto& bias = rede.obterBias();
+    const std::string arrayPesos = cpp ? "PESOS" : nome + "_pesos";
+
+    std::ostringstream codigo;
+    codigo << "// Gerado por NEAT::ExportadorCodigo: " << numEntradas << " entradas, "
+           << saidas.size() << " saídas, " << pesos.size() << " conexões\n";
+    if (cpp) {
+        codigo << "#pragma once\n#include <cmath>\n#include <cstdint>\n#include <cstring>\n\nnamespace " << nome << " {\n\n"
+               << "constexpr int NUM_ENTRADAS = " << numEntradas << ";\n"
+               << "constexpr int NUM_SAIDAS = " << saidas.size() << ";\n"
+               << "constexpr float PESOS[" << std::max<size_t>(1, pesos.size()) << "] = {";
+    } else {
+        codigo << "#include <math.h>\n#include <stdint.h>\n#include <string.h>\n\n"
+               << "static const float " << arrayPesos << "[" << std::max<size_t>(1, pesos.size()) << "] = {";
+    }
+    for (size_t k = 0; k < pesos.size(); k++) {
+        codigo << (k % 6 == 0 ? "\n    " : " ") << literal(pesos[k]) << (k + 1 < pesos.size() ? "," : "");
+    }
+    if (pesos.empty()) codigo << "0.0f";
+    codigo << "\n};\n\n" << funcoesAtivacao(cpp);
+
+    codigo << (cpp ? "inline void avaliar" : "void " + nome)
+           << "(const float* entradas, float* saidas) {\n";
+
+    // Variáveis nP por posição do plano; só as lidas por alguém são geradas
+    std::vector<bool> usado(rede.obterNumPosicoes(), false);
+    for (int coluna : colunas) usado[coluna] = true;
+    for (int saida : saidas) usado[saida] = true;
+
+    for (int p = 0; p < numEntradas; p++) {
+        if (usado[p]) codigo << "    const float n" << p << " = entradas[" << p << "];\n";
+    }
+
+    // Uma linha por nó calculado, nível a nível: bias + soma, depois a ativação
+    for (size_t g = 0; g + 1 < inicioGrupo.size(); g++) {
+        for (int linha = inicioGrupo[g]; linha < inicioGrupo[g + 1]; linha++) {
+            const int posicao = numEntradas + linha;
+            if (!usado[posicao]) continue;
+
+            // Mesma ordem de RedeEsparsa::avaliar: bias primeiro, depois cada conexão
+            std::ostringstream soma;
+            soma << literal(bias[linha]);
+            for (int k = inicioLinha[linha]; k < inicioLinha[linha + 1]; k++) {
+                soma << " + " << arrayPesos << "[" << k << "] * n" << colunas[k];
+            }
+            codigo << "    const float n" << posicao << " = "
+                   << aplicarAtivacaoTexto(ativacaoGrupo[g], soma.str()) << ";\n";
+        }
+    }
+
+    for (size_t i = 0; i < saidas.size(); i++) {
+        codigo << "    saidas[" << i << "] = n" << saidas[i] << ";\n";
+    }
+    codigo << "}\n";
+    if (cpp) {
+        codigo << "\n} // namespace " << nome << "\n";
+    }
+    return codigo.str();
+}
+
+std::string ExportadorCodigo::gerar(const Rede& rede, const std::string& nome,
+                                    Linguagem linguagem) {
+    return gerar(RedeEsparsa(rede), nome, linguagem);
+}
+
+void ExportadorCodigo::exportar(const Rede& rede, const std::string& arquivo,
+                                const std::string& nome) {
+    std::ofstream out(arquivo);
+    if (!out) {
+        throw std::runtime_error("Erro ao abrir arquivo para escrita: " + arquivo);
+    }
+    out << gerar(rede, nome, Linguagem::CPP);
+}
+
+} // namespace NEAT
@@ -0,0 +1,182 @@
+#include "../include/GenomaCompacto.h"
+#include <algorithm>
+#include <bitset>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <numeric>
+
+namespace NEAT {
+
+GenomaCompacto::GenomaCompacto() : idsCompactos(true) {
+}
+
+GenomaCompacto::GenomaCompacto(const std::vector<Conexao>& conexoes) : idsCompactos(true) {
+    // Ordem por inovação, com as pendentes (negativas) no fim
+    auto chave = [](int inovacao) { return inovacao < 0 ? static_cast<long long>(INT_MAX) + 1 : inovacao; };
+    std::vector<int> ordem(conexoes.size());
+    std::iota(ordem.begin(), ordem.end(), 0);
+    std::stable_sort(ordem.begin(), ordem.end(), [&](int a, int b) {
+        return chave(conexoes[a].inovacao) < chave(conexoes[b].inovacao);
+    });
+
+    for (int indice : ordem) {
+        const Conexao& conexao = conexoes[indice];
+        anexar(conexao.inovacao, conexao.deNo, conexao.paraNo, conexao.peso, conexao.ativo);
+    }
+}
+
+void GenomaCompacto::limpar() {
+    inovacoes.clear();
+    de16.clear();
+    para16.clear();
+    de32.clear();
+    para32.clear();
+    pesos.clear();
+    bitsAtivos.clear();
+    idsCompactos = true;
+}
+
+void GenomaCompacto::adicionar(int inovacao, int deNo, int paraNo, float peso, bool ativo) {
+    const int n = tamanho();
+    if (inovacao >= 0 && n > 0 && (inovacoes.back() < 0 || inovacoes.back() > inovacao)) {
+        std::vector<Conexao> conexoes = paraConexoes();
+        conexoes.push_back({deNo, paraNo, peso, ativo, inovacao});
+        *this = GenomaCompacto(conexoes);
+        return;
+    }
+    anexar(inovacao, deNo, paraNo, peso, ativo);
+}
+
+void GenomaCompacto::anexar(int inovacao, int deNo, int paraNo, float peso, bool ativo) {
+    // Primeiro id que não cabe em 16 bits: passar as colunas para 32 bits
+    if (idsCompactos && (deNo < 0 || deNo > 0xFFFF || paraNo < 0 || paraNo > 0xFFFF)) {
+        for (uint16_t id : de16) de32.push_back(id);
+        for (uint16_t id : para16) para32.push_back(id);
+        de16.clear();
+        para16.clear();
+        idsCompactos = false;
+    }
+
+    const int i = tamanho();
+    inovacoes.push_back(inovacao);
+    if (idsCompactos) {
+        de16.push_back(static_cast<uint16_t>(deNo));
+        para16.push_back(static_cast<uint16_t>(paraNo));
+    } else {
+        de32.push_back(deNo);
+        para32.push_back(paraNo);
+    }
+    pesos.push_back(peso);
+    if ((i & 63) == 0) bitsAtivos.push_back(0);
+    definirAtivo(i, ativo);
+}
+
+void GenomaCompacto::truncar(int quantidade) {
+    inovacoes.truncar(quantidade);
+    if (idsCompactos) {
+        de16.truncar(quantidade);
+        para16.truncar(quantidade);
+    } else {
+        de32.truncar(quantidade);
+        para32.truncar(quantidade);
+    }
+    pesos.truncar(quantidade);
+    bitsAtivos.truncar((quantidade + 63) / 64);
+    // Bits de conexões descartadas não podem contar como ativos
+    if (quantidade & 63) {
+        bitsAtivos.editar(quantidade >> 6) &= (uint64_t(1) << (quantidade & 63)) - 1;
+    }
+}
+
+void GenomaCompacto::definirAtivo(int i, bool novoAtivo) {
+    const uint64_t bit = uint64_t(1) << (i & 63);
+    if (ativo(i) == novoAtivo) return;
+    bitsAtivos.editar(i >> 6) ^= bit;
+}
+
+std::vector<Conexao> GenomaCompacto::paraConexoes() const {
+    std::vector<Conexao> conexoes;
+    paraConexoes(conexoes);
+    return conexoes;
+}
+
+void GenomaCompacto::paraConexoes(std::vector<Conexao>& conexoes) const {
+    conexoes.resize(tamanho());
+    for (int i = 0; i < tamanho(); i++) {
+        conexoes[i] = conexao(i);
+    }
+}
+
+int GenomaCompacto::contarAtivos() const {
+    int total = 0;
+    for (uint64_t palavra : bitsAtivos) {
+        total += static_cast<int>(std::bitset<64>(palavra).count());
+    }
+    return total;
+}
+
+size_t GenomaCompacto::bytesUsados() const {
+    return inovacoes.bytesTotais() + de16.bytesTotais() + para16.bytesTotais() +
+           de32.bytesTotais() + para32.bytesTotais() + pesos.bytesTotais() + bitsAtivos.bytesTotais();
+}
+
+size_t GenomaCompacto::bytesExclusivos() const {
+    return inovacoes.bytesExclusivos() + de16.bytesExclusivos() + para16.bytesExclusivos() +
+           de32.bytesExclusivos() + para32.bytesExclusivos() + pesos.bytesExclusivos() +
+           bitsAtivos.bytesExclusivos();
+}
+
+GenomaCompacto::Distancia GenomaCompacto::comparar(const GenomaCompacto& a, const GenomaCompacto& b) {
+    const int tamanhoA = a.tamanho();
+    const int tamanhoB = b.tamanho();
+
+    Distancia distancia = {0, 0, 0, 0.0f};
+    int i = 0, j = 0;
+    while (i < tamanhoA && j < tamanhoB) {
+        const int inovacaoA = a.inovacoes[i];
+        const int inovacaoB = b.inovacoes[j];
+        if (inovacaoA == inovacaoB) {
+            distancia.somaDiferencasPesos += std::abs(a.pesos[i] - b.pesos[j]);
+            distancia.coincidentes++;
+            i++;
+            j++;
+        } else if (inovacaoA < inovacaoB) {
+            distancia.disjuntos++;
+            i++;
+        } else {
+            distancia.disjuntos++;
+            j++;
+        }
+    }
+    distancia.excessos = (tamanhoA - i) + (tamanhoB - j);
+    return distancia;
+}
+
+GenomaCompacto GenomaCompacto::cruzar(const GenomaCompacto& estrutura, const GenomaCompacto& outro) {
+    std::mt19937 gerador(rand());
+    GenomaCompacto filho;
+    cruzar(estrutura, outro, gerador, filho);
+    return filho;
+}
+
+void GenomaCompacto::cruzar(const GenomaCompacto& estrutura, const GenomaCompacto& outro,
+                            std::mt19937& gerador, GenomaCompacto& filho) {
+    filho.limpar();
+
+    int j = 0;
+    for (int i = 0; i < estrutura.tamanho(); i++) {
+        const int inovacao = estrutura.inovacoes[i];
+        while (j < outro.tamanho() && outro.inovacoes[j] < inovacao) j++;
+
+        float peso = estrutura.pesos[i];
+        bool ativo = estrutura.ativo(i);
+        if (j < outro.tamanho() && outro.inovacoes[j] == inovacao) {
+            if (gerador() & 1u) peso = outro.pesos[j];
+            if (!ativo || !outro.ativo(j)) ativo = gerador() % 4 == 0;
+        }
+        filho.anexar(inovacao, estrutura.origem(i), estrutura.destino(i), peso, ativo);
+    }
+}
+
+} // namespace NEAT
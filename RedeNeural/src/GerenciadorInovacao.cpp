@@ -0,0 +1,18 @@
+#include "../include/GerenciadorInovacao.h"
+
+namespace NEAT {
+
+int GerenciadorInovacao::obterInovacao(int deNo, int paraNo) {
+    auto resultado = historicoInovacoes.emplace(std::make_pair(deNo, paraNo), proximaInovacao);
+    if (resultado.second) {
+        proximaInovacao++;
+    }
+    return resultado.first->second;
+}
+
+void GerenciadorInovacao::limpar() {
+    historicoInovacoes.clear();
+    proximaInovacao = 0;
+}
+
+} // namespace NEAT
@@ -0,0 +1,46 @@
+#include "../include/GravadorSnapshots.h"
+#include <chrono>
+#include <cstdio>
+
+namespace NEAT {
+
+GravadorSnapshots::GravadorSnapshots(BufferTriplo<SnapshotRede>& buffer, const std::string& prefixo,
+                                     int intervaloMs, const RasterizadorPNG::Configuracao& config)
+    : buffer(buffer), rasterizador(config), prefixo(prefixo), intervaloMs(intervaloMs),
+      executando(false), quadrosGravados(0) {
+}
+
+GravadorSnapshots::~GravadorSnapshots() {
+    parar();
+}
+
+void GravadorSnapshots::iniciar() {
+    if (executando.exchange(true)) return;
+    thread = std::thread(&GravadorSnapshots::loop, this);
+}
+
+void GravadorSnapshots::parar() {
+    executando.store(false);
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+void GravadorSnapshots::loop() {
+    while (executando.load()) {
+        if (buffer.atualizar()) {
+            const SnapshotRede& snapshot = buffer.obterLeitura();
+            rasterizador.desenhar(snapshot);
+            
+            char sufixo[32];
+            std::snprintf(sufixo, sizeof(sufixo), "_g%06d_%06d.png",
+                          snapshot.geracao, quadrosGravados.load());
+            if (rasterizador.salvar(prefixo + sufixo)) {
+                quadrosGravados++;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(intervaloMs));
+    }
+}
+
+} // namespace NEAT
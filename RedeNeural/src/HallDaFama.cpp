@@ -0,0 +1,350 @@
+#include "../include/HallDaFama.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace NEAT {
+
+namespace {
+
+// Versão 2: genomas no formato de Rede::salvar. A versão 1 guardava a cópia
+// direta de No (Rede::serializar), que mudou de layout, e é recusada.
+const char MAGICO_DADOS[8] = {'N', 'E', 'A', 'T', 'H', 'A', 'L', '2'};
+const char MAGICO_INDICE[8] = {'N', 'E', 'A', 'T', 'I', 'D', 'X', '1'};
+
+// Cabeçalho de cada genoma em 'arquivo': hash, aptidão, geração e tamanho
+const uint64_t TAMANHO_CABECALHO = sizeof(uint64_t) + sizeof(float) + sizeof(int32_t) + sizeof(uint32_t);
+
+inline void misturar(uint64_t& hash, const void* valor, size_t bytes) {
+    const unsigned char* p = static_cast<const unsigned char*>(valor);
+    for (size_t i = 0; i < bytes; i++) {
+        hash ^= p[i];
+        hash *= 1099511628211ull;
+    }
+}
+
+inline void misturarFloat(uint64_t& hash, float valor) {
+    if (valor == 0.0f) valor = 0.0f;  // -0 e +0 são a mesma rede
+    misturar(hash, &valor, sizeof(valor));
+}
+
+} // namespace
+
+HallDaFama::HallDaFama(const Configuracao& config)
+    : config(config), tamanhoDados(0), indiceAlterado(false) {
+    abrir();
+}
+
+HallDaFama::~HallDaFama() {
+    try {
+        sincronizar();
+    } catch (...) {
+        // O índice é refeito a partir dos dados na próxima abertura
+    }
+}
+
+void HallDaFama::abrir() {
+    {
+        std::ifstream existente(config.arquivo, std::ios::binary);
+        if (!existente) {
+            std::ofstream novo(config.arquivo, std::ios::binary);
+            if (!novo) {
+                throw std::runtime_error("Erro ao criar hall da fama: " + config.arquivo);
+            }
+            novo.write(MAGICO_DADOS, sizeof(MAGICO_DADOS));
+        } else {
+            char magico[sizeof(MAGICO_DADOS)];
+            if (!existente.read(magico, sizeof(magico)) ||
+                std::memcmp(magico, MAGICO_DADOS, sizeof(MAGICO_DADOS)) != 0) {
+                throw std::runtime_error("Hall da fama inválido ou de versão antiga: " + config.arquivo);
+            }
+        }
+    }
+
+    dados.open(config.arquivo, std::ios::binary | std::ios::in | std::ios::out);
+    if (!dados) {
+        throw std::runtime_error("Erro ao abrir hall da fama: " + config.arquivo);
+    }
+    dados.seekg(0, std::ios::end);
+    tamanhoDados = static_cast<uint64_t>(dados.tellg());
+
+    uint64_t dadosIndexados = sizeof(MAGICO_DADOS);
+    if (!lerIndice(dadosIndexados) || dadosIndexados > tamanhoDados) {
+        porAptidao.clear();
+        porHash.clear();
+        dadosIndexados = sizeof(MAGICO_DADOS);
+    }
+    if (dadosIndexados < tamanhoDados) {
+        uint64_t tamanhoArquivo = tamanhoDados;
+        recuperarRegistros(dadosIndexados);
+        if (tamanhoDados < tamanhoArquivo) {
+            // Descartar o registro incompleto, para não ser lido como genoma depois
+            dados.close();
+            std::filesystem::resize_file(config.arquivo, tamanhoDados);
+            dados.open(config.arquivo, std::ios::binary | std::ios::in | std::ios::out);
+            if (!dados) {
+                throw std::runtime_error("Erro ao abrir hall da fama: " + config.arquivo);
+            }
+        }
+    }
+}
+
+bool HallDaFama::lerIndice(uint64_t& dadosIndexados) {
+    std::ifstream in(config.arquivo + ".indice", std::ios::binary);
+    char magico[sizeof(MAGICO_INDICE)];
+    uint64_t numEntradas = 0;
+    if (!in.read(magico, sizeof(magico)) || std::memcmp(magico, MAGICO_INDICE, sizeof(MAGICO_INDICE)) != 0) return false;
+    if (!in.read(reinterpret_cast<char*>(&dadosIndexados), sizeof(dadosIndexados))) return false;
+    if (!in.read(reinterpret_cast<char*>(&numEntradas), sizeof(numEntradas))) return false;
+
+    for (uint64_t i = 0; i < numEntradas; i++) {
+        Entrada entrada;
+        int32_t geracao;
+        if (!in.read(reinterpret_cast<char*>(&entrada.hash), sizeof(entrada.hash)) ||
+            !in.read(reinterpret_cast<char*>(&entrada.aptidao), sizeof(entrada.aptidao)) ||
+            !in.read(reinterpret_cast<char*>(&geracao), sizeof(geracao)) ||
+            !in.read(reinterpret_cast<char*>(&entrada.deslocamento), sizeof(entrada.deslocamento)) ||
+            !in.read(reinterpret_cast<char*>(&entrada.tamanho), sizeof(entrada.tamanho))) {
+            return false;
+        }
+        entrada.geracao = geracao;
+        registrar(entrada);
+    }
+    return true;
+}
+
+// Percorre os genomas gravados a partir de 'inicio' e os indexa; um registro
+// truncado no fim (gravação interrompida) é descartado
+void HallDaFama::recuperarRegistros(uint64_t inicio) {
+    dados.clear();
+    dados.seekg(static_cast<std::streamoff>(inicio));
+    uint64_t posicao = inicio;
+    while (posicao + TAMANHO_CABECALHO <= tamanhoDados) {
+        Entrada entrada;
+        int32_t geracao;
+        dados.read(reinterpret_cast<char*>(&entrada.hash), sizeof(entrada.hash));
+        dados.read(reinterpret_cast<char*>(&entrada.aptidao), sizeof(entrada.aptidao));
+        dados.read(reinterpret_cast<char*>(&geracao), sizeof(geracao));
+        dados.read(reinterpret_cast<char*>(&entrada.tamanho), sizeof(entrada.tamanho));
+        if (!dados) break;
+        entrada.geracao = geracao;
+        entrada.deslocamento = posicao + TAMANHO_CABECALHO;
+        if (entrada.deslocamento + entrada.tamanho > tamanhoDados) break;
+
+        registrar(entrada);
+        posicao = entrada.deslocamento + entrada.tamanho;
+        dados.seekg(static_cast<std::streamoff>(posicao));
+    }
+    dados.clear();
+    tamanhoDados = posicao;
+    indiceAlterado = true;
+}
+
+// Insere no índice; se o hash já existe, fica a maior aptidão
+bool HallDaFama::registrar(const Entrada& entrada) {
+    auto existente = porHash.find(entrada.hash);
+    if (existente == porHash.end()) {
+        porHash[entrada.hash] = porAptidao.insert(entrada).first;
+        return true;
+    }
+
+    const Entrada& atual = *existente->second;
+    if (entrada.aptidao > atual.aptidao) {
+        Entrada atualizada = atual;
+        atualizada.aptidao = entrada.aptidao;
+        atualizada.geracao = entrada.geracao;
+        porAptidao.erase(existente->second);
+        existente->second = porAptidao.insert(atualizada).first;
+        indiceAlterado = true;
+    }
+    return false;
+}
+
+bool HallDaFama::adicionar(const Rede& rede, int geracao) {
+    Entrada entrada;
+    entrada.hash = calcularHash(rede);
+    entrada.aptidao = rede.obterAptidao();
+    entrada.geracao = geracao;
+
+    if (porHash.count(entrada.hash)) {
+        registrar(entrada);
+        return false;
+    }
+
+    std::ostringstream registro;
+    rede.salvar(registro);
+    const std::string genoma = registro.str();
+    entrada.tamanho = static_cast<uint32_t>(genoma.size());
+    entrada.deslocamento = tamanhoDados + TAMANHO_CABECALHO;
+
+    int32_t geracao32 = geracao;
+    dados.clear();
+    dados.seekp(static_cast<std::streamoff>(tamanhoDados));
+    dados.write(reinterpret_cast<const char*>(&entrada.hash), sizeof(entrada.hash));
+    dados.write(reinterpret_cast<const char*>(&entrada.aptidao), sizeof(entrada.aptidao));
+    dados.write(reinterpret_cast<const char*>(&geracao32), sizeof(geracao32));
+    dados.write(reinterpret_cast<const char*>(&entrada.tamanho), sizeof(entrada.tamanho));
+    dados.write(genoma.data(), genoma.size());
+    dados.flush();
+    if (!dados) {
+        throw std::runtime_error("Erro ao gravar no hall da fama: " + config.arquivo);
+    }
+
+    tamanhoDados = entrada.deslocamento + entrada.tamanho;
+    indiceAlterado = true;
+    return registrar(entrada);
+}
+
+int HallDaFama::adicionarGeracao(const std::vector<Rede>& individuos, int geracao) {
+    int quantidade = std::min(config.porGeracao, static_cast<int>(individuos.size()));
+    if (quantidade <= 0) return 0;
+
+    std::vector<int> indices(individuos.size());
+    for (size_t i = 0; i < indices.size(); i++) indices[i] = static_cast<int>(i);
+    std::partial_sort(indices.begin(), indices.begin() + quantidade, indices.end(),
+        [&individuos](int a, int b) {
+            return individuos[a].obterAptidao() > individuos[b].obterAptidao();
+        });
+
+    int novos = 0;
+    for (int i = 0; i < quantidade; i++) {
+        if (adicionar(individuos[indices[i]], geracao)) novos++;
+    }
+    return novos;
+}
+
+std::vector<HallDaFama::Entrada> HallDaFama::melhores(int k) const {
+    std::vector<Entrada> resultado;
+    resultado.reserve(std::min(static_cast<size_t>(std::max(k, 0)), porAptidao.size()));
+    for (auto it = porAptidao.begin(); it != porAptidao.end() && static_cast<int>(resultado.size()) < k; ++it) {
+        resultado.push_back(*it);
+    }
+    return resultado;
+}
+
+Rede HallDaFama::lerGenoma(const Entrada& entrada) {
+    dados.clear();
+    dados.seekg(static_cast<std::streamoff>(entrada.deslocamento));
+    Rede rede(0, 0);
+    rede.carregar(dados, config.arquivo);
+    // O genoma tem que ocupar exatamente o registro
+    if (static_cast<uint64_t>(dados.tellg()) != entrada.deslocamento + entrada.tamanho) {
+        throw std::runtime_error("Registro inválido no hall da fama: " + config.arquivo);
+    }
+    rede.definirAptidao(entrada.aptidao);
+    return rede;
+}
+
+Rede HallDaFama::carregar(const Entrada& entrada) {
+    return lerGenoma(entrada);
+}
+
+std::vector<Rede> HallDaFama::carregarMelhores(int k) {
+    std::vector<Rede> redes;
+    for (const auto& entrada : melhores(k)) {
+        redes.push_back(lerGenoma(entrada));
+    }
+    return redes;
+}
+
+bool HallDaFama::contem(const Rede& rede) const {
+    return porHash.count(calcularHash(rede)) > 0;
+}
+
+std::vector<HallDaFama::Entrada> HallDaFama::reavaliar(std::function<float(Rede&)> funcaoAvaliacao,
+                                                       int numThreads, int lote) {
+    // Lidos na ordem do arquivo, para que a leitura seja sequencial
+    std::vector<Entrada> entradas(porAptidao.begin(), porAptidao.end());
+    std::sort(entradas.begin(), entradas.end(),
+        [](const Entrada& a, const Entrada& b) { return a.deslocamento < b.deslocamento; });
+
+    if (numThreads <= 0) numThreads = std::max(1u, std::thread::hardware_concurrency());
+    lote = std::max(1, lote);
+
+    std::vector<Rede> redes;
+    for (size_t inicio = 0; inicio < entradas.size(); inicio += lote) {
+        size_t fim = std::min(entradas.size(), inicio + static_cast<size_t>(lote));
+        redes.clear();
+        for (size_t i = inicio; i < fim; i++) {
+            redes.push_back(lerGenoma(entradas[i]));
+        }
+
+        std::atomic<size_t> proximo(0);
+        auto trabalhar = [&]() {
+            for (size_t i = proximo.fetch_add(1); i < redes.size(); i = proximo.fetch_add(1)) {
+                entradas[inicio + i].aptidao = funcaoAvaliacao(redes[i]);
+            }
+        };
+        std::vector<std::thread> threads;
+        int totalThreads = std::min(numThreads, static_cast<int>(redes.size()));
+        for (int t = 1; t < totalThreads; t++) {
+            threads.emplace_back(trabalhar);
+        }
+        trabalhar();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    std::sort(entradas.begin(), entradas.end(), OrdemAptidao());
+    return entradas;
+}
+
+void HallDaFama::sincronizar() {
+    if (!indiceAlterado) return;
+
+    std::string temporario = config.arquivo + ".indice.tmp";
+    {
+        std::ofstream out(temporario, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            throw std::runtime_error("Erro ao gravar índice do hall da fama: " + temporario);
+        }
+        uint64_t numEntradas = porAptidao.size();
+        out.write(MAGICO_INDICE, sizeof(MAGICO_INDICE));
+        out.write(reinterpret_cast<const char*>(&tamanhoDados), sizeof(tamanhoDados));
+        out.write(reinterpret_cast<const char*>(&numEntradas), sizeof(numEntradas));
+        for (const auto& entrada : porAptidao) {
+            int32_t geracao = entrada.geracao;
+            out.write(reinterpret_cast<const char*>(&entrada.hash), sizeof(entrada.hash));
+            out.write(reinterpret_cast<const char*>(&entrada.aptidao), sizeof(entrada.aptidao));
+            out.write(reinterpret_cast<const char*>(&geracao), sizeof(geracao));
+            out.write(reinterpret_cast<const char*>(&entrada.deslocamento), sizeof(entrada.deslocamento));
+            out.write(reinterpret_cast<const char*>(&entrada.tamanho), sizeof(entrada.tamanho));
+        }
+        if (!out) {
+            throw std::runtime_error("Erro ao gravar índice do hall da fama: " + temporario);
+        }
+    }
+    if (std::rename(temporario.c_str(), (config.arquivo + ".indice").c_str()) != 0) {
+        throw std::runtime_error("Erro ao substituir índice do hall da fama: " + config.arquivo);
+    }
+    indiceAlterado = false;
+}
+
+uint64_t HallDaFama::calcularHash(const Rede& rede) {
+    uint64_t hash = 14695981039346656037ull;
+
+    for (const auto& no : rede.obterNos()) {
+        int32_t camada = no.camada;
+        int32_t ativacao = static_cast<int32_t>(no.ativacao);
+        misturar(hash, &camada, sizeof(camada));
+        misturar(hash, &ativacao, sizeof(ativacao));
+        misturarFloat(hash, no.bias);
+    }
+
+    const GenomaCompacto& genoma = rede.obterGenomaCompacto();
+    for (int i = 0; i < genoma.tamanho(); i++) {
+        if (!genoma.ativo(i)) continue;
+        int32_t extremos[2] = {genoma.origem(i), genoma.destino(i)};
+        misturar(hash, extremos, sizeof(extremos));
+        misturarFloat(hash, genoma.peso(i));
+    }
+    return hash;
+}
+
+} // namespace NEAT
@@ -0,0 +1,396 @@
+#include "../include/Metricas.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace NEAT {
+
+namespace {
+
+const char MAGICO[8] = {'N', 'E', 'A', 'T', 'M', 'E', 'T', '1'};
+
+void escreverCabecalho(std::ofstream& out, const std::vector<std::string>& colunas) {
+    out.write(MAGICO, sizeof(MAGICO));
+    uint32_t numColunas = static_cast<uint32_t>(colunas.size());
+    out.write(reinterpret_cast<const char*>(&numColunas), sizeof(numColunas));
+    for (const auto& nome : colunas) {
+        uint8_t tamanho = static_cast<uint8_t>(nome.size());
+        out.write(reinterpret_cast<const char*>(&tamanho), sizeof(tamanho));
+        out.write(nome.data(), tamanho);
+    }
+}
+
+// Retorna false se o arquivo não existir ou não for um log válido
+bool lerCabecalho(std::ifstream& in, std::vector<std::string>& colunas) {
+    char magico[sizeof(MAGICO)];
+    uint32_t numColunas = 0;
+    if (!in.read(magico, sizeof(magico)) || std::memcmp(magico, MAGICO, sizeof(MAGICO)) != 0) return false;
+    if (!in.read(reinterpret_cast<char*>(&numColunas), sizeof(numColunas))) return false;
+    colunas.clear();
+    for (uint32_t c = 0; c < numColunas; c++) {
+        uint8_t tamanho = 0;
+        if (!in.read(reinterpret_cast<char*>(&tamanho), sizeof(tamanho))) return false;
+        std::string nome(tamanho, '\0');
+        if (!in.read(&nome[0], tamanho)) return false;
+        colunas.push_back(nome);
+    }
+    return true;
+}
+
+// Posição logo após o último bloco completo, a partir do início dos blocos
+std::streamoff fimBlocosCompletos(std::ifstream& in, size_t numColunas) {
+    std::streamoff fim = in.tellg();
+    in.seekg(0, std::ios::end);
+    const std::streamoff tamanho = in.tellg();
+    in.seekg(fim);
+    uint32_t linhas = 0;
+    while (in.read(reinterpret_cast<char*>(&linhas), sizeof(linhas))) {
+        const std::streamoff proximo = fim + static_cast<std::streamoff>(sizeof(linhas)) +
+            static_cast<std::streamoff>(linhas) * static_cast<std::streamoff>(numColunas * sizeof(float));
+        if (proximo > tamanho) break;
+        fim = proximo;
+        in.seekg(fim);
+    }
+    return fim;
+}
+
+// Continua um log existente com as mesmas colunas; senão começa um novo. Um
+// bloco incompleto no fim (gravação interrompida) é descartado antes de
+// continuar, senão os blocos acrescentados depois dele ficariam desalinhados.
+void prepararArquivo(const std::string& arquivo, const std::vector<std::string>& colunas) {
+    std::vector<std::string> existentes;
+    std::streamoff fim = -1;
+    {
+        std::ifstream in(arquivo, std::ios::binary);
+        if (in && lerCabecalho(in, existentes) && existentes == colunas) {
+            fim = fimBlocosCompletos(in, colunas.size());
+        }
+    }
+    if (fim >= 0) {
+        if (static_cast<std::uintmax_t>(fim) < std::filesystem::file_size(arquivo)) {
+            std::filesystem::resize_file(arquivo, static_cast<std::uintmax_t>(fim));
+        }
+        return;
+    }
+    std::ofstream out(arquivo, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Erro ao criar log de métricas: " + arquivo);
+    }
+    escreverCabecalho(out, colunas);
+}
+
+// Um bloco: número de linhas e, em seguida, cada coluna inteira
+void gravarBloco(const std::string& arquivo, const std::vector<std::vector<float>>& colunas) {
+    std::ofstream out(arquivo, std::ios::binary | std::ios::app);
+    if (!out) {
+        std::wcout << L"Erro ao gravar métricas em " << arquivo.c_str() << std::endl;
+        return;
+    }
+    uint32_t linhas = colunas.empty() ? 0 : static_cast<uint32_t>(colunas[0].size());
+    out.write(reinterpret_cast<const char*>(&linhas), sizeof(linhas));
+    for (const auto& coluna : colunas) {
+        out.write(reinterpret_cast<const char*>(coluna.data()), linhas * sizeof(float));
+    }
+}
+
+} // namespace
+
+EstimadorQuantil::EstimadorQuantil(double p) : p(p), contagem(0) {
+    const double iniciais[5] = {1, 1 + 2 * p, 1 + 4 * p, 3 + 2 * p, 5};
+    const double passos[5] = {0, p / 2, p, (1 + p) / 2, 1};
+    for (int i = 0; i < 5; i++) {
+        alturas[i] = 0;
+        posicoes[i] = i + 1;
+        desejadas[i] = iniciais[i];
+        incrementos[i] = passos[i];
+    }
+}
+
+void EstimadorQuantil::adicionar(double valor) {
+    // As cinco primeiras amostras viram os marcadores iniciais
+    if (contagem < 5) {
+        alturas[contagem++] = valor;
+        if (contagem == 5) std::sort(alturas, alturas + 5);
+        return;
+    }
+    contagem++;
+
+    int k;
+    if (valor < alturas[0]) {
+        alturas[0] = valor;
+        k = 0;
+    } else if (valor >= alturas[4]) {
+        alturas[4] = valor;
+        k = 3;
+    } else {
+        k = 0;
+        while (valor >= alturas[k + 1]) k++;
+    }
+    for (int i = k + 1; i < 5; i++) posicoes[i]++;
+    for (int i = 0; i < 5; i++) desejadas[i] += incrementos[i];
+
+    // Ajustar os marcadores internos: parabólico, ou linear se sair da ordem
+    for (int i = 1; i < 4; i++) {
+        double d = desejadas[i] - posicoes[i];
+        if ((d >= 1 && posicoes[i + 1] - posicoes[i] > 1) ||
+            (d <= -1 && posicoes[i - 1] - posicoes[i] < -1)) {
+            int s = d > 0 ? 1 : -1;
+            double parabolico = alturas[i] + s / (posicoes[i + 1] - posicoes[i - 1]) *
+                ((posicoes[i] - posicoes[i - 1] + s) * (alturas[i + 1] - alturas[i]) / (posicoes[i + 1] - posicoes[i]) +
+                 (posicoes[i + 1] - posicoes[i] - s) * (alturas[i] - alturas[i - 1]) / (posicoes[i] - posicoes[i - 1]));
+            if (alturas[i - 1] < parabolico && parabolico < alturas[i + 1]) {
+                alturas[i] = parabolico;
+            } else {
+                alturas[i] += s * (alturas[i + s] - alturas[i]) / (posicoes[i + s] - posicoes[i]);
+            }
+            posicoes[i] += s;
+        }
+    }
+}
+
+double EstimadorQuantil::obter() const {
+    if (contagem == 0) return 0.0;
+    if (contagem >= 5) return alturas[2];
+
+    // Poucas amostras: quantil exato
+    std::vector<double> ordenadas(alturas, alturas + contagem);
+    std::sort(ordenadas.begin(), ordenadas.end());
+    int indice = static_cast<int>(std::round(p * (contagem - 1)));
+    return ordenadas[indice];
+}
+
+const std::vector<std::string>& RegistroMetricas::colunasGeracao() {
+    static const std::vector<std::string> colunas = {
+        "geracao", "individuos", "especies", "melhor", "media", "pior", "desvio",
+        "p10", "p50", "p90", "diversidade", "nosMedio", "conexoesAtivasMedio", "maxConexoesAtivas"
+    };
+    return colunas;
+}
+
+const std::vector<std::string>& RegistroMetricas::colunasEspecie() {
+    static const std::vector<std::string> colunas = {
+        "geracao", "especie", "membros", "melhor", "media", "aptidaoAjustada",
+        "conexoesAtivasMedio", "geracoesSemMelhoria"
+    };
+    return colunas;
+}
+
+RegistroMetricas::RegistroMetricas(const Configuracao& config)
+    : config(config), executando(true), linhasGravadas(0) {
+    prepararArquivo(config.arquivo, colunasGeracao());
+    prepararArquivo(config.arquivo + ".especies", colunasEspecie());
+    thread = std::thread(&RegistroMetricas::loop, this);
+}
+
+RegistroMetricas::~RegistroMetricas() {
+    parar();
+}
+
+void RegistroMetricas::parar() {
+    {
+        std::lock_guard<std::mutex> trava(mutex);
+        executando = false;
+    }
+    aviso.notify_one();
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+long long RegistroMetricas::obterLinhasGravadas() {
+    std::lock_guard<std::mutex> trava(mutex);
+    return linhasGravadas;
+}
+
+const MetricasGeracao& RegistroMetricas::registrar(int geracao, const std::vector<Rede>& individuos,
+                                                   const std::vector<int>& especieDosIndividuos,
+                                                   const std::vector<Especie>& especies,
+                                                   const ConfiguracaoNEAT& configNEAT) {
+    std::unordered_map<int, int> indiceEspecie;
+    for (size_t e = 0; e < especies.size(); e++) {
+        indiceEspecie[especies[e].obterId()] = static_cast<int>(e);
+    }
+
+    MetricasGeracao metricas = {};
+    metricas.geracao = geracao;
+    metricas.individuos = static_cast<int>(individuos.size());
+    metricas.especies = static_cast<int>(especies.size());
+    metricas.melhor = -std::numeric_limits<float>::infinity();
+    metricas.pior = std::numeric_limits<float>::infinity();
+
+    std::vector<MetricasEspecie> porEspecie(especies.size());
+    for (size_t e = 0; e < especies.size(); e++) {
+        porEspecie[e] = {geracao, especies[e].obterId(), 0, -std::numeric_limits<float>::infinity(),
+                         0.0f, especies[e].obterAptidaoAjustada(), 0.0f,
+                         especies[e].obterGeracoesSemMelhoria()};
+    }
+
+    // Uma passada: média e variância (Welford), quantis P² e acumuladores por espécie
+    EstimadorQuantil q10(0.1), q50(0.5), q90(0.9);
+    double media = 0, m2 = 0, somaNos = 0, somaAtivas = 0;
+    for (size_t i = 0; i < individuos.size(); i++) {
+        const Rede& individuo = individuos[i];
+        float aptidao = individuo.obterAptidao();
+        int ativas = individuo.obterGenomaCompacto().contarAtivos();
+
+        double delta = aptidao - media;
+        media += delta / (i + 1);
+        m2 += delta * (aptidao - media);
+        q10.adicionar(aptidao);
+        q50.adicionar(aptidao);
+        q90.adicionar(aptidao);
+        metricas.melhor = std::max(metricas.melhor, aptidao);
+        metricas.pior = std::min(metricas.pior, aptidao);
+        somaNos += individuo.obterNos().size();
+        somaAtivas += ativas;
+        metricas.maxConexoesAtivas = std::max(metricas.maxConexoesAtivas, static_cast<float>(ativas));
+
+        int idEspecie = i < especieDosIndividuos.size() ? especieDosIndividuos[i] : -1;
+        auto encontrada = indiceEspecie.find(idEspecie);
+        if (encontrada != indiceEspecie.end()) {
+            MetricasEspecie& especie = porEspecie[encontrada->second];
+            especie.membros++;
+            especie.melhor = std::max(especie.melhor, aptidao);
+            especie.media += aptidao;
+            especie.conexoesAtivasMedio += ativas;
+        }
+    }
+
+    const size_t n = individuos.size();
+    if (n > 0) {
+        metricas.media = static_cast<float>(media);
+        metricas.desvio = static_cast<float>(std::sqrt(m2 / n));
+        metricas.p10 = static_cast<float>(q10.obter());
+        metricas.p50 = static_cast<float>(q50.obter());
+        metricas.p90 = static_cast<float>(q90.obter());
+        metricas.nosMedio = static_cast<float>(somaNos / n);
+        metricas.conexoesAtivasMedio = static_cast<float>(somaAtivas / n);
+    } else {
+        metricas.melhor = metricas.pior = 0.0f;
+    }
+
+    // Diversidade por pares espalhados de forma determinística pela população
+    if (n > 1) {
+        int pares = std::max(1, config.paresDiversidade);
+        double soma = 0;
+        for (int k = 0; k < pares; k++) {
+            size_t a = (static_cast<size_t>(k) * 7919) % n;
+            size_t b = (a + 1 + (static_cast<size_t>(k) * 104729) % (n - 1)) % n;
+            soma += Especie::calcularDistancia(individuos[a].obterGenomaCompacto(),
+                                               individuos[b].obterGenomaCompacto(), configNEAT);
+        }
+        metricas.diversidade = static_cast<float>(soma / pares);
+    }
+
+    for (auto& especie : porEspecie) {
+        if (especie.membros > 0) {
+            especie.media /= especie.membros;
+            especie.conexoesAtivasMedio /= especie.membros;
+        } else {
+            especie.melhor = 0.0f;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> trava(mutex);
+        pendentesGeracao.push_back(metricas);
+        pendentesEspecie.insert(pendentesEspecie.end(), porEspecie.begin(), porEspecie.end());
+    }
+    aviso.notify_one();
+
+    especiesRecentes = std::move(porEspecie);
+    janela.push_back(metricas);
+    while (static_cast<int>(janela.size()) > std::max(1, config.janela)) {
+        janela.pop_front();
+    }
+    return janela.back();
+}
+
+void RegistroMetricas::loop() {
+    std::unique_lock<std::mutex> trava(mutex);
+    while (true) {
+        aviso.wait(trava, [this] { return !executando || !pendentesGeracao.empty(); });
+        if (pendentesGeracao.empty() && !executando) break;
+
+        std::vector<MetricasGeracao> geracoes;
+        std::vector<MetricasEspecie> especies;
+        geracoes.swap(pendentesGeracao);
+        especies.swap(pendentesEspecie);
+        trava.unlock();
+
+        // Transpor as linhas pendentes em colunas e gravar um bloco por arquivo
+        std::vector<std::vector<float>> colunas(colunasGeracao().size());
+        for (auto& coluna : colunas) coluna.reserve(geracoes.size());
+        for (const auto& m : geracoes) {
+            const float linha[] = {
+                (float)m.geracao, (float)m.individuos, (float)m.especies, m.melhor, m.media, m.pior,
+                m.desvio, m.p10, m.p50, m.p90, m.diversidade, m.nosMedio, m.conexoesAtivasMedio,
+                m.maxConexoesAtivas
+            };
+            for (size_t c = 0; c < colunas.size(); c++) colunas[c].push_back(linha[c]);
+        }
+        gravarBloco(config.arquivo, colunas);
+
+        colunas.assign(colunasEspecie().size(), std::vector<float>());
+        for (const auto& m : especies) {
+            const float linha[] = {
+                (float)m.geracao, (float)m.especie, (float)m.membros, m.melhor, m.media,
+                m.aptidaoAjustada, m.conexoesAtivasMedio, (float)m.geracoesSemMelhoria
+            };
+            for (size_t c = 0; c < colunas.size(); c++) colunas[c].push_back(linha[c]);
+        }
+        if (!especies.empty()) {
+            gravarBloco(config.arquivo + ".especies", colunas);
+        }
+
+        trava.lock();
+        linhasGravadas += static_cast<long long>(geracoes.size());
+    }
+}
+
+std::vector<std::string> LeitorMetricas::lerColunas(const std::string& arquivo) {
+    std::ifstream in(arquivo, std::ios::binary);
+    std::vector<std::string> colunas;
+    if (!in || !lerCabecalho(in, colunas)) {
+        throw std::runtime_error("Log de métricas inválido: " + arquivo);
+    }
+    return colunas;
+}
+
+std::vector<float> LeitorMetricas::lerColuna(const std::string& arquivo, const std::string& coluna) {
+    std::ifstream in(arquivo, std::ios::binary);
+    std::vector<std::string> colunas;
+    if (!in || !lerCabecalho(in, colunas)) {
+        throw std::runtime_error("Log de métricas inválido: " + arquivo);
+    }
+    auto posicao = std::find(colunas.begin(), colunas.end(), coluna);
+    if (posicao == colunas.end()) {
+        throw std::runtime_error("Coluna inexistente no log de métricas: " + coluna);
+    }
+    const std::streamoff indice = posicao - colunas.begin();
+    const std::streamoff numColunas = static_cast<std::streamoff>(colunas.size());
+
+    // Em cada bloco, pular direto para a coluna pedida e depois para o próximo bloco
+    std::vector<float> valores;
+    uint32_t linhas = 0;
+    while (in.read(reinterpret_cast<char*>(&linhas), sizeof(linhas))) {
+        const std::streamoff bytesColuna = static_cast<std::streamoff>(linhas) * sizeof(float);
+        in.seekg(indice * bytesColuna, std::ios::cur);
+        size_t inicio = valores.size();
+        valores.resize(inicio + linhas);
+        if (!in.read(reinterpret_cast<char*>(valores.data() + inicio), bytesColuna)) {
+            valores.resize(inicio);  // bloco incompleto no fim (gravação interrompida)
+            break;
+        }
+        in.seekg((numColunas - indice - 1) * bytesColuna, std::ios::cur);
+    }
+    return valores;
+}
+
+} // namespace NEAT
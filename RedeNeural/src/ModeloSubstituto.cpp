@@ -0,0 +1,83 @@
+#include "../include/ModeloSubstituto.h"
+#include <algorithm>
+#include <cmath>
+
+namespace NEAT {
+
+ModeloSubstituto::ModeloSubstituto(double regularizacao, double fatorEsquecimento)
+    : regressao(NUM_CARACTERISTICAS, regularizacao, fatorEsquecimento) {
+}
+
+void ModeloSubstituto::extrairCaracteristicas(const Rede& rede, double* destino) const {
+    const auto& nos = rede.obterNos();
+    const GenomaCompacto& genoma = rede.obterGenomaCompacto();
+    
+    int ocultos = 0;
+    for (const auto& no : nos) {
+        if (no.camada == 1) ocultos++;
+    }
+    
+    int ativas = 0;
+    double soma = 0, somaQuadrados = 0, somaAbs = 0, maiorAbs = 0;
+    std::fill(destino, destino + NUM_CARACTERISTICAS, 0.0);
+    for (int i = 0; i < genoma.tamanho(); i++) {
+        if (!genoma.ativo(i)) continue;
+        double peso = genoma.peso(i);
+        ativas++;
+        soma += peso;
+        somaQuadrados += peso * peso;
+        somaAbs += std::abs(peso);
+        maiorAbs = std::max(maiorAbs, std::abs(peso));
+        // Conexões com inovação pendente ainda não têm grupo
+        if (genoma.inovacao(i) >= 0) {
+            destino[9 + genoma.inovacao(i) % GRUPOS_INOVACAO] += peso;
+        }
+    }
+    
+    double media = ativas > 0 ? soma / ativas : 0;
+    double variancia = ativas > 0 ? somaQuadrados / ativas - media * media : 0;
+    
+    destino[0] = 1.0;  // intercepto
+    destino[1] = nos.size();
+    destino[2] = genoma.tamanho();
+    destino[3] = ativas;
+    destino[4] = ocultos;
+    destino[5] = media;
+    destino[6] = std::sqrt(std::max(0.0, variancia));
+    destino[7] = ativas > 0 ? somaAbs / ativas : 0;
+    destino[8] = maiorAbs;
+}
+
+void ModeloSubstituto::envelhecer() {
+    regressao.envelhecer();
+}
+
+void ModeloSubstituto::adicionarAmostra(const Rede& rede, float aptidao) {
+    double x[NUM_CARACTERISTICAS];
+    extrairCaracteristicas(rede, x);
+    regressao.adicionarAmostra(x, aptidao);
+}
+
+void ModeloSubstituto::adicionarGeracao(const std::vector<Rede>& redes) {
+    std::vector<double> x(redes.size() * NUM_CARACTERISTICAS);
+    std::vector<double> y(redes.size());
+    for (size_t i = 0; i < redes.size(); i++) {
+        extrairCaracteristicas(redes[i], &x[i * NUM_CARACTERISTICAS]);
+        y[i] = redes[i].obterAptidao();
+    }
+    regressao.adicionarLote(x.data(), y.data(), static_cast<int>(redes.size()));
+}
+
+void ModeloSubstituto::preparar() const {
+    regressao.resolver();
+}
+
+float ModeloSubstituto::prever(const Rede& rede) const {
+    regressao.resolver();
+    
+    double x[NUM_CARACTERISTICAS];
+    extrairCaracteristicas(rede, x);
+    return static_cast<float>(regressao.prever(x));
+}
+
+} // namespace NEAT
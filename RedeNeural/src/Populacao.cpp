@@ -1,324 +1,626 @@
-#include "../include/Populacao.h"
-#include <algorithm>
-#include <iostream>
-#include <random>
-
-namespace NEAT {
-
-Populacao::Populacao(int numEntradas, int numSaidas, const Configuracao& config)
-    : config(config), geracao(0), melhorAptidao(0) {
-    
-    // Criar população inicial
-    for (int i = 0; i < config.tamanhoPopulacao; i++) {
-        individuos.emplace_back(numEntradas, numSaidas);
-    }
-}
-
-void Populacao::evoluir() {
-    std::wcout << L"\n=== Iniciando Evolução da População ===" << std::endl;
-    std::wcout << L"Tamanho da população: " << individuos.size() << std::endl;
-    
-    // Ordenar por aptidão
-    std::sort(individuos.begin(), individuos.end(),
-        [](const Rede& a, const Rede& b) {
-            return a.obterAptidao() > b.obterAptidao();
-        });
-    
-    // Especiar a população
-    especies.clear();
-    for (auto& individuo : individuos) {
-        bool encontrouEspecie = false;
-        
-        // Tentar adicionar a uma espécie existente
-        for (auto& especie : especies) {
-            if (especie.verificarCompatibilidade(individuo)) {
-                especie.adicionarMembro(&individuo);
-                encontrouEspecie = true;
-                break;
-            }
-        }
-        
-        // Se não encontrou espécie compatível, criar nova espécie
-        if (!encontrouEspecie && especies.size() < config.maxEspecies) {
-            especies.emplace_back(individuo);
-            especies.back().adicionarMembro(&individuo);
-        }
-    }
-    
-    // Ajustar aptidões
-    for (auto& especie : especies) {
-        especie.calcularAptidaoAjustada();
-    }
-    
-    // Criar nova geração mantendo o tamanho original
-    std::vector<Rede> novaGeracao;
-    novaGeracao.reserve(config.tamanhoPopulacao);
-    
-    // Calcular total de aptidão ajustada de todas as espécies
-    float somaAptidoesEspecies = 0;
-    for (const auto& especie : especies) {
-        somaAptidoesEspecies += especie.obterAptidaoAjustada();
-    }
-    
-    // Distribuir slots proporcionalmente à aptidão de cada espécie
-    int slotsRestantes = config.tamanhoPopulacao;
-    
-    // Garantir que cada espécie tenha pelo menos um slot (elitismo)
-    for (const auto& especie : especies) {
-        if (!especie.obterMembros().empty()) {
-            auto melhorDaEspecie = std::max_element(
-                especie.obterMembros().begin(),
-                especie.obterMembros().end(),
-                [](const Rede* a, const Rede* b) {
-                    return a->obterAptidao() < b->obterAptidao();
-                });
-            novaGeracao.push_back(**melhorDaEspecie);
-            slotsRestantes--;
-        }
-    }
-    
-    // Distribuir slots restantes proporcionalmente
-    for (const auto& especie : especies) {
-        if (slotsRestantes <= 0) break;
-        
-        std::wcout << L"\nProcessando espécie com " 
-                   << especie.obterMembros().size() << L" membros" << std::endl;
-        std::wcout << L"Aptidão média da espécie: " 
-                   << especie.obterAptidaoAjustada() << std::endl;
-        
-        int slotsEspecie = static_cast<int>(
-            (especie.obterAptidaoAjustada() / somaAptidoesEspecies) * slotsRestantes
-        );
-        
-        std::wcout << L"Slots alocados para esta espécie: " << slotsEspecie << std::endl;
-        
-        for (int i = 0; i < slotsEspecie && novaGeracao.size() < config.tamanhoPopulacao; i++) {
-            if (especie.obterMembros().empty()) continue;
-            
-            if ((float)rand() / RAND_MAX < config.taxaCruzamento) {
-                // Cruzamento
-                const Rede* pai1 = especie.obterMembros()[
-                    rand() % especie.obterMembros().size()];
-                const Rede* pai2 = especie.obterMembros()[
-                    rand() % especie.obterMembros().size()];
-                
-                Rede filho = cruzarRedes(*pai1, *pai2);
-                if ((float)rand() / RAND_MAX < config.taxaMutacao) {
-                    filho.mutar();
-                }
-                novaGeracao.push_back(filho);
-            } else {
-                std::wcout << L"Criando indivíduo por mutação direta" << std::endl;
-                // Mutação
-                Rede filho = *especie.obterMembros()[
-                    rand() % especie.obterMembros().size()];
-                filho.mutar();
-                novaGeracao.push_back(filho);
-            }
-        }
-    }
-    
-    // Preencher slots restantes com cópias dos melhores
-    while (novaGeracao.size() < config.tamanhoPopulacao) {
-        novaGeracao.push_back(individuos[0]); // Copiar o melhor indivíduo
-    }
-    
-    std::wcout << L"\n=== Evolução Concluída ===" << std::endl;
-    std::wcout << L"Nova população criada com " << novaGeracao.size() << L" indivíduos" << std::endl;
-    std::wcout << L"--------------------------------" << std::endl;
-    
-    // Calcular estatísticas antes do callback
-    float aptidaoTotal = 0;
-    float aptidaoMinima = individuos[0].obterAptidao();
-    float aptidaoMaxima = individuos[0].obterAptidao();
-    
-    for (const auto& individuo : individuos) {
-        float aptidao = individuo.obterAptidao();
-        aptidaoTotal += aptidao;
-        aptidaoMinima = std::min(aptidaoMinima, aptidao);
-        aptidaoMaxima = std::max(aptidaoMaxima, aptidao);
-    }
-    
-    float aptidaoMedia = aptidaoTotal / individuos.size();
-    melhorAptidao = std::max(melhorAptidao, aptidaoMaxima);
-
-    // Atualizar população
-    individuos = std::move(novaGeracao);
-    geracao++;
-
-    // Notificar callback se existir
-    if (onGeracaoCallback) {
-        onGeracaoCallback(geracao, 
-                         melhorAptidao, 
-                         aptidaoMedia,  // Agora está definida
-                         aptidaoMinima); // Agora está definida
-    }
-}
-
-void Populacao::avaliarPopulacao(std::function<float(Rede&)> funcaoAvaliacao) {
-    for (auto& individuo : individuos) {
-        float aptidao = funcaoAvaliacao(individuo);
-        individuo.definirAptidao(aptidao);
-    }
-}
-
-Rede* Populacao::selecaoTorneio(int tamanhoTorneio) {
-    float melhorAptidao = -1.0f;
-    Rede* melhorRede = nullptr;
-    
-    for (int i = 0; i < tamanhoTorneio; i++) {
-        int idx = rand() % individuos.size();
-        float aptidao = individuos[idx].obterAptidao();
-        if (aptidao > melhorAptidao) {
-            melhorAptidao = aptidao;
-            melhorRede = &individuos[idx];
-        }
-    }
-    
-    return melhorRede;
-}
-
-Rede Populacao::cruzarRedes(const Rede& rede1, const Rede& rede2) {
-    std::wcout << L"\n=== Iniciando Cruzamento ===" << std::endl;
-    std::wcout << L"Pai 1 - Aptidão: " << rede1.obterAptidao() << std::endl;
-    std::wcout << L"Pai 2 - Aptidão: " << rede2.obterAptidao() << std::endl;
-    
-    // Criar uma nova rede com a mesma estrutura básica
-    Rede filho(0, 0); // Os números serão ignorados pois vamos copiar a estrutura
-    
-    // Copiar nós
-    filho.definirNos(rede1.obterNos());
-    
-    // Cruzar conexões
-    const auto& conexoes1 = rede1.obterConexoes();
-    const auto& conexoes2 = rede2.obterConexoes();
-    
-    std::vector<Conexao> novasConexoes;
-    int conexoesHerdadasPai1 = 0;
-    int conexoesHerdadasPai2 = 0;
-    
-    for (size_t i = 0; i < conexoes1.size(); i++) {
-        if (rand() % 2 == 0) {
-            novasConexoes.push_back(conexoes1[i]);
-            conexoesHerdadasPai1++;
-        } else {
-            novasConexoes.push_back(conexoes2[i]);
-            conexoesHerdadasPai2++;
-        }
-    }
-    
-    filho.definirConexoes(novasConexoes);
-    
-    std::wcout << L"Conexões herdadas do Pai 1: " << conexoesHerdadasPai1 << std::endl;
-    std::wcout << L"Conexões herdadas do Pai 2: " << conexoesHerdadasPai2 << std::endl;
-    std::wcout << L"Total de conexões do filho: " << novasConexoes.size() << std::endl;
-    
-    // Verificar se haverá mutação
-    float chanceMutacao = static_cast<float>(rand()) / RAND_MAX;
-    if (chanceMutacao < config.taxaMutacao) {
-        std::wcout << L"Filho será mutado (chance: " << chanceMutacao << L")" << std::endl;
-    }
-    
-    std::wcout << L"=== Cruzamento Concluído ===" << std::endl;
-    std::wcout << L"--------------------------------" << std::endl;
-    
-    return filho;
-}
-
-void Populacao::selecao() {
-    // Ordenar indivíduos por aptidão
-    std::sort(individuos.begin(), individuos.end(),
-        [](const Rede& a, const Rede& b) {
-            return a.obterAptidao() > b.obterAptidao();
-        });
-}
-
-void Populacao::cruzamento() {
-    std::vector<Rede> novaGeracao;
-    
-    // Preservar os melhores (elitismo)
-    int numElite = static_cast<int>(config.tamanhoPopulacao * config.taxaElitismo);
-    for (int i = 0; i < numElite; i++) {
-        novaGeracao.push_back(individuos[i]);
-    }
-    
-    // Preencher o resto com cruzamentos
-    while (novaGeracao.size() < config.tamanhoPopulacao) {
-        Rede* pai1 = selecaoTorneio(config.tamanhoTorneio);
-        Rede* pai2 = selecaoTorneio(config.tamanhoTorneio);
-        if (pai1 && pai2) {
-            Rede filho = cruzarRedes(*pai1, *pai2);
-            if ((float)rand() / RAND_MAX < config.taxaMutacao) {
-                filho.mutar();
-            }
-            novaGeracao.push_back(filho);
-        }
-    }
-    
-    individuos = std::move(novaGeracao);
-}
-
-void Populacao::mutacao() {
-    for (auto& individuo : individuos) {
-        if ((float)rand() / RAND_MAX < config.taxaMutacao) {
-            individuo.mutar();
-        }
-    }
-}
-
-void Populacao::especiar() {
-    especies.clear();
-    
-    for (auto& individuo : individuos) {
-        bool encontrouEspecie = false;
-        
-        for (auto& especie : especies) {
-            if (especie.verificarCompatibilidade(individuo)) {
-                especie.adicionarMembro(&individuo);
-                encontrouEspecie = true;
-                break;
-            }
-        }
-        
-        if (!encontrouEspecie && especies.size() < config.maxEspecies) {
-            especies.emplace_back(individuo);
-        }
-    }
-}
-
-void Populacao::ajustarAptidoes() {
-    for (auto& especie : especies) {
-        especie.calcularAptidaoAjustada();
-    }
-}
-
-void Populacao::eliminarEspeciesFracas() {
-    especies.erase(
-        std::remove_if(especies.begin(), especies.end(),
-            [this](const Especie& especie) {
-                return especie.obterAptidaoAjustada() < melhorAptidao * 0.2f;
-            }),
-        especies.end()
-    );
-}
-
-void Populacao::salvarMelhorRede(const std::string& arquivo) {
-    if (individuos.empty()) return;
-    
-    // Encontrar a melhor rede
-    auto melhor = std::max_element(individuos.begin(), individuos.end(),
-        [](const Rede& a, const Rede& b) {
-            return a.obterAptidao() < b.obterAptidao();
-        });
-        
-    melhor->salvar(arquivo);
-}
-
-void Populacao::carregarMelhorRede(const std::string& arquivo) {
-    if (individuos.empty()) {
-        individuos.emplace_back(0, 0);
-    }
-    individuos[0].carregar(arquivo);
-}
-
-} // namespace NEAT 
+#include "../include/Populacao.h"
+#include "../include/AvaliadorProcessos.h"
+#include "../include/HallDaFama.h"
+#include "../include/Metricas.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <thread>
+
+namespace NEAT {
+
+namespace {
+
+// Divide [0, total) em blocos distribuídos dinamicamente entre as threads;
+// a tarefa recebe o intervalo e o índice da thread (para os rascunhos dela)
+template <typename Tarefa>
+void executarEmParalelo(int total, int numThreads, int bloco, Tarefa tarefa) {
+    numThreads = std::max(1, std::min(numThreads, (total + bloco - 1) / bloco));
+    std::atomic<int> proximo(0);
+    auto trabalhar = [&](int idThread) {
+        for (int inicio = proximo.fetch_add(bloco); inicio < total; inicio = proximo.fetch_add(bloco)) {
+            tarefa(inicio, std::min(total, inicio + bloco), idThread);
+        }
+    };
+    
+    std::vector<std::thread> threads;
+    for (int t = 1; t < numThreads; t++) {
+        threads.emplace_back(trabalhar, t);
+    }
+    trabalhar(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+} // namespace
+
+Populacao::Populacao(int numEntradas, int numSaidas, const Configuracao& config)
+    : config(config), geracao(0), melhorAptidao(0), proximoIdEspecie(0),
+      bufferSnapshots(nullptr), registroMetricas(nullptr), hallDaFama(nullptr),
+      numObjetivos(0),
+      gerador(config.semente != 0 ? config.semente : static_cast<unsigned int>(rand())) {
+    
+    // Criar população inicial; todos compartilham as inovações das conexões iniciais
+    for (int i = 0; i < config.tamanhoPopulacao; i++) {
+        individuos.emplace_back(numEntradas, numSaidas, inovacoes, gerador);
+    }
+    especieDosIndividuos.assign(individuos.size(), -1);
+    dicasEspecie.assign(individuos.size(), -1);
+}
+
+void Populacao::evoluir() {
+    log() << L"\n=== Iniciando Evolução da População ===" << std::endl;
+    log() << L"Tamanho da população: " << individuos.size() << std::endl;
+    
+    // Ordenar por aptidão
+    ordenarIndividuos();
+    
+    // Publicar o campeão avaliado sem esperar por quem consome
+    if (bufferSnapshots && !individuos.empty()) {
+        bufferSnapshots->obterEscrita().capturar(individuos[0], geracao);
+        bufferSnapshots->publicar();
+    }
+    
+    if (hallDaFama) {
+        int novos = hallDaFama->adicionarGeracao(individuos, geracao);
+        log() << L"Hall da fama: " << novos << L" novos genomas (" << hallDaFama->tamanho() << L" no total)" << std::endl;
+    }
+    
+    // Treinar o modelo substituto com as aptidões reais desta geração
+    if (config.fatorPoolSubstituto > 1) {
+        modeloSubstituto.envelhecer();
+        modeloSubstituto.adicionarGeracao(individuos);
+    }
+    
+    // Especiar apenas quem ainda não tem espécie (as espécies persistem entre gerações)
+    especiar();
+    
+    // Ajustar aptidões
+    for (auto& especie : especies) {
+        especie.calcularAptidaoAjustada(individuos);
+    }
+    
+    // Métricas da geração avaliada, antes de eliminar espécies
+    if (registroMetricas) {
+        registroMetricas->registrar(geracao, individuos, especieDosIndividuos, especies, config.neat);
+    }
+    
+    // Eliminar espécies estagnadas, preservando a que contém o melhor indivíduo
+    int especieDoMelhor = especieDosIndividuos.empty() ? -1 : especieDosIndividuos[0];
+    especies.erase(
+        std::remove_if(especies.begin(), especies.end(),
+            [this, especieDoMelhor](const Especie& especie) {
+                bool estagnada = especie.obterGeracoesSemMelhoria() > config.geracoesSemMelhoria &&
+                                 especie.obterId() != especieDoMelhor;
+                if (estagnada) {
+                    log() << L"Espécie " << especie.obterId() << L" eliminada por estagnação ("
+                               << especie.obterGeracoesSemMelhoria() << L" gerações)" << std::endl;
+                }
+                return estagnada;
+            }),
+        especies.end()
+    );
+    
+    // Criar nova geração mantendo o tamanho original
+    std::vector<Rede> novaGeracao;
+    std::vector<int> novasEspecies;
+    std::vector<int> novasDicas;
+    novaGeracao.reserve(config.tamanhoPopulacao);
+    novasEspecies.reserve(config.tamanhoPopulacao);
+    novasDicas.reserve(config.tamanhoPopulacao);
+    
+    // Calcular total de aptidão ajustada de todas as espécies
+    float somaAptidoesEspecies = 0;
+    for (const auto& especie : especies) {
+        somaAptidoesEspecies += especie.obterAptidaoAjustada();
+    }
+    
+    // Distribuir slots proporcionalmente à aptidão de cada espécie
+    int slotsRestantes = config.tamanhoPopulacao;
+    
+    // Garantir que cada espécie tenha pelo menos um slot (elitismo)
+    for (auto& especie : especies) {
+        if (!especie.obterMembros().empty()) {
+            auto melhorDaEspecie = std::max_element(
+                especie.obterMembros().begin(),
+                especie.obterMembros().end(),
+                [this](int a, int b) {
+                    return individuos[a].obterAptidaoSelecao() < individuos[b].obterAptidaoSelecao();
+                });
+            // O campeão mantém a espécie e passa a representá-la
+            especie.definirRepresentante(individuos[*melhorDaEspecie]);
+            novaGeracao.push_back(individuos[*melhorDaEspecie]);
+            novasEspecies.push_back(especie.obterId());
+            novasDicas.push_back(-1);
+            slotsRestantes--;
+        }
+    }
+    
+    // Planejar as vagas de todas as espécies antes de reproduzir: cada espécie
+    // recebe uma faixa fixa de candidatos, preenchida em paralelo
+    struct PlanoEspecie {
+        int especie;       // índice em especies
+        int vagas;
+        int inicio;        // primeiro candidato da faixa
+        int candidatos;
+    };
+    std::vector<PlanoEspecie> planos;
+    bool usarSubstituto = config.fatorPoolSubstituto > 1 && modeloSubstituto.estaPronto();
+    int vagasPlanejadas = static_cast<int>(novaGeracao.size());
+    int totalCandidatos = 0;
+    for (size_t e = 0; e < especies.size(); e++) {
+        const auto& especie = especies[e];
+        if (slotsRestantes <= 0) break;
+        
+        log() << L"\nProcessando espécie com " 
+                   << especie.obterMembros().size() << L" membros" << std::endl;
+        log() << L"Aptidão média da espécie: " 
+                   << especie.obterAptidaoAjustada() << std::endl;
+        
+        int slotsEspecie = static_cast<int>(
+            (especie.obterAptidaoAjustada() / somaAptidoesEspecies) * slotsRestantes
+        );
+        
+        log() << L"Slots alocados para esta espécie: " << slotsEspecie << std::endl;
+        
+        int vagas = std::min(slotsEspecie, config.tamanhoPopulacao - vagasPlanejadas);
+        if (vagas <= 0 || especie.obterMembros().empty()) continue;
+        
+        // Com o modelo substituto pronto, gerar um grupo maior e manter só os mais promissores
+        int candidatos = usarSubstituto ? vagas * config.fatorPoolSubstituto : vagas;
+        planos.push_back({static_cast<int>(e), vagas, totalCandidatos, candidatos});
+        vagasPlanejadas += vagas;
+        totalCandidatos += candidatos;
+    }
+    
+    // Cada candidato tem seu próprio gerador, semeado pela posição: o resultado
+    // não depende do número de threads nem da ordem em que terminam
+    const uint32_t sementeGeracao = static_cast<uint32_t>(gerador());
+    const int numThreads = obterNumThreads();
+    std::vector<int> especieDoCandidato(totalCandidatos);
+    for (const auto& plano : planos) {
+        std::fill_n(especieDoCandidato.begin() + plano.inicio, plano.candidatos, plano.especie);
+    }
+    std::vector<Rede> filhos(totalCandidatos, Rede(0, 0));
+    std::vector<float> previsoes(totalCandidatos, 0.0f);
+    std::vector<char> porCruzamento(totalCandidatos, 0);
+    std::vector<EspacoReproducao> espacos(numThreads);
+    
+    if (usarSubstituto) {
+        modeloSubstituto.preparar();
+    }
+    
+    executarEmParalelo(totalCandidatos, numThreads, 16,
+        [&](int inicio, int fim, int idThread) {
+            EspacoReproducao& espaco = espacos[idThread];
+            for (int c = inicio; c < fim; c++) {
+                espaco.gerador.seed(sementeGeracao ^ (0x9E3779B9u * static_cast<uint32_t>(c + 1)));
+                bool cruzado = false;
+                filhos[c] = gerarFilho(especies[especieDoCandidato[c]], espaco, cruzado);
+                porCruzamento[c] = cruzado;
+                if (usarSubstituto) {
+                    previsoes[c] = modeloSubstituto.prever(filhos[c]);
+                }
+            }
+        });
+    
+    for (const auto& plano : planos) {
+        int cruzados = static_cast<int>(std::count(porCruzamento.begin() + plano.inicio,
+            porCruzamento.begin() + plano.inicio + plano.candidatos, 1));
+        log() << L"Espécie " << especies[plano.especie].obterId() << L": " << cruzados
+                   << L" filhos por cruzamento, " << plano.candidatos - cruzados
+                   << L" por mutação direta" << std::endl;
+        
+        std::vector<int> escolhidos(plano.candidatos);
+        std::iota(escolhidos.begin(), escolhidos.end(), plano.inicio);
+        if (usarSubstituto) {
+            std::partial_sort(escolhidos.begin(), escolhidos.begin() + plano.vagas, escolhidos.end(),
+                [&previsoes](int a, int b) {
+                    return previsoes[a] > previsoes[b] || (previsoes[a] == previsoes[b] && a < b);
+                });
+            log() << L"Substituto: " << plano.vagas << L" de " << plano.candidatos
+                       << L" filhos enviados para avaliação" << std::endl;
+        }
+        
+        for (int v = 0; v < plano.vagas; v++) {
+            // Só os filhos mantidos recebem números de inovação, em ordem de vaga
+            filhos[escolhidos[v]].resolverInovacoes(inovacoes);
+            novaGeracao.push_back(std::move(filhos[escolhidos[v]]));
+            // Filhos são reavaliados na especiação, começando pela espécie dos pais
+            novasEspecies.push_back(-1);
+            novasDicas.push_back(especies[plano.especie].obterId());
+        }
+    }
+    
+    // Preencher slots restantes com cópias dos melhores
+    while (novaGeracao.size() < config.tamanhoPopulacao) {
+        novaGeracao.push_back(individuos[0]); // Copiar o melhor indivíduo
+        novasEspecies.push_back(especieDosIndividuos[0]);
+        novasDicas.push_back(-1);
+    }
+    
+    log() << L"\n=== Evolução Concluída ===" << std::endl;
+    log() << L"Nova população criada com " << novaGeracao.size() << L" indivíduos" << std::endl;
+    log() << L"--------------------------------" << std::endl;
+    
+    // Calcular estatísticas antes do callback
+    float aptidaoTotal = 0;
+    float aptidaoMinima = individuos[0].obterAptidao();
+    float aptidaoMaxima = individuos[0].obterAptidao();
+    
+    for (const auto& individuo : individuos) {
+        float aptidao = individuo.obterAptidao();
+        aptidaoTotal += aptidao;
+        aptidaoMinima = std::min(aptidaoMinima, aptidao);
+        aptidaoMaxima = std::max(aptidaoMaxima, aptidao);
+    }
+    
+    float aptidaoMedia = aptidaoTotal / individuos.size();
+    melhorAptidao = std::max(melhorAptidao, aptidaoMaxima);
+
+    // Atualizar população
+    individuos = std::move(novaGeracao);
+    especieDosIndividuos = std::move(novasEspecies);
+    dicasEspecie = std::move(novasDicas);
+    geracao++;
+    
+    // Atribuir espécie aos filhos
+    especiar();
+
+    // Notificar callback se existir
+    if (onGeracaoCallback) {
+        onGeracaoCallback(geracao, 
+                         melhorAptidao, 
+                         aptidaoMedia,  // Agora está definida
+                         aptidaoMinima); // Agora está definida
+    }
+}
+
+void Populacao::avaliarPopulacao(std::function<float(Rede&)> funcaoAvaliacao) {
+    for (auto& individuo : individuos) {
+        float aptidao = funcaoAvaliacao(individuo);
+        individuo.definirAptidao(aptidao);
+    }
+}
+
+void Populacao::avaliarPopulacao(AvaliadorProcessos& avaliador) {
+    avaliador.avaliar(individuos);
+}
+
+void Populacao::avaliarPopulacao(std::function<void(Rede&, float*)> funcaoObjetivos, int numObjetivos) {
+    this->numObjetivos = std::max(1, numObjetivos);
+    objetivos.assign(individuos.size() * this->numObjetivos, 0.0f);
+    for (size_t i = 0; i < individuos.size(); i++) {
+        funcaoObjetivos(individuos[i], &objetivos[i * this->numObjetivos]);
+    }
+    
+    classificacao = SelecaoMultiobjetivo::classificar(objetivos, this->numObjetivos);
+    int numFrentes = 0;
+    for (const auto& c : classificacao) {
+        numFrentes = std::max(numFrentes, c.frente + 1);
+    }
+    
+    // A aptidão registrada é o primeiro objetivo. A seleção usa a posição de
+    // Pareto, positiva para a divisão entre espécies: frente f vale
+    // (numFrentes - f) mais até 0.5 conforme a aglomeração (extremos = 0.5),
+    // sem sobrepor frentes
+    for (size_t i = 0; i < individuos.size(); i++) {
+        float aglomeracao = classificacao[i].aglomeracao;
+        float fracao = std::isinf(aglomeracao) ? 0.5f : 0.5f * aglomeracao / (1.0f + aglomeracao);
+        individuos[i].definirAptidao(objetivos[i * this->numObjetivos]);
+        individuos[i].definirAptidaoSelecao(static_cast<float>(numFrentes - classificacao[i].frente) + fracao);
+    }
+    
+    log() << L"Multiobjetivo: " << numFrentes << L" frentes, " 
+          << obterFrentePareto().size() << L" indivíduos não dominados" << std::endl;
+}
+
+std::vector<int> Populacao::obterFrentePareto() const {
+    std::vector<int> frente;
+    for (size_t i = 0; i < classificacao.size(); i++) {
+        if (classificacao[i].frente == 0) frente.push_back(static_cast<int>(i));
+    }
+    return frente;
+}
+
+void Populacao::avaliarComCorrida(std::function<float(Rede&, ContextoAvaliacao&)> funcaoAvaliacao,
+                                  AgendadorCorrida& agendador) {
+    ajustarIndicesEspecie();
+    agendador.avaliar(individuos, funcaoAvaliacao, especieDosIndividuos);
+    
+    const auto& estatisticas = agendador.obterEstatisticas();
+    log() << L"Corrida: " << estatisticas.cortadas << L" de " << estatisticas.avaliacoes
+               << L" avaliações interrompidas, " << estatisticas.passos << L" passos simulados"
+               << std::endl;
+}
+
+Rede* Populacao::selecaoTorneio(int tamanhoTorneio) {
+    float melhorAptidao = -1.0f;
+    Rede* melhorRede = nullptr;
+    
+    for (int i = 0; i < tamanhoTorneio; i++) {
+        int idx = static_cast<int>(gerador() % individuos.size());
+        float aptidao = individuos[idx].obterAptidaoSelecao();
+        if (aptidao > melhorAptidao) {
+            melhorAptidao = aptidao;
+            melhorRede = &individuos[idx];
+        }
+    }
+    
+    return melhorRede;
+}
+
+Rede Populacao::cruzarRedes(const Rede& rede1, const Rede& rede2) {
+    log() << L"\n=== Iniciando Cruzamento ===" << std::endl;
+    log() << L"Pai 1 - Aptidão: " << rede1.obterAptidao() << std::endl;
+    log() << L"Pai 2 - Aptidão: " << rede2.obterAptidao() << std::endl;
+    
+    EspacoReproducao espaco;
+    espaco.gerador.seed(gerador());
+    Rede filho = cruzarRedes(rede1, rede2, espaco);
+    
+    const GenomaCompacto& genoma = filho.obterGenomaCompacto();
+    log() << L"Total de conexões do filho: " << genoma.tamanho()
+               << L" (" << genoma.contarAtivos() << L" ativas)" << std::endl;
+    log() << L"=== Cruzamento Concluído ===" << std::endl;
+    log() << L"--------------------------------" << std::endl;
+    
+    return filho;
+}
+
+Rede Populacao::cruzarRedes(const Rede& rede1, const Rede& rede2, EspacoReproducao& espaco) {
+    // A estrutura (nós, genes disjuntos e excedentes) vem do pai mais apto.
+    // Empatados, vem do genoma menor, para não acumular genes sem ganho; se
+    // também empatarem no tamanho, do pai 1.
+    const Rede* maisApto = &rede1;
+    const Rede* outro = &rede2;
+    const int tamanho1 = rede1.obterGenomaCompacto().tamanho();
+    const int tamanho2 = rede2.obterGenomaCompacto().tamanho();
+    const float aptidao1 = rede1.obterAptidaoSelecao();
+    const float aptidao2 = rede2.obterAptidaoSelecao();
+    if (aptidao2 > aptidao1 || (aptidao2 == aptidao1 && tamanho2 < tamanho1)) {
+        std::swap(maisApto, outro);
+    }
+    
+    Rede filho(0, 0); // Os números serão ignorados pois vamos copiar a estrutura
+    filho.definirNos(maisApto->obterNos());
+    
+    GenomaCompacto genoma;
+    GenomaCompacto::cruzar(maisApto->obterGenomaCompacto(), outro->obterGenomaCompacto(),
+                           espaco.gerador, genoma);
+    filho.definirConexoes(genoma);
+    
+    return filho;
+}
+
+Rede Populacao::gerarFilho(const Especie& especie, EspacoReproducao& espaco, bool& porCruzamento) {
+    // Só lê a população e o espaço da própria thread, e sorteia tudo pelo gerador dela
+    std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+    const auto& membros = especie.obterMembros();
+    std::uniform_int_distribution<size_t> sorteio(0, membros.size() - 1);
+    
+    porCruzamento = chance(espaco.gerador) < config.taxaCruzamento;
+    if (porCruzamento) {
+        const Rede& pai1 = individuos[membros[sorteio(espaco.gerador)]];
+        const Rede& pai2 = individuos[membros[sorteio(espaco.gerador)]];
+        Rede filho = cruzarRedes(pai1, pai2, espaco);
+        if (chance(espaco.gerador) < config.taxaMutacao) {
+            filho.mutar(espaco.gerador, config.neat);
+        }
+        return filho;
+    }
+    
+    Rede filho = individuos[membros[sorteio(espaco.gerador)]];
+    filho.mutar(espaco.gerador, config.neat);
+    return filho;
+}
+
+std::wostream& Populacao::log() {
+    // Sem logDetalhado (por exemplo, várias populações numa varredura) as
+    // mensagens vão para um stream sem buffer, que as descarta
+    static thread_local std::wostream descarte(nullptr);
+    return config.logDetalhado ? std::wcout : descarte;
+}
+
+int Populacao::obterNumThreads() const {
+    if (config.threadsReproducao > 0) return config.threadsReproducao;
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+void Populacao::selecao() {
+    // Ordenar indivíduos por aptidão
+    ordenarIndividuos();
+}
+
+void Populacao::ordenarIndividuos() {
+    // Ordena via permutação para carregar junto a espécie de cada indivíduo
+    std::vector<int> ordem(individuos.size());
+    std::iota(ordem.begin(), ordem.end(), 0);
+    std::stable_sort(ordem.begin(), ordem.end(),
+        [this](int a, int b) {
+            return individuos[a].obterAptidaoSelecao() > individuos[b].obterAptidaoSelecao();
+        });
+    
+    ajustarIndicesEspecie();
+    std::vector<Rede> ordenados;
+    std::vector<int> especiesOrdenadas;
+    std::vector<int> dicasOrdenadas;
+    ordenados.reserve(individuos.size());
+    especiesOrdenadas.reserve(individuos.size());
+    dicasOrdenadas.reserve(individuos.size());
+    for (int indice : ordem) {
+        ordenados.push_back(std::move(individuos[indice]));
+        especiesOrdenadas.push_back(especieDosIndividuos[indice]);
+        dicasOrdenadas.push_back(dicasEspecie[indice]);
+    }
+    individuos = std::move(ordenados);
+    especieDosIndividuos = std::move(especiesOrdenadas);
+    dicasEspecie = std::move(dicasOrdenadas);
+}
+
+void Populacao::ajustarIndicesEspecie() {
+    // obterIndividuos() permite alterar o vetor por fora; novos indivíduos entram sem espécie
+    if (especieDosIndividuos.size() != individuos.size()) {
+        especieDosIndividuos.resize(individuos.size(), -1);
+        dicasEspecie.resize(individuos.size(), -1);
+    }
+}
+
+Especie* Populacao::buscarEspecie(int id) {
+    for (auto& especie : especies) {
+        if (especie.obterId() == id) {
+            return &especie;
+        }
+    }
+    return nullptr;
+}
+
+void Populacao::cruzamento() {
+    std::vector<Rede> novaGeracao;
+    
+    // Preservar os melhores (elitismo)
+    int numElite = static_cast<int>(config.tamanhoPopulacao * config.taxaElitismo);
+    for (int i = 0; i < numElite; i++) {
+        novaGeracao.push_back(individuos[i]);
+    }
+    
+    // Preencher o resto com cruzamentos
+    while (novaGeracao.size() < config.tamanhoPopulacao) {
+        Rede* pai1 = selecaoTorneio(config.tamanhoTorneio);
+        Rede* pai2 = selecaoTorneio(config.tamanhoTorneio);
+        if (pai1 && pai2) {
+            Rede filho = cruzarRedes(*pai1, *pai2);
+            if (std::uniform_real_distribution<float>(0.0f, 1.0f)(gerador) < config.taxaMutacao) {
+                filho.mutar(gerador, config.neat);
+                filho.resolverInovacoes(inovacoes);
+            }
+            novaGeracao.push_back(filho);
+        }
+    }
+    
+    individuos = std::move(novaGeracao);
+    especieDosIndividuos.assign(individuos.size(), -1);
+    dicasEspecie.assign(individuos.size(), -1);
+}
+
+void Populacao::mutacao() {
+    for (auto& individuo : individuos) {
+        if (std::uniform_real_distribution<float>(0.0f, 1.0f)(gerador) < config.taxaMutacao) {
+            individuo.mutar(gerador, config.neat);
+            individuo.resolverInovacoes(inovacoes);
+        }
+    }
+}
+
+void Populacao::especiar() {
+    ajustarIndicesEspecie();
+    
+    // Espécies que deixaram de existir liberam seus indivíduos
+    for (size_t i = 0; i < individuos.size(); i++) {
+        if (especieDosIndividuos[i] >= 0 && !buscarEspecie(especieDosIndividuos[i])) {
+            especieDosIndividuos[i] = -1;
+        }
+    }
+    
+    // Apenas indivíduos sem espécie são comparados com os representantes
+    for (size_t i = 0; i < individuos.size(); i++) {
+        if (especieDosIndividuos[i] >= 0) continue;
+        const Rede& individuo = individuos[i];
+        
+        // Tentar primeiro a espécie dos pais
+        Especie* dica = dicasEspecie[i] >= 0 ? buscarEspecie(dicasEspecie[i]) : nullptr;
+        if (dica && dica->verificarCompatibilidade(individuo, config.neat,
+                                                   config.limiarCompatibilidade)) {
+            especieDosIndividuos[i] = dica->obterId();
+            continue;
+        }
+        
+        for (auto& especie : especies) {
+            if (&especie != dica &&
+                especie.verificarCompatibilidade(individuo, config.neat, config.limiarCompatibilidade)) {
+                especieDosIndividuos[i] = especie.obterId();
+                break;
+            }
+        }
+        if (especieDosIndividuos[i] >= 0) continue;
+        
+        if (especies.size() < static_cast<size_t>(config.maxEspecies)) {
+            // Se não encontrou espécie compatível, criar nova espécie
+            especies.emplace_back(proximoIdEspecie++, individuo);
+            especieDosIndividuos[i] = especies.back().obterId();
+        } else if (!especies.empty()) {
+            // Limite de espécies atingido: usar a mais próxima
+            Especie* maisProxima = &especies[0];
+            float menorDistancia = maisProxima->calcularDistancia(individuo, config.neat);
+            for (auto& especie : especies) {
+                float distancia = especie.calcularDistancia(individuo, config.neat);
+                if (distancia < menorDistancia) {
+                    menorDistancia = distancia;
+                    maisProxima = &especie;
+                }
+            }
+            especieDosIndividuos[i] = maisProxima->obterId();
+        }
+    }
+    
+    // Reconstruir as listas de membros a partir dos índices
+    for (auto& especie : especies) {
+        especie.limparMembros();
+    }
+    for (size_t i = 0; i < individuos.size(); i++) {
+        if (Especie* especie = buscarEspecie(especieDosIndividuos[i])) {
+            especie->adicionarMembro(static_cast<int>(i));
+        }
+        dicasEspecie[i] = -1;
+    }
+    
+    // Espécies sem membros deixam de existir
+    especies.erase(
+        std::remove_if(especies.begin(), especies.end(),
+            [](const Especie& especie) { return especie.obterMembros().empty(); }),
+        especies.end()
+    );
+}
+
+void Populacao::ajustarAptidoes() {
+    for (auto& especie : especies) {
+        especie.calcularAptidaoAjustada(individuos);
+    }
+}
+
+void Populacao::eliminarEspeciesFracas() {
+    especies.erase(
+        std::remove_if(especies.begin(), especies.end(),
+            [this](const Especie& especie) {
+                return especie.obterAptidaoAjustada() < melhorAptidao * 0.2f;
+            }),
+        especies.end()
+    );
+}
+
+void Populacao::salvarMelhorRede(const std::string& arquivo) {
+    if (individuos.empty()) return;
+    
+    // Encontrar a melhor rede
+    auto melhor = std::max_element(individuos.begin(), individuos.end(),
+        [](const Rede& a, const Rede& b) {
+            return a.obterAptidao() < b.obterAptidao();
+        });
+        
+    melhor->salvar(arquivo);
+}
+
+void Populacao::carregarMelhorRede(const std::string& arquivo) {
+    if (individuos.empty()) {
+        individuos.emplace_back(0, 0);
+    }
+    individuos[0].carregar(arquivo);
+    ajustarIndicesEspecie();
+    especieDosIndividuos[0] = -1;
+}
+
+} // namespace NEAT 
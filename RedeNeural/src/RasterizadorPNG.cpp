@@ -0,0 +1,203 @@
+#include "../include/RasterizadorPNG.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <unordered_map>
+
+namespace NEAT {
+
+namespace {
+
+struct TabelaCrc {
+    uint32_t valores[256];
+    
+    TabelaCrc() {
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            valores[n] = c;
+        }
+    }
+};
+
+uint32_t crc32(const unsigned char* dados, size_t tamanho, uint32_t crc = 0) {
+    static const TabelaCrc tabelaCrc;
+    const uint32_t* tabela = tabelaCrc.valores;
+    
+    crc = ~crc;
+    for (size_t i = 0; i < tamanho; i++) {
+        crc = tabela[(crc ^ dados[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+void escreverU32(std::vector<unsigned char>& destino, uint32_t valor) {
+    destino.push_back((valor >> 24) & 0xFF);
+    destino.push_back((valor >> 16) & 0xFF);
+    destino.push_back((valor >> 8) & 0xFF);
+    destino.push_back(valor & 0xFF);
+}
+
+void escreverChunk(std::ofstream& out, const char* tipo, const std::vector<unsigned char>& dados) {
+    std::vector<unsigned char> chunk;
+    escreverU32(chunk, static_cast<uint32_t>(dados.size()));
+    chunk.insert(chunk.end(), tipo, tipo + 4);
+    chunk.insert(chunk.end(), dados.begin(), dados.end());
+    escreverU32(chunk, crc32(chunk.data() + 4, chunk.size() - 4));
+    out.write(reinterpret_cast<const char*>(chunk.data()), chunk.size());
+}
+
+} // namespace
+
+RasterizadorPNG::RasterizadorPNG(const Configuracao& config)
+    : config(config), pixels(static_cast<size_t>(config.largura) * config.altura * 4, 0) {
+}
+
+void RasterizadorPNG::pintar(int x, int y, Cor cor) {
+    if (x < 0 || y < 0 || x >= config.largura || y >= config.altura) return;
+    unsigned char* p = &pixels[(static_cast<size_t>(y) * config.largura + x) * 4];
+    p[0] = cor.r;
+    p[1] = cor.g;
+    p[2] = cor.b;
+    p[3] = cor.a;
+}
+
+void RasterizadorPNG::desenharLinha(int x0, int y0, int x1, int y1, Cor cor) {
+    // Bresenham
+    int dx = std::abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int dy = -std::abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int erro = dx + dy;
+    while (true) {
+        pintar(x0, y0, cor);
+        if (x0 == x1 && y0 == y1) break;
+        int e2 = 2 * erro;
+        if (e2 >= dy) { erro += dy; x0 += sx; }
+        if (e2 <= dx) { erro += dx; y0 += sy; }
+    }
+}
+
+void RasterizadorPNG::desenharRetangulo(int x, int y, int w, int h, Cor cor) {
+    for (int j = y; j < y + h; j++) {
+        for (int i = x; i < x + w; i++) {
+            pintar(i, j, cor);
+        }
+    }
+}
+
+void RasterizadorPNG::desenhar(const SnapshotRede& snapshot) {
+    // Desenhar fundo
+    desenharRetangulo(0, 0, config.largura, config.altura, config.corFundo);
+    
+    // Organizar nós por camada
+    std::vector<std::vector<const No*>> camadasNos(3);
+    for (const auto& no : snapshot.nos) {
+        camadasNos[no.camada].push_back(&no);
+    }
+    
+    // Posicionar nós, com margem para o nó da última coluna caber na imagem
+    int margem = config.raioNo + 1;
+    int larguraUtil = config.largura - 2 * margem;
+    std::unordered_map<int, std::pair<int, int>> posicoes;
+    for (int camada = 0; camada < 3; camada++) {
+        int x = margem + camada * larguraUtil / 2;
+        float espacoY = config.altura / static_cast<float>(camadasNos[camada].size() + 1);
+        for (size_t i = 0; i < camadasNos[camada].size(); i++) {
+            posicoes[camadasNos[camada][i]->id] = {x, static_cast<int>((i + 1) * espacoY)};
+        }
+    }
+    
+    // Desenhar conexões
+    for (const auto& conexao : snapshot.conexoes) {
+        if (!conexao.ativo) continue;
+        
+        auto itInicio = posicoes.find(conexao.deNo);
+        auto itFim = posicoes.find(conexao.paraNo);
+        if (itInicio == posicoes.end() || itFim == posicoes.end()) continue;
+        
+        // Cor baseada no peso
+        Cor cor = {
+            static_cast<unsigned char>(conexao.peso < 0 ? 255 : 0),
+            static_cast<unsigned char>(conexao.peso > 0 ? 255 : 0),
+            0, 255
+        };
+        desenharLinha(itInicio->second.first, itInicio->second.second,
+                      itFim->second.first, itFim->second.second, cor);
+    }
+    
+    // Desenhar nós
+    for (int camada = 0; camada < 3; camada++) {
+        Cor cor;
+        switch (camada) {
+            case 0: cor = config.corEntrada; break;
+            case 1: cor = config.corOculta; break;
+            default: cor = config.corSaida; break;
+        }
+        
+        for (const No* no : camadasNos[camada]) {
+            auto pos = posicoes[no->id];
+            int x = pos.first - config.raioNo;
+            int y = pos.second - config.raioNo;
+            int lado = config.raioNo * 2;
+            if (config.mostrarBordas) {
+                desenharRetangulo(x, y, lado, lado, {255, 255, 255, 255});
+                desenharRetangulo(x + 1, y + 1, lado - 2, lado - 2, cor);
+            } else {
+                desenharRetangulo(x, y, lado, lado, cor);
+            }
+        }
+    }
+}
+
+bool RasterizadorPNG::salvar(const std::string& arquivo) const {
+    std::ofstream out(arquivo, std::ios::binary);
+    if (!out) return false;
+    
+    const unsigned char assinatura[8] = {137, 80, 78, 71, 13, 10, 26, 10};
+    out.write(reinterpret_cast<const char*>(assinatura), 8);
+    
+    // IHDR: RGBA de 8 bits
+    std::vector<unsigned char> cabecalho;
+    escreverU32(cabecalho, config.largura);
+    escreverU32(cabecalho, config.altura);
+    cabecalho.insert(cabecalho.end(), {8, 6, 0, 0, 0});
+    escreverChunk(out, "IHDR", cabecalho);
+    
+    // Linhas com filtro 0, dentro de um fluxo zlib de blocos sem compressão
+    size_t bytesLinha = static_cast<size_t>(config.largura) * 4;
+    std::vector<unsigned char> bruto;
+    bruto.reserve((bytesLinha + 1) * config.altura);
+    for (int y = 0; y < config.altura; y++) {
+        bruto.push_back(0);
+        bruto.insert(bruto.end(), pixels.begin() + y * bytesLinha, pixels.begin() + (y + 1) * bytesLinha);
+    }
+    
+    std::vector<unsigned char> zlib = {0x78, 0x01};
+    size_t posicao = 0;
+    do {
+        size_t tamanhoBloco = std::min<size_t>(65535, bruto.size() - posicao);
+        bool ultimo = posicao + tamanhoBloco == bruto.size();
+        zlib.push_back(ultimo ? 1 : 0);
+        zlib.push_back(tamanhoBloco & 0xFF);
+        zlib.push_back((tamanhoBloco >> 8) & 0xFF);
+        zlib.push_back(~tamanhoBloco & 0xFF);
+        zlib.push_back((~tamanhoBloco >> 8) & 0xFF);
+        zlib.insert(zlib.end(), bruto.begin() + posicao, bruto.begin() + posicao + tamanhoBloco);
+        posicao += tamanhoBloco;
+    } while (posicao < bruto.size());
+    
+    uint32_t a = 1, b = 0;
+    for (unsigned char byte : bruto) {
+        a = (a + byte) % 65521;
+        b = (b + a) % 65521;
+    }
+    escreverU32(zlib, (b << 16) | a);
+    escreverChunk(out, "IDAT", zlib);
+    
+    escreverChunk(out, "IEND", {});
+    return static_cast<bool>(out);
+}
+
+} // namespace NEAT
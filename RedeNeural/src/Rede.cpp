@@ -1,126 +1,338 @@
-#include "../include/Rede.h"
-#include <cmath>
-#include <fstream>
-#include <iostream>
-
-namespace NEAT {
-
-int Rede::proximaInovacao = 0;
-
-float Rede::sigmoid(float x) {
-    return 1.0f / (1.0f + exp(-x));
-}
-
-void Rede::limpar() {
-    for (auto& no : nos) {
-        no.valor = 0.0f;
-    }
-    saidas.clear();
-}
-
-void Rede::definirEntradas(const std::vector<float>& novasEntradas) {
-    entradas = novasEntradas;
-}
-
-void Rede::adicionarNo(int camada) {
-    No novoNo;
-    novoNo.id = proximoIdNo++;
-    novoNo.camada = camada;
-    novoNo.valor = 0.0f;
-    nos.push_back(novoNo);
-}
-
-void Rede::adicionarConexao(int deNo, int paraNo, float peso) {
-    Conexao novaConexao;
-    novaConexao.deNo = deNo;
-    novaConexao.paraNo = paraNo;
-    novaConexao.peso = peso;
-    novaConexao.ativo = true;
-    novaConexao.inovacao = proximaInovacao++;
-    conexoes.push_back(novaConexao);
-}
-
-void Rede::mutar() {
-    // Implementação básica de mutação
-    for (auto& conexao : conexoes) {
-        if (rand() % 100 < 10) { // 10% de chance de mutar cada conexão
-            conexao.peso += (float)(rand() % 200 - 100) / 100.0f;
-        }
-    }
-}
-
-Rede::Rede(int numEntradas, int numSaidas) : aptidao(0), proximoIdNo(0) {
-    // Adicionar nós de entrada
-    for (int i = 0; i < numEntradas; i++) {
-        adicionarNo(0);  // camada de entrada
-    }
-    
-    // Adicionar nós de saída
-    for (int i = 0; i < numSaidas; i++) {
-        adicionarNo(2);  // camada de saída
-    }
-    
-    // Criar conexões iniciais entre todas as entradas e saídas
-    for (int i = 0; i < numEntradas; i++) {
-        for (int j = 0; j < numSaidas; j++) {
-            float peso = (float)(rand() % 2000 - 1000) / 1000.0f;
-            adicionarConexao(i, numEntradas + j, peso);
-        }
-    }
-}
-
-void Rede::avaliar() {
-    limpar();
-    
-    // Definir valores dos nós de entrada
-    for (size_t i = 0; i < entradas.size(); i++) {
-        nos[i].valor = entradas[i];
-    }
-    
-    // Propagar valores pela rede
-    for (const auto& conexao : conexoes) {
-        if (conexao.ativo) {
-            nos[conexao.paraNo].valor += nos[conexao.deNo].valor * conexao.peso;
-        }
-    }
-    
-    // Coletar saídas e aplicar função de ativação
-    saidas.clear();
-    for (const auto& no : nos) {
-        if (no.camada == 2) {
-            saidas.push_back(sigmoid(no.valor));
-        }
-    }
-}
-
-void Rede::salvar(const std::string& arquivo) {
-    std::ofstream out(arquivo, std::ios::binary);
-    
-    // Salvar nós
-    size_t numNos = nos.size();
-    out.write(reinterpret_cast<char*>(&numNos), sizeof(numNos));
-    out.write(reinterpret_cast<char*>(nos.data()), numNos * sizeof(No));
-    
-    // Salvar conexões
-    size_t numConexoes = conexoes.size();
-    out.write(reinterpret_cast<char*>(&numConexoes), sizeof(numConexoes));
-    out.write(reinterpret_cast<char*>(conexoes.data()), numConexoes * sizeof(Conexao));
-}
-
-void Rede::carregar(const std::string& arquivo) {
-    std::ifstream in(arquivo, std::ios::binary);
-    
-    // Carregar nós
-    size_t numNos;
-    in.read(reinterpret_cast<char*>(&numNos), sizeof(numNos));
-    nos.resize(numNos);
-    in.read(reinterpret_cast<char*>(nos.data()), numNos * sizeof(No));
-    
-    // Carregar conexões
-    size_t numConexoes;
-    in.read(reinterpret_cast<char*>(&numConexoes), sizeof(numConexoes));
-    conexoes.resize(numConexoes);
-    in.read(reinterpret_cast<char*>(conexoes.data()), numConexoes * sizeof(Conexao));
-}
-
+#include "../include/Rede.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+namespace NEAT {
+
+void Rede::limpar() {
+    if (plano) {
+        planoExclusivo().limpar();
+    }
+    saidas.clear();
+}
+
+void Rede::definirEntradas(const std::vector<float>& novasEntradas) {
+    entradas = novasEntradas;
+}
+
+void Rede::definirEntradas(const float* novasEntradas, int quantidade) {
+    entradas.assign(novasEntradas, novasEntradas + quantidade);
+}
+
+void Rede::adicionarNo(int camada) {
+    // Entradas repassam o valor, ocultos usam tanh e saídas sigmoid
+    TipoAtivacao ativacao = TipoAtivacao::TANH;
+    if (camada == 0) ativacao = TipoAtivacao::IDENTIDADE;
+    if (camada == 2) ativacao = TipoAtivacao::SIGMOIDE;
+    adicionarNo(camada, ativacao);
+}
+
+void Rede::adicionarNo(int camada, TipoAtivacao ativacao) {
+    No novoNo;
+    novoNo.id = proximoIdNo++;
+    novoNo.camada = camada;
+    novoNo.bias = 0.0f;
+    novoNo.ativacao = ativacao;
+    nos.push_back(novoNo);
+    genomaAlterado();
+}
+
+void Rede::definirAtivacao(int indiceNo, TipoAtivacao ativacao) {
+    nos.editar(indiceNo).ativacao = ativacao;
+    genomaAlterado();
+}
+
+void Rede::definirBias(int indiceNo, float bias) {
+    nos.editar(indiceNo).bias = bias;
+    genomaAlterado();
+}
+
+void Rede::adicionarConexao(int deNo, int paraNo, float peso, int inovacao) {
+    conexoes.adicionar(inovacao, deNo, paraNo, peso, true);
+    genomaAlterado();
+}
+
+void Rede::adicionarConexao(int deNo, int paraNo, float peso, GerenciadorInovacao& inovacoes) {
+    adicionarConexao(deNo, paraNo, peso, inovacoes.obterInovacao(deNo, paraNo));
+}
+
+void Rede::resolverInovacoes(GerenciadorInovacao& inovacoes) {
+    // Pendentes ficam no fim do genoma e são numeradas na ordem em que entraram
+    if (conexoes.vazio() || conexoes.inovacao(conexoes.tamanho() - 1) >= 0) return;
+    conexoes.resolverPendentes([&inovacoes](int deNo, int paraNo) {
+        return inovacoes.obterInovacao(deNo, paraNo);
+    });
+    genomaAlterado();
+}
+
+void Rede::mutar() {
+    static const ConfiguracaoNEAT padrao;
+    std::mt19937 gerador(rand());
+    mutar(gerador, padrao);
+}
+
+void Rede::mutar(std::mt19937& gerador, const ConfiguracaoNEAT& config) {
+    std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+    std::uniform_real_distribution<float> perturbacao(-1.0f, 1.0f);
+    std::uniform_int_distribution<int> tipo(0, static_cast<int>(TipoAtivacao::NUM_TIPOS) - 1);
+
+    // 10% de chance de mutar cada conexão. O salto até a próxima conexão
+    // mutada é sorteado direto (distribuição geométrica), então só os blocos
+    // com conexões alteradas deixam de ser compartilhados com o pai.
+    std::geometric_distribution<size_t> salto(0.1);
+    const size_t numConexoes = conexoes.tamanho();
+    for (size_t i = salto(gerador); i < numConexoes; i += 1 + salto(gerador)) {
+        conexoes.definirPeso(i, conexoes.peso(i) + perturbacao(gerador));
+    }
+
+    // Bias e ativação só dos nós calculados; entradas continuam identidade
+    for (size_t i = 0; i < nos.size(); i++) {
+        const No& no = nos[i];
+        if (no.camada == 0) continue;
+        if (chance(gerador) < config.CHANCE_BIAS_PERTURBADO) {
+            nos.editar(i).bias += perturbacao(gerador);
+        }
+        if (no.camada == 1 && chance(gerador) < config.CHANCE_TROCA_ATIVACAO) {
+            nos.editar(i).ativacao = static_cast<TipoAtivacao>(tipo(gerador));
+        }
+    }
+    genomaAlterado();
+}
+
+Rede::Rede(int numEntradas, int numSaidas)
+    : aptidao(0), aptidaoSelecao(0), proximoIdNo(0) {
+    // Adicionar nós de entrada
+    for (int i = 0; i < numEntradas; i++) {
+        adicionarNo(0);  // camada de entrada
+    }
+    
+    // Adicionar nós de saída
+    for (int i = 0; i < numSaidas; i++) {
+        adicionarNo(2);  // camada de saída
+    }
+    
+    // Criar conexões iniciais entre todas as entradas e saídas
+    for (int i = 0; i < numEntradas; i++) {
+        for (int j = 0; j < numSaidas; j++) {
+            float peso = (float)(rand() % 2000 - 1000) / 1000.0f;
+            adicionarConexao(i, numEntradas + j, peso, i * numSaidas + j);
+        }
+    }
+}
+
+Rede::Rede(int numEntradas, int numSaidas, GerenciadorInovacao& inovacoes, std::mt19937& gerador)
+    : aptidao(0), aptidaoSelecao(0), proximoIdNo(0) {
+    for (int i = 0; i < numEntradas; i++) {
+        adicionarNo(0);
+    }
+    for (int i = 0; i < numSaidas; i++) {
+        adicionarNo(2);
+    }
+    
+    std::uniform_real_distribution<float> distribuicao(-1.0f, 1.0f);
+    for (int i = 0; i < numEntradas; i++) {
+        for (int j = 0; j < numSaidas; j++) {
+            adicionarConexao(i, numEntradas + j, distribuicao(gerador), inovacoes);
+        }
+    }
+}
+
+RedeEsparsa& Rede::planoExclusivo() {
+    if (!plano) {
+        plano = std::make_shared<RedeEsparsa>(nos.paraVetor(), conexoes);
+    } else if (plano.use_count() > 1) {
+        plano = std::make_shared<RedeEsparsa>(*plano);
+    } else {
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    return *plano;
+}
+
+float Rede::obterValorNo(int indiceNo) const {
+    return plano ? plano->obterValorNo(indiceNo) : 0.0f;
+}
+
+void Rede::avaliar() {
+    RedeEsparsa& avaliacao = planoExclusivo();
+
+    // Entradas faltando valem zero; o estado das conexões recorrentes fica
+    // no plano entre chamadas, até limpar(). Com todas as entradas presentes
+    // o plano lê direto do buffer, sem cópia.
+    const float* origem = entradas.data();
+    if (entradas.size() < static_cast<size_t>(avaliacao.obterNumEntradas())) {
+        entradasPlano.assign(avaliacao.obterNumEntradas(), 0.0f);
+        std::copy(entradas.begin(), entradas.end(), entradasPlano.begin());
+        origem = entradasPlano.data();
+    }
+    saidas.resize(avaliacao.obterNumSaidas());
+    avaliacao.avaliar(origem, saidas.data());
+}
+
+namespace {
+
+// Arquivos .bin começam pela assinatura com a versão. Os da versão 1 não têm
+// assinatura (começam pelo número de nós) e guardam No como {id, camada, valor}.
+const char ASSINATURA_ARQUIVO[8] = {'N', 'E', 'A', 'T', 'R', 'D', '0', '2'};
+
+struct NoVersao1 {
+    int id;
+    int camada;
+    float valor;
+};
+
+} // namespace
+
+void Rede::salvar(const std::string& arquivo) {
+    std::ofstream out(arquivo, std::ios::binary);
+    if (!out) {
+        throw std::runtime_error("Erro ao abrir arquivo para escrita: " + arquivo);
+    }
+    salvar(out);
+    if (!out) {
+        throw std::runtime_error("Erro ao gravar arquivo de rede: " + arquivo);
+    }
+}
+
+void Rede::salvar(std::ostream& out) const {
+    out.write(ASSINATURA_ARQUIVO, sizeof(ASSINATURA_ARQUIVO));
+
+    // Nós campo a campo, para o arquivo não depender do layout de No
+    size_t numNos = nos.size();
+    out.write(reinterpret_cast<char*>(&numNos), sizeof(numNos));
+    for (const No& no : nos) {
+        int32_t ativacao = static_cast<int32_t>(no.ativacao);
+        out.write(reinterpret_cast<const char*>(&no.id), sizeof(no.id));
+        out.write(reinterpret_cast<const char*>(&no.camada), sizeof(no.camada));
+        out.write(reinterpret_cast<const char*>(&no.bias), sizeof(no.bias));
+        out.write(reinterpret_cast<const char*>(&ativacao), sizeof(ativacao));
+    }
+
+    // Conexões: o layout não mudou desde a versão 1
+    std::vector<Conexao> copiaConexoes = conexoes.paraConexoes();
+    size_t numConexoes = copiaConexoes.size();
+    out.write(reinterpret_cast<char*>(&numConexoes), sizeof(numConexoes));
+    out.write(reinterpret_cast<char*>(copiaConexoes.data()), numConexoes * sizeof(Conexao));
+}
+
+void Rede::carregar(const std::string& arquivo) {
+    std::ifstream in(arquivo, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("Erro ao abrir arquivo para leitura: " + arquivo);
+    }
+    carregar(in, arquivo);
+}
+
+void Rede::carregar(std::istream& in, const std::string& nome) {
+    const std::streampos inicio = in.tellg();
+    char assinatura[sizeof(ASSINATURA_ARQUIVO)] = {};
+    in.read(assinatura, sizeof(assinatura));
+    const bool versao2 = in && std::equal(assinatura, assinatura + sizeof(assinatura), ASSINATURA_ARQUIVO);
+    if (!versao2) {
+        in.clear();
+        in.seekg(inicio);
+    }
+
+    // As contagens vêm do arquivo: são conferidas com os bytes que restam
+    // antes de alocar, para um arquivo corrompido ser recusado sem bad_alloc
+    const std::streampos posicao = in.tellg();
+    in.seekg(0, std::ios::end);
+    const std::streampos fim = in.tellg();
+    in.seekg(posicao);
+    auto cabe = [&](size_t quantidade, size_t bytesPorItem) {
+        std::streamoff restante = fim - in.tellg();
+        return in && restante >= 0 && quantidade <= static_cast<uint64_t>(restante) / bytesPorItem;
+    };
+    const size_t bytesPorNo = versao2
+        ? sizeof(No::id) + sizeof(No::camada) + sizeof(No::bias) + sizeof(int32_t)
+        : sizeof(NoVersao1);
+
+    size_t numNos = 0;
+    in.read(reinterpret_cast<char*>(&numNos), sizeof(numNos));
+    if (!cabe(numNos, bytesPorNo)) {
+        throw std::runtime_error("Arquivo de rede incompleto ou inválido: " + nome);
+    }
+    std::vector<No> novosNos(numNos);
+    for (No& no : novosNos) {
+        if (versao2) {
+            int32_t ativacao = 0;
+            in.read(reinterpret_cast<char*>(&no.id), sizeof(no.id));
+            in.read(reinterpret_cast<char*>(&no.camada), sizeof(no.camada));
+            in.read(reinterpret_cast<char*>(&no.bias), sizeof(no.bias));
+            in.read(reinterpret_cast<char*>(&ativacao), sizeof(ativacao));
+            if (ativacao < 0 || ativacao >= static_cast<int32_t>(TipoAtivacao::NUM_TIPOS)) {
+                throw std::runtime_error("Ativação inválida no arquivo de rede: " + nome);
+            }
+            no.ativacao = static_cast<TipoAtivacao>(ativacao);
+        } else {
+            // Na versão 1 não havia bias e só as saídas eram ativadas (sigmoide)
+            NoVersao1 antigo;
+            in.read(reinterpret_cast<char*>(&antigo), sizeof(antigo));
+            no.id = antigo.id;
+            no.camada = antigo.camada;
+            no.bias = 0.0f;
+            no.ativacao = antigo.camada == 2 ? TipoAtivacao::SIGMOIDE : TipoAtivacao::IDENTIDADE;
+        }
+    }
+
+    size_t numConexoes = 0;
+    in.read(reinterpret_cast<char*>(&numConexoes), sizeof(numConexoes));
+    if (!cabe(numConexoes, sizeof(Conexao))) {
+        throw std::runtime_error("Arquivo de rede incompleto ou inválido: " + nome);
+    }
+    std::vector<Conexao> novasConexoes(numConexoes);
+    in.read(reinterpret_cast<char*>(novasConexoes.data()), novasConexoes.size() * sizeof(Conexao));
+    if (!in) {
+        throw std::runtime_error("Arquivo de rede incompleto ou inválido: " + nome);
+    }
+
+    nos.atribuir(novosNos);
+    conexoes = GenomaCompacto(novasConexoes);
+    proximoIdNo = 0;
+    for (const No& no : novosNos) {
+        proximoIdNo = std::max(proximoIdNo, no.id + 1);
+    }
+    genomaAlterado();
+}
+
+size_t Rede::tamanhoSerializado() const {
+    return 2 * sizeof(size_t) + nos.size() * sizeof(No) + conexoes.tamanho() * sizeof(Conexao);
+}
+
+void Rede::serializar(char* destino) const {
+    size_t numNos = nos.size();
+    std::memcpy(destino, &numNos, sizeof(numNos));
+    destino += sizeof(numNos);
+    nos.copiarPara(destino);
+    destino += numNos * sizeof(No);
+    
+    std::vector<Conexao> copiaConexoes = conexoes.paraConexoes();
+    size_t numConexoes = copiaConexoes.size();
+    std::memcpy(destino, &numConexoes, sizeof(numConexoes));
+    destino += sizeof(numConexoes);
+    std::memcpy(destino, copiaConexoes.data(), numConexoes * sizeof(Conexao));
+}
+
+void Rede::desserializar(const char* origem) {
+    size_t numNos;
+    std::memcpy(&numNos, origem, sizeof(numNos));
+    origem += sizeof(numNos);
+    nos.atribuir(origem, numNos);
+    origem += numNos * sizeof(No);
+    
+    size_t numConexoes;
+    std::memcpy(&numConexoes, origem, sizeof(numConexoes));
+    origem += sizeof(numConexoes);
+    std::vector<Conexao> novasConexoes(numConexoes);
+    std::memcpy(novasConexoes.data(), origem, numConexoes * sizeof(Conexao));
+    conexoes = GenomaCompacto(novasConexoes);
+    
+    proximoIdNo = static_cast<int>(numNos);
+    genomaAlterado();
+}
+
 } // namespace NEAT 
\ No newline at end of file
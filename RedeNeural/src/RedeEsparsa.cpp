@@ -0,0 +1,442 @@
+#include "../include/RedeEsparsa.h"
+#include "../include/Rede.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+
+namespace NEAT {
+
+RedeEsparsa::RedeEsparsa() : numEntradas(0), recorrente(false), conexoesTotais(0), simplificacao() {
+    inicioGrupo.push_back(0);
+    inicioLinha.push_back(0);
+}
+
+RedeEsparsa::RedeEsparsa(const Rede& rede, float limiarPoda) : RedeEsparsa() {
+    compilar(rede.obterNos().paraVetor(), rede.obterGenomaCompacto(), limiarPoda, true);
+}
+
+RedeEsparsa::RedeEsparsa(const std::vector<No>& nos, const std::vector<Conexao>& conexoes,
+                         float limiarPoda) : RedeEsparsa() {
+    compilar(nos, GenomaCompacto(conexoes), limiarPoda, true);
+}
+
+RedeEsparsa::RedeEsparsa(const std::vector<No>& nos, const GenomaCompacto& genoma, float limiarPoda,
+                         bool simplificar)
+    : RedeEsparsa() {
+    compilar(nos, genoma, limiarPoda, simplificar);
+}
+
+void RedeEsparsa::compilar(const std::vector<No>& nos, const GenomaCompacto& genoma, float limiarPoda,
+                           bool simplificar) {
+    const int numNos = static_cast<int>(nos.size());
+    conexoesTotais = genoma.tamanho();
+    simplificacao = RelatorioSimplificacao();
+    simplificacao.nosOriginais = numNos;
+    simplificacao.conexoesOriginais = conexoesTotais;
+
+    std::unordered_map<int, int> indicePorId;
+    for (int i = 0; i < numNos; i++) {
+        indicePorId[nos[i].id] = i;
+    }
+
+    // Conexões mantidas, agrupadas por destino; entradas não recebem conexões
+    std::vector<std::vector<std::pair<int, float>>> chegando(numNos);
+    for (int c = 0; c < genoma.tamanho(); c++) {
+        if (!genoma.ativo(c)) {
+            simplificacao.conexoesDesativadas++;
+            continue;
+        }
+        if (simplificar && deveSerPodada(genoma.peso(c), limiarPoda)) {
+            simplificacao.conexoesPodadas++;
+            continue;
+        }
+        auto de = indicePorId.find(genoma.origem(c));
+        auto para = indicePorId.find(genoma.destino(c));
+        if (de == indicePorId.end() || para == indicePorId.end()) continue;
+        if (nos[para->second].camada == 0) continue;
+
+        chegando[para->second].emplace_back(de->second, genoma.peso(c));
+    }
+
+    // Conexões paralelas (mesma origem e destino) viram uma só com a soma dos pesos
+    if (simplificar) {
+        for (auto& lista : chegando) {
+            std::sort(lista.begin(), lista.end(),
+                      [](const auto& a, const auto& b) { return a.first < b.first; });
+            size_t escrita = 0;
+            for (size_t k = 0; k < lista.size(); k++) {
+                if (escrita > 0 && lista[escrita - 1].first == lista[k].first) {
+                    lista[escrita - 1].second += lista[k].second;
+                    simplificacao.conexoesParalelas++;
+                } else {
+                    lista[escrita++] = lista[k];
+                }
+            }
+            lista.resize(escrita);
+        }
+    }
+
+    // Vivos: nós com caminho até alguma saída (busca reversa a partir delas)
+    std::vector<char> vivo(numNos, 0);
+    std::vector<int> pilha;
+    for (int i = 0; i < numNos; i++) {
+        if (nos[i].camada == 2) {
+            vivo[i] = 1;
+            pilha.push_back(i);
+        }
+    }
+    while (!pilha.empty()) {
+        int no = pilha.back();
+        pilha.pop_back();
+        for (const auto& conexao : chegando[no]) {
+            if (!vivo[conexao.first]) {
+                vivo[conexao.first] = 1;
+                pilha.push_back(conexao.first);
+            }
+        }
+    }
+
+    if (!simplificar) std::fill(vivo.begin(), vivo.end(), 1);
+
+    std::vector<std::vector<int>> saindo(numNos);
+    for (int i = 0; i < numNos; i++) {
+        if (!vivo[i]) continue;
+        for (const auto& conexao : chegando[i]) {
+            saindo[conexao.first].push_back(i);
+        }
+    }
+
+    // Nós vivos sem caminho a partir de uma entrada só dependem de bias. Os que
+    // também não estão em ciclo têm valor constante, calculado aqui em ordem
+    // topológica e somado ao bias de quem os lê.
+    std::vector<char> alcancado(numNos, 0);
+    for (int i = 0; i < numNos; i++) {
+        if (nos[i].camada == 0) {
+            alcancado[i] = 1;
+            pilha.push_back(i);
+        }
+    }
+    while (!pilha.empty()) {
+        int no = pilha.back();
+        pilha.pop_back();
+        for (int proximo : saindo[no]) {
+            if (!alcancado[proximo]) {
+                alcancado[proximo] = 1;
+                pilha.push_back(proximo);
+            }
+        }
+    }
+
+    std::vector<int> grauEntrada(numNos, 0);
+    std::vector<char> constante(numNos, 0);
+    std::vector<float> valorConstante(numNos, 0.0f);
+    for (int i = 0; i < numNos; i++) {
+        if (!simplificar || !vivo[i] || alcancado[i]) continue;
+        grauEntrada[i] = static_cast<int>(chegando[i].size());
+        if (grauEntrada[i] == 0) pilha.push_back(i);
+    }
+    while (!pilha.empty()) {
+        int no = pilha.back();
+        pilha.pop_back();
+        float soma = nos[no].bias;
+        for (const auto& [origem, peso] : chegando[no]) {
+            soma += valorConstante[origem] * peso;
+        }
+        valorConstante[no] = ativar(nos[no].ativacao, soma);
+        constante[no] = 1;
+        for (int proximo : saindo[no]) {
+            if (alcancado[proximo]) continue;
+            if (--grauEntrada[proximo] == 0) pilha.push_back(proximo);
+        }
+    }
+
+    // Mantidos: entradas, saídas e os vivos não constantes. Saídas constantes
+    // ficam como linhas sem conexões.
+    std::vector<char> mantido(numNos, 0);
+    std::vector<float> biasNo(numNos);
+    for (int i = 0; i < numNos; i++) {
+        biasNo[i] = nos[i].bias;
+        if (nos[i].camada == 0 || nos[i].camada == 2) {
+            mantido[i] = 1;
+        } else if (!vivo[i]) {
+            simplificacao.nosMortos++;
+        } else if (constante[i]) {
+            simplificacao.nosConstantes++;
+        } else {
+            mantido[i] = 1;
+        }
+    }
+    for (int i = 0; i < numNos; i++) {
+        if (!mantido[i]) {
+            chegando[i].clear();
+            continue;
+        }
+        auto& lista = chegando[i];
+        size_t escrita = 0;
+        for (const auto& conexao : lista) {
+            if (constante[conexao.first]) {
+                biasNo[i] += valorConstante[conexao.first] * conexao.second;
+            } else {
+                lista[escrita++] = conexao;
+            }
+        }
+        lista.resize(escrita);
+    }
+
+    // Níveis por ordenação topológica (Kahn): entradas no nível 0, o resto a
+    // partir do 1. O que sobra está em ciclo e vai para um último nível.
+    for (auto& lista : saindo) lista.clear();
+    std::fill(grauEntrada.begin(), grauEntrada.end(), 0);
+    for (int i = 0; i < numNos; i++) {
+        for (const auto& conexao : chegando[i]) {
+            saindo[conexao.first].push_back(i);
+            grauEntrada[i]++;
+        }
+    }
+    std::vector<int> nivel(numNos, 1);
+    std::vector<int> fila;
+    int numMantidos = 0;
+    for (int i = 0; i < numNos; i++) {
+        if (!mantido[i]) continue;
+        numMantidos++;
+        if (nos[i].camada == 0) nivel[i] = 0;
+        if (grauEntrada[i] == 0) fila.push_back(i);
+    }
+    int maiorNivel = 1;
+    for (size_t f = 0; f < fila.size(); f++) {
+        int no = fila[f];
+        maiorNivel = std::max(maiorNivel, nivel[no]);
+        for (int proximo : saindo[no]) {
+            nivel[proximo] = std::max(nivel[proximo], nivel[no] + 1);
+            if (--grauEntrada[proximo] == 0) fila.push_back(proximo);
+        }
+    }
+    recorrente = fila.size() < static_cast<size_t>(numMantidos);
+    if (recorrente) {
+        for (int i = 0; i < numNos; i++) {
+            if (grauEntrada[i] > 0) nivel[i] = maiorNivel + 1;
+        }
+    }
+
+    // Posições: entradas na ordem dos nós, depois (nível, ativação, índice)
+    nosPorPosicao.clear();
+    std::vector<int> calculados;
+    for (int i = 0; i < numNos; i++) {
+        if (!mantido[i]) continue;
+        if (nos[i].camada == 0) {
+            nosPorPosicao.push_back(i);
+        } else {
+            calculados.push_back(i);
+        }
+    }
+    numEntradas = static_cast<int>(nosPorPosicao.size());
+    std::sort(calculados.begin(), calculados.end(), [&](int a, int b) {
+        return std::make_tuple(nivel[a], static_cast<int>(nos[a].ativacao), a) <
+               std::make_tuple(nivel[b], static_cast<int>(nos[b].ativacao), b);
+    });
+    nosPorPosicao.insert(nosPorPosicao.end(), calculados.begin(), calculados.end());
+
+    std::vector<int>& posicao = posicaoDoNo;
+    posicao.assign(numNos, -1);
+    for (size_t p = 0; p < nosPorPosicao.size(); p++) {
+        posicao[nosPorPosicao[p]] = static_cast<int>(p);
+    }
+
+    // Uma linha CSR por nó calculado e um grupo por (nível, ativação)
+    inicioGrupo.assign(1, 0);
+    ativacaoGrupo.clear();
+    inicioLinha.assign(1, 0);
+    colunas.clear();
+    pesos.clear();
+    bias.clear();
+    for (size_t r = 0; r < calculados.size(); r++) {
+        int no = calculados[r];
+        if (r > 0) {
+            int anterior = calculados[r - 1];
+            if (nivel[anterior] != nivel[no] || nos[anterior].ativacao != nos[no].ativacao) {
+                inicioGrupo.push_back(static_cast<int>(r));
+            }
+        }
+        if (ativacaoGrupo.size() < inicioGrupo.size()) {
+            ativacaoGrupo.push_back(nos[no].ativacao);
+        }
+
+        for (const auto& [origem, peso] : chegando[no]) {
+            colunas.push_back(posicao[origem]);
+            pesos.push_back(peso);
+        }
+        inicioLinha.push_back(static_cast<int>(pesos.size()));
+        bias.push_back(biasNo[no]);
+    }
+    inicioGrupo.push_back(static_cast<int>(calculados.size()));
+
+    posicoesSaida.clear();
+    for (int i = 0; i < numNos; i++) {
+        if (nos[i].camada == 2) posicoesSaida.push_back(posicao[i]);
+    }
+
+    simplificacao.nosMantidos = static_cast<int>(nosPorPosicao.size());
+    simplificacao.conexoesMantidas = static_cast<int>(pesos.size());
+
+    valores.assign(nosPorPosicao.size(), 0.0f);
+    somas.assign(calculados.size(), 0.0f);
+    saidas.assign(posicoesSaida.size(), 0.0f);
+}
+
+void RedeEsparsa::avaliar(const float* entradas, float* destinoSaidas) {
+    std::copy(entradas, entradas + numEntradas, valores.begin());
+
+    // Por grupo: as somas vão primeiro para um rascunho, para que conexões
+    // recorrentes dentro do grupo leiam o passo anterior, e depois o bloco
+    // inteiro recebe a ativação
+    const int* col = colunas.data();
+    const float* w = pesos.data();
+    float* v = valores.data();
+    const int numGrupos = static_cast<int>(ativacaoGrupo.size());
+    for (int g = 0; g < numGrupos; g++) {
+        const int primeira = inicioGrupo[g];
+        const int ultima = inicioGrupo[g + 1];
+        for (int linha = primeira; linha < ultima; linha++) {
+            float soma = bias[linha];
+            for (int k = inicioLinha[linha]; k < inicioLinha[linha + 1]; k++) {
+                soma += v[col[k]] * w[k];
+            }
+            somas[linha] = soma;
+        }
+        float* bloco = v + numEntradas + primeira;
+        std::copy(somas.begin() + primeira, somas.begin() + ultima, bloco);
+        aplicarAtivacao(ativacaoGrupo[g], bloco, ultima - primeira);
+    }
+
+    for (size_t i = 0; i < posicoesSaida.size(); i++) {
+        destinoSaidas[i] = v[posicoesSaida[i]];
+    }
+}
+
+const std::vector<float>& RedeEsparsa::avaliar(const std::vector<float>& entradas) {
+    if (entradas.size() < static_cast<size_t>(numEntradas)) {
+        throw std::runtime_error("Número de entradas menor que o da rede");
+    }
+    avaliar(entradas.data(), saidas.data());
+    return saidas;
+}
+
+void RedeEsparsa::avaliarLote(const float* entradas, int tamanhoLote, float* destinoSaidas) {
+    const size_t lote = static_cast<size_t>(tamanhoLote);
+    valoresLote.assign(nosPorPosicao.size() * lote, 0.0f);
+    std::copy(entradas, entradas + numEntradas * lote, valoresLote.begin());
+
+    const int* col = colunas.data();
+    const float* w = pesos.data();
+    float* v = valoresLote.data();
+    const int numGrupos = static_cast<int>(ativacaoGrupo.size());
+    for (int g = 0; g < numGrupos; g++) {
+        const int primeira = inicioGrupo[g];
+        const int ultima = inicioGrupo[g + 1];
+        somasLote.resize((ultima - primeira) * lote);
+        for (int linha = primeira; linha < ultima; linha++) {
+            float* soma = somasLote.data() + (linha - primeira) * lote;
+            std::fill(soma, soma + lote, bias[linha]);
+            for (int k = inicioLinha[linha]; k < inicioLinha[linha + 1]; k++) {
+                const float* origem = v + col[k] * lote;
+                const float peso = w[k];
+                for (size_t a = 0; a < lote; a++) {
+                    soma[a] += peso * origem[a];
+                }
+            }
+        }
+        float* bloco = v + (numEntradas + primeira) * lote;
+        std::copy(somasLote.begin(), somasLote.end(), bloco);
+        aplicarAtivacao(ativacaoGrupo[g], bloco, static_cast<int>((ultima - primeira) * lote));
+    }
+
+    for (size_t i = 0; i < posicoesSaida.size(); i++) {
+        const float* origem = v + posicoesSaida[i] * lote;
+        std::copy(origem, origem + lote, destinoSaidas + i * lote);
+    }
+}
+
+void RedeEsparsa::limpar() {
+    std::fill(valores.begin(), valores.end(), 0.0f);
+}
+
+float RedeEsparsa::obterEsparsidade() const {
+    if (conexoesTotais == 0) return 0.0f;
+    return 1.0f - static_cast<float>(pesos.size()) / conexoesTotais;
+}
+
+RedeEsparsa::RelatorioPoda RedeEsparsa::compararCom(const Rede& original, int repeticoes, float tolerancia) {
+    using relogio = std::chrono::steady_clock;
+    RedeEsparsa completa(original.obterNos().paraVetor(), original.obterGenomaCompacto(), 0.0f, false);
+    std::vector<float> saidasCompleta(completa.obterNumSaidas());
+    std::vector<float> amostras(static_cast<size_t>(repeticoes) * numEntradas);
+    for (float& valor : amostras) {
+        valor = (float)(rand() % 2000 - 1000) / 1000.0f;
+    }
+
+    // Verificação, fora da medição: as duas partem do mesmo estado e veem as
+    // mesmas entradas, então redes recorrentes também são comparáveis
+    completa.limpar();
+    limpar();
+    float maiorDiferenca = 0.0f;
+    for (int r = 0; r < repeticoes; r++) {
+        const float* entrada = &amostras[static_cast<size_t>(r) * numEntradas];
+        completa.avaliar(entrada, saidasCompleta.data());
+        avaliar(entrada, saidas.data());
+        for (size_t i = 0; i < saidas.size() && i < saidasCompleta.size(); i++) {
+            float diferenca = std::abs(saidas[i] - saidasCompleta[i]);
+            // NaN de um lado só também conta como divergência
+            if (std::isnan(diferenca)) diferenca = std::numeric_limits<float>::infinity();
+            maiorDiferenca = std::max(maiorDiferenca, diferenca);
+        }
+    }
+
+    completa.limpar();
+    limpar();
+    float acumulador = 0.0f;  // impede que o compilador descarte as avaliações
+    auto inicio = relogio::now();
+    for (int r = 0; r < repeticoes; r++) {
+        completa.avaliar(&amostras[static_cast<size_t>(r) * numEntradas], saidasCompleta.data());
+        acumulador += saidasCompleta.empty() ? 0.0f : saidasCompleta[0];
+    }
+    auto meio = relogio::now();
+    for (int r = 0; r < repeticoes; r++) {
+        avaliar(&amostras[static_cast<size_t>(r) * numEntradas], saidas.data());
+        acumulador -= saidas.empty() ? 0.0f : saidas[0];
+    }
+    auto fim = relogio::now();
+    volatile float sumidouro = acumulador;
+    (void)sumidouro;
+
+    RelatorioPoda relatorio;
+    relatorio.conexoesTotais = conexoesTotais;
+    relatorio.conexoesMantidas = obterNumConexoes();
+    relatorio.esparsidade = obterEsparsidade();
+    relatorio.nsOriginal = std::chrono::duration<double, std::nano>(meio - inicio).count() / repeticoes;
+    relatorio.nsEsparsa = std::chrono::duration<double, std::nano>(fim - meio).count() / repeticoes;
+    relatorio.aceleracao = relatorio.nsEsparsa > 0 ? relatorio.nsOriginal / relatorio.nsEsparsa : 0.0;
+    relatorio.maiorDiferencaSaida = maiorDiferenca;
+    relatorio.saidasPreservadas = maiorDiferenca <= tolerancia;
+    return relatorio;
+}
+
+int RedeEsparsa::podarGenoma(Rede& rede, float limiarPoda) {
+    // Só os blocos de bits alterados deixam de ser compartilhados
+    GenomaCompacto genoma = rede.obterGenomaCompacto();
+    int desativadas = 0;
+    for (int i = 0; i < genoma.tamanho(); i++) {
+        if (genoma.ativo(i) && deveSerPodada(genoma.peso(i), limiarPoda)) {
+            genoma.definirAtivo(i, false);
+            desativadas++;
+        }
+    }
+    rede.definirConexoes(genoma);
+    return desativadas;
+}
+
+} // namespace NEAT
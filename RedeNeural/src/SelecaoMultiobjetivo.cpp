@@ -0,0 +1,18 @@
+#include "../include/SelecaoMultiobjetivo.h"
+#include <algorithm>
+#include <numeric>
+
+namespace NEAT {
+
+std::vector<int> SelecaoMultiobjetivo::selecionar(const std::vector<Classificacao>& classificacao,
+                                                  int quantidade) {
+    std::vector<int> indices(classificacao.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    quantidade = std::max(0, std::min(quantidade, static_cast<int>(indices.size())));
+    std::partial_sort(indices.begin(), indices.begin() + quantidade, indices.end(),
+        [&classificacao](int a, int b) { return melhor(classificacao[a], classificacao[b]); });
+    indices.resize(quantidade);
+    return indices;
+}
+
+} // namespace NEAT
@@ -0,0 +1,503 @@
+#include "../include/ServidorInferencia.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/timerfd.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace NEAT {
+
+namespace {
+
+long long agoraNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+sockaddr_un enderecoSocket(const std::string& caminho) {
+    sockaddr_un endereco;
+    std::memset(&endereco, 0, sizeof(endereco));
+    endereco.sun_family = AF_UNIX;
+    if (caminho.size() >= sizeof(endereco.sun_path)) {
+        throw std::runtime_error("Caminho de socket longo demais: " + caminho);
+    }
+    std::memcpy(endereco.sun_path, caminho.c_str(), caminho.size() + 1);
+    return endereco;
+}
+
+bool temDiretorioExecucao() {
+    const char* diretorio = std::getenv("XDG_RUNTIME_DIR");
+    return diretorio && *diretorio;
+}
+
+// Sem $XDG_RUNTIME_DIR, o socket padrão fica num diretório próprio em /tmp:
+// criado com 0700 e conferido, para não usar o diretório de outro usuário
+void prepararDiretorioPadrao(const std::string& caminhoSocket) {
+    if (temDiretorioExecucao() || caminhoSocket != caminhoSocketInferenciaPadrao()) return;
+    const std::string diretorio = caminhoSocket.substr(0, caminhoSocket.rfind('/'));
+    if (mkdir(diretorio.c_str(), 0700) < 0 && errno != EEXIST) {
+        throw std::runtime_error("Erro ao criar " + diretorio + ": " + std::strerror(errno));
+    }
+    struct stat info;
+    if (lstat(diretorio.c_str(), &info) < 0 || !S_ISDIR(info.st_mode) ||
+        info.st_uid != getuid() || (info.st_mode & 077) != 0) {
+        throw std::runtime_error("Diretório do socket não é um diretório privado do usuário: " + diretorio);
+    }
+}
+
+// Remove um socket deixado por uma execução anterior; qualquer outro tipo de
+// arquivo no caminho é preservado
+void removerSocketAntigo(const std::string& caminho) {
+    struct stat info;
+    if (lstat(caminho.c_str(), &info) < 0) return;
+    if (!S_ISSOCK(info.st_mode)) {
+        throw std::runtime_error("O caminho do socket já existe e não é um socket: " + caminho);
+    }
+    unlink(caminho.c_str());
+}
+
+} // namespace
+
+std::string caminhoSocketInferenciaPadrao() {
+    if (temDiretorioExecucao()) {
+        return std::string(std::getenv("XDG_RUNTIME_DIR")) + "/neat_inferencia.sock";
+    }
+    return "/tmp/neat_inferencia-" + std::to_string(getuid()) + "/inferencia.sock";
+}
+
+ServidorInferencia::ServidorInferencia(const Configuracao& config)
+    : config(config), socketServidor(-1), epoll(-1), evento(-1), temporizador(-1),
+      socketCriado(false), executando(false), requisicoes(0), lotes(0), descartadas(0), inicioNs(agoraNs()),
+      latenciaP50(0.5), latenciaP99(0.99) {
+    buffer.resize(sizeof(MensagemInferencia) + static_cast<size_t>(config.maximoEntradas) * sizeof(float));
+}
+
+ServidorInferencia::~ServidorInferencia() {
+    parar();
+}
+
+int ServidorInferencia::adicionarModelo(const std::string& arquivo) {
+    if (executando) {
+        throw std::runtime_error("Modelos devem ser adicionados antes de iniciar o servidor");
+    }
+    if (!std::ifstream(arquivo, std::ios::binary)) {
+        throw std::runtime_error("Erro ao abrir modelo: " + arquivo);
+    }
+    Rede rede(0, 0);
+    rede.carregar(arquivo);
+    
+    Modelo modelo;
+    modelo.arquivo = arquivo;
+    modelo.rede = RedeEsparsa(rede);
+    modelos.push_back(std::move(modelo));
+    return static_cast<int>(modelos.size()) - 1;
+}
+
+void ServidorInferencia::iniciar() {
+    if (executando) return;
+    
+    sockaddr_un endereco = enderecoSocket(config.caminhoSocket);
+    socketServidor = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    epoll = epoll_create1(EPOLL_CLOEXEC);
+    evento = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    temporizador = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (socketServidor < 0 || epoll < 0 || evento < 0 || temporizador < 0) {
+        encerrar();
+        throw std::runtime_error("Erro ao criar descritores do servidor de inferência");
+    }
+    
+    try {
+        prepararDiretorioPadrao(config.caminhoSocket);
+        removerSocketAntigo(config.caminhoSocket);
+    } catch (...) {
+        encerrar();
+        throw;
+    }
+    if (bind(socketServidor, reinterpret_cast<sockaddr*>(&endereco), sizeof(endereco)) < 0) {
+        std::string erro = std::strerror(errno);
+        encerrar();
+        throw std::runtime_error("Erro ao escutar em " + config.caminhoSocket + ": " + erro);
+    }
+    socketCriado = true;
+    if (listen(socketServidor, 64) < 0) {
+        std::string erro = std::strerror(errno);
+        encerrar();
+        throw std::runtime_error("Erro ao escutar em " + config.caminhoSocket + ": " + erro);
+    }
+    
+    for (int descritor : {socketServidor, evento, temporizador}) {
+        epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.fd = descritor;
+        epoll_ctl(epoll, EPOLL_CTL_ADD, descritor, &ev);
+    }
+    
+    zerarEstatisticas();
+    executando = true;
+    thread = std::thread(&ServidorInferencia::loop, this);
+}
+
+void ServidorInferencia::parar() {
+    if (executando) {
+        executando = false;
+        uint64_t um = 1;
+        ssize_t escritos = write(evento, &um, sizeof(um));
+        (void)escritos;
+        thread.join();
+    }
+    encerrar();
+}
+
+void ServidorInferencia::encerrar() {
+    for (int cliente : clientes) {
+        close(cliente);
+    }
+    clientes.clear();
+    for (auto& modelo : modelos) {
+        modelo.pendentes.clear();
+        modelo.entradas.clear();
+    }
+    for (int* descritor : {&socketServidor, &epoll, &evento, &temporizador}) {
+        if (*descritor >= 0) close(*descritor);
+        *descritor = -1;
+    }
+    if (socketCriado) {
+        unlink(config.caminhoSocket.c_str());
+        socketCriado = false;
+    }
+}
+
+void ServidorInferencia::loop() {
+    epoll_event eventos[64];
+    
+    while (executando) {
+        int prontos = epoll_wait(epoll, eventos, 64, -1);
+        if (prontos < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        
+        for (int i = 0; i < prontos; i++) {
+            int descritor = eventos[i].data.fd;
+            if (descritor == evento) {
+                continue;
+            } else if (descritor == temporizador) {
+                uint64_t disparos;
+                ssize_t lidos = read(temporizador, &disparos, sizeof(disparos));
+                (void)lidos;
+            } else if (descritor == socketServidor) {
+                aceitarClientes();
+            } else if (eventos[i].events & EPOLLIN) {
+                lerCliente(descritor);
+            } else {
+                fecharCliente(descritor);
+            }
+        }
+        
+        processarVencidos(agoraNs());
+        armarTemporizador();
+    }
+}
+
+void ServidorInferencia::aceitarClientes() {
+    while (true) {
+        int cliente = accept4(socketServidor, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (cliente < 0) return;
+        epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.fd = cliente;
+        epoll_ctl(epoll, EPOLL_CTL_ADD, cliente, &ev);
+        clientes.push_back(cliente);
+    }
+}
+
+void ServidorInferencia::fecharCliente(int cliente) {
+    // Requisições pendentes do cliente são descartadas: o descritor pode ser
+    // reaproveitado por outra conexão antes do lote sair
+    for (auto& modelo : modelos) {
+        const size_t largura = modelo.rede.obterNumEntradas();
+        size_t destino = 0;
+        for (size_t p = 0; p < modelo.pendentes.size(); p++) {
+            if (modelo.pendentes[p].cliente == cliente) continue;
+            if (destino != p) {
+                modelo.pendentes[destino] = modelo.pendentes[p];
+                std::copy(modelo.entradas.begin() + p * largura, modelo.entradas.begin() + (p + 1) * largura,
+                          modelo.entradas.begin() + destino * largura);
+            }
+            destino++;
+        }
+        modelo.pendentes.resize(destino);
+        modelo.entradas.resize(destino * largura);
+    }
+    epoll_ctl(epoll, EPOLL_CTL_DEL, cliente, nullptr);
+    close(cliente);
+    clientes.erase(std::remove(clientes.begin(), clientes.end(), cliente), clientes.end());
+}
+
+void ServidorInferencia::lerCliente(int cliente) {
+    while (true) {
+        ssize_t lidos = recv(cliente, buffer.data(), buffer.size(), MSG_DONTWAIT | MSG_TRUNC);
+        if (lidos == 0 || (lidos < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+            fecharCliente(cliente);
+            return;
+        }
+        if (lidos < 0) {
+            if (errno == EINTR) continue;
+            return;
+        }
+        
+        MensagemInferencia cabecalho;
+        if (static_cast<size_t>(lidos) < sizeof(cabecalho)) {
+            responderErro(cliente, 0, "Mensagem menor que o cabeçalho");
+            continue;
+        }
+        std::memcpy(&cabecalho, buffer.data(), sizeof(cabecalho));
+        
+        if (cabecalho.tipo == MensagemInferencia::ESTATISTICAS) {
+            EstatisticasInferencia estatisticas = obterEstatisticas();
+            MensagemInferencia resposta = cabecalho;
+            resposta.quantidade = sizeof(estatisticas);
+            responder(cliente, resposta, &estatisticas, sizeof(estatisticas));
+            continue;
+        }
+        if (cabecalho.tipo != MensagemInferencia::INFERENCIA || cabecalho.modelo >= modelos.size()) {
+            responderErro(cliente, cabecalho.id, "Tipo de mensagem ou modelo inválido");
+            continue;
+        }
+        
+        Modelo& modelo = modelos[cabecalho.modelo];
+        const size_t numEntradas = modelo.rede.obterNumEntradas();
+        if (static_cast<size_t>(lidos) > buffer.size() ||
+            cabecalho.quantidade != numEntradas ||
+            static_cast<size_t>(lidos) != sizeof(cabecalho) + numEntradas * sizeof(float)) {
+            responderErro(cliente, cabecalho.id, "Número de entradas diferente do modelo");
+            continue;
+        }
+        
+        Pendente pendente;
+        pendente.cliente = cliente;
+        pendente.id = cabecalho.id;
+        pendente.chegadaNs = agoraNs();
+        modelo.pendentes.push_back(pendente);
+        const float* entradas = reinterpret_cast<const float*>(buffer.data() + sizeof(cabecalho));
+        modelo.entradas.insert(modelo.entradas.end(), entradas, entradas + numEntradas);
+        
+        if (static_cast<int>(modelo.pendentes.size()) >= config.tamanhoMaximoLote) {
+            processar(modelo);
+        }
+    }
+}
+
+void ServidorInferencia::processar(Modelo& modelo) {
+    const int lote = static_cast<int>(modelo.pendentes.size());
+    if (lote == 0) return;
+    const int numEntradas = modelo.rede.obterNumEntradas();
+    const int numSaidas = modelo.rede.obterNumSaidas();
+    
+    // Linhas por requisição -> colunas por entrada
+    modelo.loteEntradas.resize(static_cast<size_t>(numEntradas) * lote);
+    modelo.loteSaidas.resize(static_cast<size_t>(numSaidas) * lote);
+    for (int r = 0; r < lote; r++) {
+        for (int i = 0; i < numEntradas; i++) {
+            modelo.loteEntradas[static_cast<size_t>(i) * lote + r] = modelo.entradas[static_cast<size_t>(r) * numEntradas + i];
+        }
+    }
+    modelo.rede.avaliarLote(modelo.loteEntradas.data(), lote, modelo.loteSaidas.data());
+    
+    std::vector<float> saidas(numSaidas);
+    std::vector<double> latencias(lote);
+    for (int r = 0; r < lote; r++) {
+        for (int o = 0; o < numSaidas; o++) {
+            saidas[o] = modelo.loteSaidas[static_cast<size_t>(o) * lote + r];
+        }
+        MensagemInferencia resposta;
+        resposta.tipo = MensagemInferencia::INFERENCIA;
+        resposta.modelo = static_cast<uint32_t>(&modelo - modelos.data());
+        resposta.id = modelo.pendentes[r].id;
+        resposta.quantidade = numSaidas;
+        responder(modelo.pendentes[r].cliente, resposta, saidas.data(), saidas.size() * sizeof(float));
+        latencias[r] = (agoraNs() - modelo.pendentes[r].chegadaNs) / 1000.0;
+    }
+    modelo.pendentes.clear();
+    modelo.entradas.clear();
+    
+    std::lock_guard<std::mutex> trava(mutexEstatisticas);
+    requisicoes += lote;
+    lotes++;
+    for (double latencia : latencias) {
+        latenciaP50.adicionar(latencia);
+        latenciaP99.adicionar(latencia);
+    }
+}
+
+void ServidorInferencia::processarVencidos(long long agora) {
+    const long long prazoNs = static_cast<long long>(config.prazoMicros) * 1000;
+    for (auto& modelo : modelos) {
+        if (!modelo.pendentes.empty() && agora - modelo.pendentes.front().chegadaNs >= prazoNs) {
+            processar(modelo);
+        }
+    }
+}
+
+void ServidorInferencia::armarTemporizador() {
+    long long proximo = -1;
+    for (const auto& modelo : modelos) {
+        if (modelo.pendentes.empty()) continue;
+        long long prazo = modelo.pendentes.front().chegadaNs + static_cast<long long>(config.prazoMicros) * 1000;
+        if (proximo < 0 || prazo < proximo) proximo = prazo;
+    }
+    
+    // Tempo relativo; 0 desarmaria o temporizador, então o mínimo é 1 ns
+    itimerspec especificacao;
+    std::memset(&especificacao, 0, sizeof(especificacao));
+    if (proximo >= 0) {
+        long long espera = std::max(1LL, proximo - agoraNs());
+        especificacao.it_value.tv_sec = espera / 1000000000LL;
+        especificacao.it_value.tv_nsec = espera % 1000000000LL;
+    }
+    timerfd_settime(temporizador, 0, &especificacao, nullptr);
+}
+
+void ServidorInferencia::responder(int cliente, const MensagemInferencia& cabecalho, const void* dados, size_t bytes) {
+    char pacote[sizeof(MensagemInferencia) + 256];
+    std::vector<char> grande;
+    char* destino = pacote;
+    if (sizeof(cabecalho) + bytes > sizeof(pacote)) {
+        grande.resize(sizeof(cabecalho) + bytes);
+        destino = grande.data();
+    }
+    std::memcpy(destino, &cabecalho, sizeof(cabecalho));
+    if (bytes > 0) {
+        std::memcpy(destino + sizeof(cabecalho), dados, bytes);
+    }
+    
+    // Sem bloquear: um cliente que não lê as respostas não atrasa os outros
+    if (send(cliente, destino, sizeof(cabecalho) + bytes, MSG_DONTWAIT | MSG_NOSIGNAL) < 0) {
+        std::lock_guard<std::mutex> trava(mutexEstatisticas);
+        descartadas++;
+    }
+}
+
+void ServidorInferencia::responderErro(int cliente, uint32_t id, const std::string& mensagem) {
+    MensagemInferencia resposta;
+    resposta.tipo = MensagemInferencia::ERRO;
+    resposta.modelo = 0;
+    resposta.id = id;
+    resposta.quantidade = static_cast<uint32_t>(mensagem.size());
+    responder(cliente, resposta, mensagem.data(), mensagem.size());
+}
+
+EstatisticasInferencia ServidorInferencia::obterEstatisticas() {
+    std::lock_guard<std::mutex> trava(mutexEstatisticas);
+    EstatisticasInferencia estatisticas;
+    estatisticas.requisicoes = requisicoes;
+    estatisticas.lotes = lotes;
+    estatisticas.descartadas = descartadas;
+    estatisticas.loteMedio = lotes > 0 ? static_cast<float>(requisicoes) / lotes : 0.0f;
+    estatisticas.latenciaP50Us = static_cast<float>(latenciaP50.obter());
+    estatisticas.latenciaP99Us = static_cast<float>(latenciaP99.obter());
+    double segundos = (agoraNs() - inicioNs) / 1e9;
+    estatisticas.requisicoesPorSegundo = segundos > 0 ? static_cast<float>(requisicoes / segundos) : 0.0f;
+    return estatisticas;
+}
+
+void ServidorInferencia::zerarEstatisticas() {
+    std::lock_guard<std::mutex> trava(mutexEstatisticas);
+    requisicoes = 0;
+    lotes = 0;
+    descartadas = 0;
+    inicioNs = agoraNs();
+    latenciaP50 = EstimadorQuantil(0.5);
+    latenciaP99 = EstimadorQuantil(0.99);
+}
+
+ClienteInferencia::ClienteInferencia(const std::string& caminhoSocket)
+    : socketCliente(-1), proximoId(1) {
+    sockaddr_un endereco = enderecoSocket(caminhoSocket);
+    socketCliente = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (socketCliente < 0 ||
+        connect(socketCliente, reinterpret_cast<sockaddr*>(&endereco), sizeof(endereco)) < 0) {
+        std::string erro = std::strerror(errno);
+        if (socketCliente >= 0) close(socketCliente);
+        throw std::runtime_error("Erro ao conectar em " + caminhoSocket + ": " + erro);
+    }
+}
+
+ClienteInferencia::~ClienteInferencia() {
+    if (socketCliente >= 0) close(socketCliente);
+}
+
+const MensagemInferencia& ClienteInferencia::trocar(const MensagemInferencia& requisicao, const float* dados,
+                                                    size_t& bytesDados) {
+    size_t bytes = requisicao.tipo == MensagemInferencia::INFERENCIA ? requisicao.quantidade * sizeof(float) : 0;
+    buffer.resize(std::max<size_t>(sizeof(requisicao) + bytes, 64 * 1024));
+    std::memcpy(buffer.data(), &requisicao, sizeof(requisicao));
+    if (bytes > 0) {
+        std::memcpy(buffer.data() + sizeof(requisicao), dados, bytes);
+    }
+    if (send(socketCliente, buffer.data(), sizeof(requisicao) + bytes, MSG_NOSIGNAL) < 0) {
+        throw std::runtime_error(std::string("Erro ao enviar requisição: ") + std::strerror(errno));
+    }
+    
+    while (true) {
+        ssize_t lidos = recv(socketCliente, buffer.data(), buffer.size(), 0);
+        if (lidos < 0 && errno == EINTR) continue;
+        if (lidos < static_cast<ssize_t>(sizeof(MensagemInferencia))) {
+            throw std::runtime_error("Conexão com o servidor de inferência encerrada");
+        }
+        const MensagemInferencia& resposta = *reinterpret_cast<const MensagemInferencia*>(buffer.data());
+        if (resposta.id != requisicao.id) continue;  // resposta atrasada de outra requisição
+        // 'quantidade' vem do servidor: o corpo nunca é lido além do que chegou
+        bytesDados = static_cast<size_t>(lidos) - sizeof(resposta);
+        if (resposta.tipo == MensagemInferencia::ERRO) {
+            throw std::runtime_error("Servidor de inferência: " +
+                std::string(buffer.data() + sizeof(resposta), std::min<size_t>(resposta.quantidade, bytesDados)));
+        }
+        return resposta;
+    }
+}
+
+std::vector<float> ClienteInferencia::inferir(int modelo, const std::vector<float>& entradas) {
+    MensagemInferencia requisicao;
+    requisicao.tipo = MensagemInferencia::INFERENCIA;
+    requisicao.modelo = static_cast<uint32_t>(modelo);
+    requisicao.id = proximoId++;
+    requisicao.quantidade = static_cast<uint32_t>(entradas.size());
+    size_t bytesDados = 0;
+    const MensagemInferencia& resposta = trocar(requisicao, entradas.data(), bytesDados);
+    if (resposta.quantidade > bytesDados / sizeof(float)) {
+        throw std::runtime_error("Resposta de inferência incompleta: " + std::to_string(resposta.quantidade) +
+                                 " saídas anunciadas, " + std::to_string(bytesDados) + " bytes recebidos");
+    }
+    
+    std::vector<float> saidas(resposta.quantidade);
+    std::memcpy(saidas.data(), buffer.data() + sizeof(resposta), saidas.size() * sizeof(float));
+    return saidas;
+}
+
+EstatisticasInferencia ClienteInferencia::obterEstatisticas() {
+    MensagemInferencia requisicao;
+    requisicao.tipo = MensagemInferencia::ESTATISTICAS;
+    requisicao.modelo = 0;
+    requisicao.id = proximoId++;
+    requisicao.quantidade = 0;
+    size_t bytesDados = 0;
+    const MensagemInferencia& resposta = trocar(requisicao, nullptr, bytesDados);
+    
+    EstatisticasInferencia estatisticas;
+    std::memset(&estatisticas, 0, sizeof(estatisticas));
+    std::memcpy(&estatisticas, buffer.data() + sizeof(resposta),
+                std::min({static_cast<size_t>(resposta.quantidade), bytesDados, sizeof(estatisticas)}));
+    return estatisticas;
+}
+
+} // namespace NEAT
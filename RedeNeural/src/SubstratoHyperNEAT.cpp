@@ -0,0 +1,133 @@
+#include "../include/SubstratoHyperNEAT.h"
+#include "../include/RedeEsparsa.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace NEAT {
+
+namespace {
+
+// Posições igualmente espaçadas em [-1, 1] (0 para um único ponto)
+float espacar(int i, int n) {
+    return n > 1 ? -1.0f + 2.0f * i / (n - 1) : 0.0f;
+}
+
+} // namespace
+
+SubstratoHyperNEAT::SubstratoHyperNEAT(const std::vector<int>& camadas, const Configuracao& config)
+    : config(config), camadas(camadas) {
+    if (camadas.size() < 2) {
+        throw std::invalid_argument("O substrato precisa de ao menos duas camadas");
+    }
+    for (size_t c = 0; c < camadas.size(); c++) {
+        coordenadasX.emplace_back(camadas[c]);
+        coordenadasY.emplace_back(camadas[c], 0.0f);
+        for (int i = 0; i < camadas[c]; i++) {
+            coordenadasX[c][i] = espacar(i, camadas[c]);
+        }
+    }
+}
+
+void SubstratoHyperNEAT::definirGrade(int camada, int largura) {
+    int n = camadas.at(camada);
+    largura = std::max(1, std::min(largura, n));
+    int altura = (n + largura - 1) / largura;
+    for (int i = 0; i < n; i++) {
+        coordenadasX[camada][i] = espacar(i % largura, largura);
+        coordenadasY[camada][i] = espacar(i / largura, altura);
+    }
+}
+
+void SubstratoHyperNEAT::definirCoordenadas(int camada, const std::vector<float>& x, const std::vector<float>& y) {
+    int n = camadas.at(camada);
+    if (static_cast<int>(x.size()) != n || static_cast<int>(y.size()) != n) {
+        throw std::invalid_argument("Número de coordenadas diferente do tamanho da camada");
+    }
+    coordenadasX[camada] = x;
+    coordenadasY[camada] = y;
+}
+
+int SubstratoHyperNEAT::obterQuantidadePesos() const {
+    int total = 0;
+    for (size_t c = 1; c < camadas.size(); c++) {
+        total += camadas[c] * (camadas[c - 1] + 1);
+    }
+    return total;
+}
+
+void SubstratoHyperNEAT::configurarCPPN(Rede& cppn) {
+    const auto& nos = cppn.obterNos();
+    for (size_t i = 0; i < nos.size(); i++) {
+        if (nos[i].camada == 2) {
+            cppn.definirAtivacao(static_cast<int>(i), TipoAtivacao::TANH);
+        }
+    }
+}
+
+void SubstratoHyperNEAT::gerarPesos(const Rede& cppn, std::vector<double>& pesos) const {
+    pesos.resize(obterQuantidadePesos());
+    gerarPesos(cppn, pesos.data());
+}
+
+void SubstratoHyperNEAT::gerarPesos(const Rede& cppn, double* pesos) const {
+    RedeEsparsa plano(cppn);
+    if (plano.obterNumEntradas() < NUM_ENTRADAS_CPPN || plano.obterNumSaidas() < 1) {
+        throw std::invalid_argument("A CPPN precisa de 5 entradas (x1, y1, x2, y2, distância) e ao menos uma saída");
+    }
+    const int numEntradas = plano.obterNumEntradas();
+    const int numSaidas = plano.obterNumSaidas();
+    const int lote = std::max(1, config.tamanhoLote);
+    const float limiar = config.limiarExpressao;
+    const float escala = config.escalaPeso / std::max(1e-6f, 1.0f - limiar);
+
+    // Entradas extras da CPPN (se houver) ficam em zero
+    std::vector<float> entradas(static_cast<size_t>(numEntradas) * lote, 0.0f);
+    std::vector<float> saidas(static_cast<size_t>(numSaidas) * lote);
+
+    for (size_t c = 1; c < camadas.size(); c++) {
+        const std::vector<float>& xOrigem = coordenadasX[c - 1];
+        const std::vector<float>& yOrigem = coordenadasY[c - 1];
+        const std::vector<float>& xDestino = coordenadasX[c];
+        const std::vector<float>& yDestino = coordenadasY[c];
+        const int numOrigem = camadas[c - 1];
+        const int largura = numOrigem + 1;  // a última coluna da linha é o bias
+        const long long total = static_cast<long long>(camadas[c]) * largura;
+        const int saida = numSaidas > 1 ? std::min(static_cast<int>(c) - 1, numSaidas - 1) : 0;
+
+        // Consulta q = destino * largura + origem: a ordem das linhas do layout.
+        // O bias (origem == numOrigem) é a consulta de (0, 0) até o destino.
+        for (long long inicio = 0; inicio < total; inicio += lote) {
+            const int quantidade = static_cast<int>(std::min<long long>(lote, total - inicio));
+            float* x1 = entradas.data();
+            float* y1 = x1 + lote;
+            float* x2 = y1 + lote;
+            float* y2 = x2 + lote;
+            float* distancia = y2 + lote;
+            for (int q = 0; q < quantidade; q++) {
+                long long consulta = inicio + q;
+                int destino = static_cast<int>(consulta / largura);
+                int origem = static_cast<int>(consulta % largura);
+                x1[q] = origem < numOrigem ? xOrigem[origem] : 0.0f;
+                y1[q] = origem < numOrigem ? yOrigem[origem] : 0.0f;
+                x2[q] = xDestino[destino];
+                y2[q] = yDestino[destino];
+                float dx = x2[q] - x1[q];
+                float dy = y2[q] - y1[q];
+                distancia[q] = std::sqrt(dx * dx + dy * dy);
+            }
+            // O lote é sempre cheio; o resto do último fica com valores antigos e é ignorado
+            plano.avaliarLote(entradas.data(), lote, saidas.data());
+
+            const float* valores = saidas.data() + static_cast<size_t>(saida) * lote;
+            for (int q = 0; q < quantidade; q++) {
+                float valor = valores[q];
+                float magnitude = std::abs(valor) - limiar;
+                pesos[inicio + q] = magnitude > 0.0f ? std::copysign(magnitude * escala, valor) : 0.0;
+            }
+        }
+        pesos += total;
+    }
+}
+
+} // namespace NEAT
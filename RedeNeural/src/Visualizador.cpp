@@ -1,96 +1,197 @@
-#include "../include/Visualizador.h"
-#include <map>
-#include <algorithm>
-
-namespace NEAT {
-
-Visualizador::Visualizador(SDL_Renderer* renderer, const SDL_Rect& area, 
-                         const Configuracao& config)
-    : renderer(renderer), area(area), config(config) {
-}
-
-void Visualizador::renderizar(const Rede& rede) {
-    // Desenhar fundo
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-    SDL_SetRenderDrawColor(renderer, 
-        config.corFundo.r, config.corFundo.g, 
-        config.corFundo.b, config.corFundo.a);
-    SDL_RenderFillRect(renderer, &area);
-    
-    const auto& nos = rede.obterNos();
-    const auto& conexoes = rede.obterConexoes();
-    
-    // Calcular posições dos nós
-    std::map<int, SDL_Point> posicoes;
-    std::vector<std::vector<const No*>> camadasNos(3);
-    
-    // Organizar nós por camada
-    for (const auto& no : nos) {
-        camadasNos[no.camada].push_back(&no);
-    }
-    
-    // Posicionar nós
-    for (int camada = 0; camada < 3; camada++) {
-        float x = area.x + (camada * area.w / 2);
-        float espacoY = area.h / (camadasNos[camada].size() + 1);
-        
-        for (size_t i = 0; i < camadasNos[camada].size(); i++) {
-            float y = area.y + ((i + 1) * espacoY);
-            posicoes[camadasNos[camada][i]->id] = {
-                static_cast<int>(x),
-                static_cast<int>(y)
-            };
-        }
-    }
-    
-    // Desenhar conexões
-    for (const auto& conexao : conexoes) {
-        if (!conexao.ativo) continue;
-        
-        auto itInicio = posicoes.find(conexao.deNo);
-        auto itFim = posicoes.find(conexao.paraNo);
-        
-        if (itInicio != posicoes.end() && itFim != posicoes.end()) {
-            // Cor baseada no peso
-            Uint8 r = conexao.peso < 0 ? 255 : 0;
-            Uint8 g = conexao.peso > 0 ? 255 : 0;
-            SDL_SetRenderDrawColor(renderer, r, g, 0, 255);
-            
-            SDL_RenderDrawLine(renderer,
-                itInicio->second.x, itInicio->second.y,
-                itFim->second.x, itFim->second.y);
-        }
-    }
-    
-    // Desenhar nós
-    for (const auto& [id, pos] : posicoes) {
-        auto it = std::find_if(nos.begin(), nos.end(),
-            [id](const No& n) { return n.id == id; });
-            
-        if (it != nos.end()) {
-            SDL_Color cor;
-            switch (it->camada) {
-                case 0: cor = config.corEntrada; break;
-                case 1: cor = config.corOculta; break;
-                case 2: cor = config.corSaida; break;
-            }
-            
-            SDL_SetRenderDrawColor(renderer, cor.r, cor.g, cor.b, cor.a);
-            
-            SDL_Rect noRect = {
-                pos.x - config.raioNo,
-                pos.y - config.raioNo,
-                config.raioNo * 2,
-                config.raioNo * 2
-            };
-            SDL_RenderFillRect(renderer, &noRect);
-            
-            if (config.mostrarBordas) {
-                SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
-                SDL_RenderDrawRect(renderer, &noRect);
-            }
-        }
-    }
-}
-
-} // namespace NEAT 
\ No newline at end of file
+#include "../include/Visualizador.h"
+#include <cmath>
+#include <unordered_map>
+
+namespace NEAT {
+
+namespace {
+
+// Acesso às conexões igual para o vetor do snapshot e para as colunas da Rede
+int numConexoes(const std::vector<Conexao>& conexoes) { return static_cast<int>(conexoes.size()); }
+int numConexoes(const GenomaCompacto& genoma) { return genoma.tamanho(); }
+Conexao lerConexao(const std::vector<Conexao>& conexoes, int i) { return conexoes[i]; }
+Conexao lerConexao(const GenomaCompacto& genoma, int i) { return genoma.conexao(i); }
+float lerPeso(const std::vector<Conexao>& conexoes, int i) { return conexoes[i].peso; }
+float lerPeso(const GenomaCompacto& genoma, int i) { return genoma.peso(i); }
+
+template <typename Nos, typename Conexoes>
+size_t calcularHashTopologia(const Nos& nos, const Conexoes& conexoes) {
+    // FNV-1a sobre o que define o layout: nós (id, camada) e conexões ativas
+    size_t hash = 1469598103934665603ULL;
+    auto misturar = [&hash](int valor) {
+        hash ^= static_cast<size_t>(static_cast<unsigned int>(valor));
+        hash *= 1099511628211ULL;
+    };
+    
+    for (const auto& no : nos) {
+        misturar(no.id);
+        misturar(no.camada);
+    }
+    for (int c = 0; c < numConexoes(conexoes); c++) {
+        const Conexao conexao = lerConexao(conexoes, c);
+        misturar(conexao.deNo);
+        misturar(conexao.paraNo);
+        misturar(conexao.ativo ? 1 : 0);
+    }
+    return hash;
+}
+
+void adicionarQuad(std::vector<SDL_Vertex>& vertices, std::vector<int>& indices,
+                   SDL_FPoint a, SDL_FPoint b, SDL_FPoint c, SDL_FPoint d, SDL_Color cor) {
+    int base = static_cast<int>(vertices.size());
+    vertices.push_back({a, cor, {0, 0}});
+    vertices.push_back({b, cor, {0, 0}});
+    vertices.push_back({c, cor, {0, 0}});
+    vertices.push_back({d, cor, {0, 0}});
+    
+    const int quad[6] = {0, 1, 2, 0, 2, 3};
+    for (int i : quad) {
+        indices.push_back(base + i);
+    }
+}
+
+void adicionarRetangulo(std::vector<SDL_Vertex>& vertices, std::vector<int>& indices,
+                        float x, float y, float w, float h, SDL_Color cor) {
+    adicionarQuad(vertices, indices,
+        {x, y}, {x + w, y}, {x + w, y + h}, {x, y + h}, cor);
+}
+
+} // namespace
+
+Visualizador::Visualizador(SDL_Renderer* renderer, const SDL_Rect& area, 
+                         const Configuracao& config)
+    : renderer(renderer), area(area), config(config),
+      cacheValido(false), hashTopologia(0) {
+}
+
+template <typename Nos, typename Conexoes>
+void Visualizador::reconstruirGeometria(const Nos& nos, const Conexoes& conexoes) {
+    verticesConexoes.clear();
+    indicesConexoes.clear();
+    verticesNos.clear();
+    indicesNos.clear();
+    conexoesDesenhadas.clear();
+    
+    // Organizar nós por camada
+    std::vector<std::vector<const No*>> camadasNos(3);
+    for (const auto& no : nos) {
+        camadasNos[no.camada].push_back(&no);
+    }
+    
+    // Posicionar nós
+    std::unordered_map<int, SDL_FPoint> posicoes;
+    for (int camada = 0; camada < 3; camada++) {
+        float x = area.x + (camada * area.w / 2);
+        float espacoY = area.h / (camadasNos[camada].size() + 1);
+        
+        for (size_t i = 0; i < camadasNos[camada].size(); i++) {
+            float y = area.y + ((i + 1) * espacoY);
+            posicoes[camadasNos[camada][i]->id] = {
+                static_cast<float>(static_cast<int>(x)),
+                static_cast<float>(static_cast<int>(y))
+            };
+        }
+    }
+    
+    // Conexões como quads finos; a cor é preenchida por atualizarCoresConexoes
+    for (int c = 0; c < numConexoes(conexoes); c++) {
+        const Conexao conexao = lerConexao(conexoes, c);
+        if (!conexao.ativo) continue;
+        
+        auto itInicio = posicoes.find(conexao.deNo);
+        auto itFim = posicoes.find(conexao.paraNo);
+        if (itInicio == posicoes.end() || itFim == posicoes.end()) continue;
+        
+        SDL_FPoint a = itInicio->second;
+        SDL_FPoint b = itFim->second;
+        float dx = b.x - a.x;
+        float dy = b.y - a.y;
+        float comprimento = std::sqrt(dx * dx + dy * dy);
+        if (comprimento <= 0.0f) continue;
+        
+        // Meio pixel para cada lado da linha
+        float nx = -dy / comprimento * 0.5f;
+        float ny = dx / comprimento * 0.5f;
+        adicionarQuad(verticesConexoes, indicesConexoes,
+            {a.x + nx, a.y + ny}, {b.x + nx, b.y + ny},
+            {b.x - nx, b.y - ny}, {a.x - nx, a.y - ny}, {0, 0, 0, 255});
+        conexoesDesenhadas.push_back(c);
+    }
+    
+    // Nós: borda branca seguida do preenchimento, na ordem das camadas
+    for (int camada = 0; camada < 3; camada++) {
+        SDL_Color cor;
+        switch (camada) {
+            case 0: cor = config.corEntrada; break;
+            case 1: cor = config.corOculta; break;
+            default: cor = config.corSaida; break;
+        }
+        
+        for (const No* no : camadasNos[camada]) {
+            SDL_FPoint pos = posicoes[no->id];
+            float x = pos.x - config.raioNo;
+            float y = pos.y - config.raioNo;
+            float lado = config.raioNo * 2.0f;
+            
+            if (config.mostrarBordas) {
+                adicionarRetangulo(verticesNos, indicesNos, x, y, lado, lado, {255, 255, 255, 255});
+                adicionarRetangulo(verticesNos, indicesNos, x + 1, y + 1, lado - 2, lado - 2, cor);
+            } else {
+                adicionarRetangulo(verticesNos, indicesNos, x, y, lado, lado, cor);
+            }
+        }
+    }
+    
+    hashTopologia = calcularHashTopologia(nos, conexoes);
+    cacheValido = true;
+}
+
+template <typename Conexoes>
+void Visualizador::atualizarCoresConexoes(const Conexoes& conexoes) {
+    // Os pesos mudam sem alterar a topologia: só as cores são reescritas
+    for (size_t i = 0; i < conexoesDesenhadas.size(); i++) {
+        float peso = lerPeso(conexoes, conexoesDesenhadas[i]);
+        Uint8 r = peso < 0 ? 255 : 0;
+        Uint8 g = peso > 0 ? 255 : 0;
+        for (int v = 0; v < 4; v++) {
+            verticesConexoes[i * 4 + v].color = {r, g, 0, 255};
+        }
+    }
+}
+
+template <typename Nos, typename Conexoes>
+void Visualizador::renderizar(const Nos& nos, const Conexoes& conexoes) {
+    // Desenhar fundo
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 
+        config.corFundo.r, config.corFundo.g, 
+        config.corFundo.b, config.corFundo.a);
+    SDL_RenderFillRect(renderer, &area);
+    
+    if (!cacheValido || calcularHashTopologia(nos, conexoes) != hashTopologia) {
+        reconstruirGeometria(nos, conexoes);
+    }
+    atualizarCoresConexoes(conexoes);
+    
+    // Uma chamada para todas as conexões e outra para todos os nós
+    if (!indicesConexoes.empty()) {
+        SDL_RenderGeometry(renderer, nullptr,
+            verticesConexoes.data(), static_cast<int>(verticesConexoes.size()),
+            indicesConexoes.data(), static_cast<int>(indicesConexoes.size()));
+    }
+    if (!indicesNos.empty()) {
+        SDL_RenderGeometry(renderer, nullptr,
+            verticesNos.data(), static_cast<int>(verticesNos.size()),
+            indicesNos.data(), static_cast<int>(indicesNos.size()));
+    }
+}
+
+void Visualizador::renderizar(const Rede& rede) {
+    renderizar(rede.obterNos(), rede.obterGenomaCompacto());
+}
+
+void Visualizador::renderizar(const SnapshotRede& snapshot) {
+    renderizar(snapshot.nos, snapshot.conexoes);
+}
+
+} // namespace NEAT
@@ -0,0 +1,29 @@
+#pragma once
+#include <cstdio>
+#include <iostream>
+
+// Verificações mínimas dos testes: cada falha é impressa e o teste termina
+// com código diferente de zero (veja resultado()). A biblioteca escreve em
+// std::wcout, então os testes também: misturar printf e wcout na mesma saída
+// perde texto.
+inline int& falhasVerificacao() {
+    static int falhas = 0;
+    return falhas;
+}
+
+#define VERIFICAR(condicao) \
+    do { \
+        if (!(condicao)) { \
+            std::fprintf(stderr, "%s:%d: falhou: %s\n", __FILE__, __LINE__, #condicao); \
+            falhasVerificacao()++; \
+        } \
+    } while (0)
+
+inline int resultado(const char* nome) {
+    if (falhasVerificacao() == 0) {
+        std::wcout << nome << L": ok" << std::endl;
+        return 0;
+    }
+    std::wcout << nome << L": " << falhasVerificacao() << L" falha(s)" << std::endl;
+    return 1;
+}
@@ -0,0 +1,132 @@
+#include "../include/AgendadorCorrida.h"
+#include "Verificacao.h"
+#include <cmath>
+#include <map>
+#include <vector>
+
+using namespace NEAT;
+
+// Cada rede ganha 'taxa' de aptidão por passo (a taxa vai no bias do nó 0)
+struct Registro {
+    int episodios = 0;
+    int passosUltimoEpisodio = 0;
+    float ultimoRetorno = 0;
+};
+
+static std::vector<Rede> criarRedes(const std::vector<float>& taxas) {
+    std::vector<Rede> redes;
+    for (float taxa : taxas) {
+        redes.emplace_back(2, 1);
+        redes.back().definirBias(0, taxa);
+    }
+    return redes;
+}
+
+static std::function<float(Rede&, ContextoAvaliacao&)> episodioLinear(std::map<float, Registro>& registros) {
+    return [&registros](Rede& rede, ContextoAvaliacao& contexto) {
+        const float taxa = rede.obterNos()[0].bias;
+        float pontuacao = 0;
+        while (true) {
+            pontuacao += taxa;
+            if (!contexto.passo(pontuacao)) break;
+        }
+        Registro& registro = registros[taxa];
+        registro.episodios++;
+        registro.passosUltimoEpisodio = contexto.obterPassos();
+        registro.ultimoRetorno = pontuacao;
+        return pontuacao;
+    };
+}
+
+// Com o ganho máximo por passo conhecido, quem não alcança mais o corte para
+// no meio do primeiro episódio e fica com a pontuação parcial que a função
+// retornou; quem disputa o corte recebe todos os passos e todos os episódios
+static void testarCortePorPasso() {
+    AgendadorCorrida::Configuracao config;
+    config.orcamentoPassos = 100;
+    config.ganhoMaximoPorPasso = 1.0f;
+    config.fracaoSobrevivencia = 0.2f;  // k = 2 em 10
+    config.episodiosMinimos = 1;
+    config.episodiosMaximos = 3;
+    AgendadorCorrida agendador(config);
+
+    // As duas primeiras definem o corte (80); depois dela a 0.95 o sobe para 90
+    const std::vector<float> taxas = {0.9f, 0.8f, 0.1f, 0.95f, 0.5f, 0.85f, 0.2f, 0.3f, 0.4f, 0.6f};
+    std::vector<Rede> redes = criarRedes(taxas);
+    std::map<float, Registro> registros;
+    agendador.avaliar(redes, episodioLinear(registros));
+
+    for (size_t i = 0; i < taxas.size(); i++) {
+        const Registro& registro = registros[taxas[i]];
+        const bool sobrevive = i < 2 || taxas[i] == 0.95f;
+        if (sobrevive) {
+            VERIFICAR(registro.episodios == config.episodiosMaximos);
+            VERIFICAR(registro.passosUltimoEpisodio == config.orcamentoPassos);
+        } else {
+            VERIFICAR(registro.episodios == 1);
+            VERIFICAR(registro.passosUltimoEpisodio < config.orcamentoPassos);
+        }
+        // Cortada ou não, a aptidão é a média dos retornos: para a cortada,
+        // a pontuação parcial do episódio interrompido
+        VERIFICAR(redes[i].obterAptidao() == registro.ultimoRetorno);
+    }
+    // Corte 80 com ganho 1 por passo: a 0.1 para no passo 23 (0.1p + 100 - p < 80)
+    VERIFICAR(registros[0.1f].passosUltimoEpisodio == 23);
+    VERIFICAR(std::abs(redes[2].obterAptidao() - 2.3f) < 1e-4f);
+    // Corte 90 depois da 0.95: a 0.85 já não alcança e para no passo 67
+    VERIFICAR(registros[0.85f].passosUltimoEpisodio == 67);
+
+    const AgendadorCorrida::Estatisticas& estatisticas = agendador.obterEstatisticas();
+    VERIFICAR(estatisticas.avaliacoes == 10);
+    VERIFICAR(estatisticas.cortadas == 7);
+    VERIFICAR(estatisticas.episodios == 3 * 3 + 7);
+}
+
+// Sem ganho máximo conhecido não há corte no meio do episódio: quem termina
+// abaixo do corte fica só nos episódios mínimos, quem está acima recebe os extras
+static void testarEpisodiosExtras() {
+    AgendadorCorrida::Configuracao config;
+    config.orcamentoPassos = 50;
+    config.fracaoSobrevivencia = 0.25f;  // k = 1 em 4
+    config.episodiosMinimos = 2;
+    config.episodiosMaximos = 4;
+    AgendadorCorrida agendador(config);
+
+    const std::vector<float> taxas = {0.5f, 0.2f, 0.7f, 0.6f};
+    std::vector<Rede> redes = criarRedes(taxas);
+    std::map<float, Registro> registros;
+    agendador.avaliar(redes, episodioLinear(registros));
+
+    VERIFICAR(registros[0.5f].episodios == 4);
+    VERIFICAR(registros[0.2f].episodios == 2);
+    VERIFICAR(registros[0.7f].episodios == 4);
+    VERIFICAR(registros[0.6f].episodios == 2);  // abaixo do corte de 0.7
+    for (const auto& par : registros) VERIFICAR(par.second.passosUltimoEpisodio == 50);
+    VERIFICAR(agendador.obterEstatisticas().cortadas == 0);
+}
+
+// Com espécies, ninguém é cortado enquanto puder ser o melhor da própria espécie
+static void testarEspecies() {
+    AgendadorCorrida::Configuracao config;
+    config.orcamentoPassos = 100;
+    config.ganhoMaximoPorPasso = 1.0f;
+    config.fracaoSobrevivencia = 0.25f;
+    AgendadorCorrida agendador(config);
+
+    const std::vector<float> taxas = {0.9f, 0.1f, 0.2f, 0.05f};
+    const std::vector<int> especies = {0, 1, 0, 1};
+    std::vector<Rede> redes = criarRedes(taxas);
+    std::map<float, Registro> registros;
+    agendador.avaliar(redes, episodioLinear(registros), especies);
+
+    VERIFICAR(registros[0.1f].passosUltimoEpisodio == 100);  // primeira da espécie 1
+    VERIFICAR(registros[0.2f].passosUltimoEpisodio < 100);   // espécie 0 já tem 0.9
+    VERIFICAR(registros[0.05f].passosUltimoEpisodio < 100);  // não passa a 0.1 da espécie 1
+}
+
+int main() {
+    testarCortePorPasso();
+    testarEpisodiosExtras();
+    testarEspecies();
+    return resultado("teste_agendador_corrida");
+}
@@ -0,0 +1,158 @@
+#include "../include/Rede.h"
+#include "Verificacao.h"
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+using namespace NEAT;
+
+static std::string arquivoTemporario(const char* nome) {
+    return std::string("/tmp/neat_teste_") + nome + "_" + std::to_string(::getpid()) + ".bin";
+}
+
+static std::vector<float> avaliar(Rede& rede, const std::vector<float>& entradas) {
+    rede.definirEntradas(entradas);
+    rede.avaliar();
+    return rede.obterSaidas();
+}
+
+// Bias, ativações e conexões voltam iguais e a rede carregada avalia igual
+static void testarIdaEVolta() {
+    std::mt19937 gerador(3);
+    GerenciadorInovacao inovacoes;
+    Rede rede(3, 2, inovacoes, gerador);
+    rede.adicionarNo(1, TipoAtivacao::GAUSSIANA);
+    rede.adicionarNo(1, TipoAtivacao::RELU);
+    rede.adicionarConexao(0, 5, 0.8f, inovacoes);
+    rede.adicionarConexao(5, 6, -1.2f, inovacoes);
+    rede.adicionarConexao(6, 3, 0.5f, inovacoes);
+    rede.definirBias(5, 0.25f);
+    rede.definirBias(3, -0.75f);
+    rede.definirAtivacao(4, TipoAtivacao::TANH);
+
+    const std::string arquivo = arquivoTemporario("ida_volta");
+    rede.salvar(arquivo);
+    Rede carregada;
+    carregada.carregar(arquivo);
+    std::remove(arquivo.c_str());
+
+    VERIFICAR(carregada.obterNos().size() == rede.obterNos().size());
+    VERIFICAR(carregada.obterGenomaCompacto().tamanho() == rede.obterGenomaCompacto().tamanho());
+    for (size_t i = 0; i < rede.obterNos().size() && i < carregada.obterNos().size(); i++) {
+        VERIFICAR(carregada.obterNos()[i].id == rede.obterNos()[i].id);
+        VERIFICAR(carregada.obterNos()[i].bias == rede.obterNos()[i].bias);
+        VERIFICAR(carregada.obterNos()[i].ativacao == rede.obterNos()[i].ativacao);
+    }
+    VERIFICAR(carregada.obterProximoIdNo() == rede.obterProximoIdNo());
+    const std::vector<float> entradas = {0.3f, -0.6f, 0.9f};
+    VERIFICAR(avaliar(carregada, entradas) == avaliar(rede, entradas));
+}
+
+// Arquivo da versão sem assinatura: No era {id, camada, valor}
+static void testarFormatoAntigo() {
+    struct NoAntigo {
+        int id;
+        int camada;
+        float valor;
+    };
+    const std::vector<NoAntigo> nos = {{0, 0, 0.0f}, {1, 0, 0.0f}, {2, 2, 0.0f}, {3, 1, 0.0f}};
+    const std::vector<Conexao> conexoes = {{0, 3, 0.5f, true, 0}, {1, 3, -0.25f, true, 1}, {3, 2, 2.0f, true, 2}};
+
+    const std::string arquivo = arquivoTemporario("antigo");
+    {
+        std::ofstream out(arquivo, std::ios::binary);
+        size_t numNos = nos.size(), numConexoes = conexoes.size();
+        out.write(reinterpret_cast<const char*>(&numNos), sizeof(numNos));
+        out.write(reinterpret_cast<const char*>(nos.data()), numNos * sizeof(NoAntigo));
+        out.write(reinterpret_cast<const char*>(&numConexoes), sizeof(numConexoes));
+        out.write(reinterpret_cast<const char*>(conexoes.data()), numConexoes * sizeof(Conexao));
+    }
+    Rede rede;
+    rede.carregar(arquivo);
+    std::remove(arquivo.c_str());
+
+    VERIFICAR(rede.obterNos().size() == 4);
+    VERIFICAR(rede.obterGenomaCompacto().tamanho() == 3);
+    VERIFICAR(rede.obterProximoIdNo() == 4);
+    for (const No& no : rede.obterNos()) {
+        VERIFICAR(no.bias == 0.0f);
+        VERIFICAR(no.ativacao == (no.camada == 2 ? TipoAtivacao::SIGMOIDE : TipoAtivacao::IDENTIDADE));
+    }
+    // Oculto sem ativação: 2 * (0.5 * 1 - 0.25 * 1) = 0.5 na entrada da sigmoide
+    const std::vector<float> saidas = avaliar(rede, {1.0f, 1.0f});
+    VERIFICAR(saidas.size() == 1 && std::abs(saidas[0] - 1.0f / (1.0f + std::exp(-0.5f))) < 1e-4f);
+}
+
+// Arquivo truncado é recusado sem alterar a rede
+static void testarArquivoIncompleto() {
+    const std::string arquivo = arquivoTemporario("incompleto");
+    {
+        std::ofstream out(arquivo, std::ios::binary);
+        out.write("NEATRD02", 8);
+        size_t numNos = 10;
+        out.write(reinterpret_cast<const char*>(&numNos), sizeof(numNos));
+    }
+    Rede rede(2, 1);
+    bool recusado = false;
+    try {
+        rede.carregar(arquivo);
+    } catch (const std::runtime_error&) {
+        recusado = true;
+    }
+    std::remove(arquivo.c_str());
+    VERIFICAR(recusado);
+    VERIFICAR(rede.obterNos().size() == 3);
+}
+
+static bool recusa(const std::string& arquivo, Rede& rede) {
+    try {
+        rede.carregar(arquivo);
+    } catch (const std::runtime_error&) {
+        return true;
+    }
+    return false;
+}
+
+// Contagens maiores que o arquivo e ativações fora do enum são recusadas
+// antes de alocar, sem bad_alloc
+static void testarArquivoCorrompido() {
+    const std::string arquivo = arquivoTemporario("corrompido");
+    Rede rede(2, 1);
+    for (size_t numConexoes : {size_t(1) << 60, size_t(3)}) {
+        std::ofstream out(arquivo, std::ios::binary);
+        out.write("NEATRD02", 8);
+        size_t numNos = 1;
+        int32_t campos[2] = {0, 0};
+        float bias = 0.0f;
+        int32_t ativacao = numConexoes == 3 ? 99 : 0;
+        out.write(reinterpret_cast<const char*>(&numNos), sizeof(numNos));
+        out.write(reinterpret_cast<const char*>(campos), sizeof(campos));
+        out.write(reinterpret_cast<const char*>(&bias), sizeof(bias));
+        out.write(reinterpret_cast<const char*>(&ativacao), sizeof(ativacao));
+        out.write(reinterpret_cast<const char*>(&numConexoes), sizeof(numConexoes));
+        out.close();
+        VERIFICAR(recusa(arquivo, rede));
+    }
+    {
+        std::ofstream out(arquivo, std::ios::binary);
+        out.write("NEATRD02", 8);
+        size_t numNos = ~size_t(0);
+        out.write(reinterpret_cast<const char*>(&numNos), sizeof(numNos));
+    }
+    VERIFICAR(recusa(arquivo, rede));
+    std::remove(arquivo.c_str());
+    VERIFICAR(rede.obterNos().size() == 3);
+}
+
+int main() {
+    testarIdaEVolta();
+    testarFormatoAntigo();
+    testarArquivoIncompleto();
+    testarArquivoCorrompido();
+    return resultado("teste_arquivo_rede");
+}
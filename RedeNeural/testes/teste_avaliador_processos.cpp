@@ -0,0 +1,79 @@
+#include "../include/AvaliadorProcessos.h"
+#include "Verificacao.h"
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+using namespace NEAT;
+
+static const int GENOMA_QUEDA = 3;        // o trabalhador sempre morre com _exit
+static const int GENOMA_TRAVADO = 5;      // nunca termina: só o tempo limite o tira
+static const int GENOMA_QUEDA_UNICA = 6;  // morre na primeira tentativa e depois avalia
+
+// Cada rede carrega o próprio índice no bias do nó 0, que passa pela
+// serialização até o trabalhador
+static int indiceDe(const Rede& rede) {
+    return static_cast<int>(std::lround(rede.obterNos()[0].bias));
+}
+
+// Genomas que derrubam ou travam o trabalhador recebem a aptidão de falha
+// depois das tentativas; os outros chegam todos, inclusive o que só falhou
+// uma vez e foi reenviado
+static void testarQuedaETempoLimite() {
+    const std::string marcador = "/tmp/neat_teste_queda_" + std::to_string(::getpid());
+    std::remove(marcador.c_str());
+
+    auto avaliar = [&marcador](Rede& rede) -> float {
+        const int indice = indiceDe(rede);
+        if (indice == GENOMA_QUEDA) _exit(3);
+        if (indice == GENOMA_TRAVADO) {
+            while (true) pause();
+        }
+        if (indice == GENOMA_QUEDA_UNICA && !std::ifstream(marcador)) {
+            std::ofstream(marcador) << "caiu";
+            _exit(4);
+        }
+        return 10.0f + indice;
+    };
+
+    AvaliadorProcessos::Configuracao config;
+    config.numTrabalhadores = 3;
+    config.tempoLimiteMs = 200;
+    config.maxTentativas = 1;
+    config.aptidaoFalha = -7.0f;
+    AvaliadorProcessos avaliador(avaliar, config);
+
+    std::vector<Rede> redes;
+    for (int i = 0; i < 10; i++) {
+        redes.emplace_back(2, 1);
+        redes.back().definirBias(0, static_cast<float>(i));
+        redes.back().definirAptidao(-1.0f);
+    }
+    avaliador.avaliar(redes);
+
+    for (int i = 0; i < 10; i++) {
+        if (i == GENOMA_QUEDA || i == GENOMA_TRAVADO) {
+            VERIFICAR(redes[i].obterAptidao() == config.aptidaoFalha);
+        } else {
+            VERIFICAR(redes[i].obterAptidao() == 10.0f + i);
+        }
+    }
+    // Duas tentativas para cada genoma perdido e uma queda do genoma reenviado
+    VERIFICAR(avaliador.obterTemposEsgotados() == 2);
+    VERIFICAR(avaliador.obterReinicios() == 5);
+
+    // Os trabalhadores reiniciados continuam atendendo avaliações seguintes
+    std::vector<Rede> outras(4, Rede(2, 1));
+    for (int i = 0; i < 4; i++) outras[i].definirBias(0, 20.0f + i);
+    avaliador.avaliar(outras);
+    for (int i = 0; i < 4; i++) VERIFICAR(outras[i].obterAptidao() == 30.0f + i);
+    std::remove(marcador.c_str());
+}
+
+int main() {
+    testarQuedaETempoLimite();
+    return resultado("teste_avaliador_processos");
+}
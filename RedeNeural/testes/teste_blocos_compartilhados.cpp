@@ -0,0 +1,79 @@
+#include "../include/BlocosCompartilhados.h"
+#include "Verificacao.h"
+#include <vector>
+
+using namespace NEAT;
+
+using Vetor = BlocosCompartilhados<int, 4>;
+
+static std::vector<int> sequencia(int n) {
+    std::vector<int> valores(n);
+    for (int i = 0; i < n; i++) valores[i] = i;
+    return valores;
+}
+
+// Editar um filho não muda o pai nem os irmãos, e só o bloco editado é duplicado
+static void testarEdicao() {
+    const std::vector<int> original = sequencia(10);
+    Vetor pai(original);
+    Vetor filho = pai;
+    Vetor irmao = pai;
+    VERIFICAR(filho.bytesExclusivos() == 0);
+
+    filho.editar(5) = -1;
+    VERIFICAR(pai.paraVetor() == original);
+    VERIFICAR(irmao.paraVetor() == original);
+    VERIFICAR(filho[5] == -1);
+    VERIFICAR(filho.bytesExclusivos() == 4 * sizeof(int));
+
+    // O pai editado depois não muda os filhos
+    pai.editar(0) = 100;
+    VERIFICAR(filho[0] == 0);
+    VERIFICAR(irmao[0] == 0);
+    VERIFICAR(irmao.paraVetor() == original);
+}
+
+// push_back num bloco final compartilhado e truncar numa cópia não alteram as outras
+static void testarTamanho() {
+    const std::vector<int> original = sequencia(10);
+    Vetor pai(original);
+    Vetor maior = pai;
+    Vetor menor = pai;
+
+    maior.push_back(10);  // o último bloco (8, 9) é compartilhado
+    menor.truncar(6);
+    menor.push_back(-6);  // reescreve a posição 6 de um bloco compartilhado
+
+    VERIFICAR(pai.size() == 10);
+    VERIFICAR(pai.paraVetor() == original);
+    VERIFICAR(maior.paraVetor() == sequencia(11));
+    std::vector<int> esperado = sequencia(6);
+    esperado.push_back(-6);
+    VERIFICAR(menor.paraVetor() == esperado);
+
+    menor.clear();
+    VERIFICAR(menor.empty());
+    VERIFICAR(pai.paraVetor() == original);
+}
+
+// Atribuir a uma cópia troca só os blocos dela
+static void testarAtribuicao() {
+    const std::vector<int> original = sequencia(7);
+    Vetor pai(original);
+    Vetor filho = pai;
+    filho.atribuir(sequencia(3));
+    VERIFICAR(pai.paraVetor() == original);
+    VERIFICAR(filho.paraVetor() == sequencia(3));
+
+    std::vector<int> copia(pai.size());
+    pai.copiarPara(copia.data());
+    VERIFICAR(copia == original);
+    VERIFICAR(std::vector<int>(pai.begin(), pai.end()) == original);
+}
+
+int main() {
+    testarEdicao();
+    testarTamanho();
+    testarAtribuicao();
+    return resultado("teste_blocos_compartilhados");
+}
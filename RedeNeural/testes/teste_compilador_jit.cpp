@@ -0,0 +1,95 @@
+#include "../include/CompiladorJIT.h"
+#include "Verificacao.h"
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace NEAT;
+
+static Rede montarRede(unsigned semente) {
+    std::mt19937 gerador(semente);
+    GerenciadorInovacao inovacoes;
+    Rede rede(3, 2, inovacoes, gerador);
+    rede.adicionarNo(1, TipoAtivacao::RELU);
+    rede.adicionarConexao(0, 5, 0.75f, inovacoes);
+    rede.adicionarConexao(5, 3, -1.25f, inovacoes);
+    return rede;
+}
+
+static int contarArquivos(const std::string& diretorio) {
+    int quantidade = 0;
+    if (DIR* d = opendir(diretorio.c_str())) {
+        while (dirent* entrada = readdir(d)) {
+            if (entrada->d_name[0] != '.') quantidade++;
+        }
+        closedir(d);
+    }
+    return quantidade;
+}
+
+// Diretório privado (0700) mesmo dentro de um diretório com espaço no nome,
+// sem arquivos deixados para trás e removido pelo destrutor
+static void testarDiretorioPrivado() {
+    char modelo[] = "/tmp/neat teste jit XXXXXX";
+    VERIFICAR(mkdtemp(modelo) != nullptr);
+    CompiladorJIT::Configuracao config;
+    config.diretorio = modelo;
+
+    std::string privado;
+    {
+        CompiladorJIT jit(config);
+        if (!jit.estaDisponivel()) {
+            std::wcout << L"teste_compilador_jit: sem compilador C, ignorado" << std::endl;
+            rmdir(modelo);
+            return;
+        }
+        privado = jit.obterDiretorio();
+        struct stat info;
+        VERIFICAR(stat(privado.c_str(), &info) == 0);
+        VERIFICAR((info.st_mode & 0777) == 0700);
+        VERIFICAR(info.st_uid == getuid());
+
+        Rede rede = montarRede(1);
+        RedeEsparsa plano(rede);
+        CompiladorJIT::FuncaoCompilada funcao = jit.compilar(plano);
+        VERIFICAR(funcao != nullptr);
+        VERIFICAR(contarArquivos(privado) == 0);
+        if (funcao) {
+            float entradas[3] = {0.5f, -0.25f, 1.0f};
+            float nativo[2], interpretado[2];
+            funcao(entradas, nativo);
+            plano.avaliar(entradas, interpretado);
+            VERIFICAR(nativo[0] == interpretado[0] || std::abs(nativo[0] - interpretado[0]) < 1e-5f);
+            VERIFICAR(nativo[1] == interpretado[1] || std::abs(nativo[1] - interpretado[1]) < 1e-5f);
+        }
+
+        // Mesmo código: vem do cache em memória
+        VERIFICAR(jit.compilar(RedeEsparsa(rede)) == funcao);
+        VERIFICAR(jit.obterCompilacoes() == 1);
+        VERIFICAR(jit.obterAcertosCache() == 1);
+    }
+    VERIFICAR(access(privado.c_str(), F_OK) != 0);
+    VERIFICAR(rmdir(modelo) == 0);
+}
+
+// Opções com metacaracteres de shell chegam ao compilador como argumentos
+// comuns: a compilação falha, mas nada é executado pelo shell
+static void testarSemShell() {
+    CompiladorJIT::Configuracao config;
+    config.opcoes = "-O2 ;touch /tmp/neat_jit_injetado";
+    CompiladorJIT jit(config);
+    if (!jit.estaDisponivel()) return;
+    Rede rede = montarRede(2);
+    VERIFICAR(jit.compilar(RedeEsparsa(rede)) == nullptr);
+    VERIFICAR(access("/tmp/neat_jit_injetado", F_OK) != 0);
+}
+
+int main() {
+    testarDiretorioPrivado();
+    testarSemShell();
+    return resultado("teste_compilador_jit");
+}
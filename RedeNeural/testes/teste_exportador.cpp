@@ -0,0 +1,170 @@
+#include "../include/ExportadorCodigo.h"
+#include "../include/Rede.h"
+#include "Verificacao.h"
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+#include <dlfcn.h>
+#include <unistd.h>
+
+using namespace NEAT;
+
+// O código gerado faz as contas de Rede::avaliar na mesma ordem, com as mesmas
+// aproximações de Ativacoes; a tolerância só cobre o compilador contrair
+// multiplicação e soma em FMA (o cc em modo GNU faz isso onde há FMA)
+const float TOLERANCIA = 1e-6f;
+
+using FuncaoExportada = void (*)(const float* entradas, float* saidas);
+
+// Grava os arquivos num diretório temporário, compila o primeiro como
+// biblioteca compartilhada e devolve 'simbolo'; nullptr se a compilação falhar
+static FuncaoExportada compilar(const std::string& compilador,
+                                const std::vector<std::pair<std::string, std::string>>& arquivos,
+                                const std::string& simbolo) {
+    char modelo[] = "/tmp/neat_teste_XXXXXX";
+    if (!mkdtemp(modelo)) return nullptr;
+    const std::string diretorio = modelo;
+    for (const auto& [nome, codigo] : arquivos) {
+        std::ofstream out(diretorio + "/" + nome);
+        out << codigo;
+    }
+    const std::string biblioteca = diretorio + "/exportado.so";
+    const std::string comando = compilador + " -O2 -shared -fPIC -o '" + biblioteca + "' '" +
+                                diretorio + "/" + arquivos[0].first + "' -lm";
+    const bool compilou = std::system(comando.c_str()) == 0;
+    void* handle = compilou ? dlopen(biblioteca.c_str(), RTLD_NOW | RTLD_LOCAL) : nullptr;
+
+    // A biblioteca já carregada continua válida depois de apagada
+    std::system(("rm -rf '" + diretorio + "'").c_str());
+    return handle ? reinterpret_cast<FuncaoExportada>(dlsym(handle, simbolo.c_str())) : nullptr;
+}
+
+// Código C gerado para 'rede', compilado
+static FuncaoExportada compilarC(const Rede& rede) {
+    return compilar("cc", {{"exportado.c", ExportadorCodigo::gerar(rede, "exportado", ExportadorCodigo::Linguagem::C)}},
+                    "exportado");
+}
+
+// Cabeçalho C++ gerado para 'rede', incluído por uma função extern "C" para o dlsym
+static FuncaoExportada compilarCpp(const Rede& rede) {
+    const std::string principal =
+        "#include \"exportado.h\"\n"
+        "extern \"C\" void avaliar_exportado(const float* e, float* s) { exportado::avaliar(e, s); }\n";
+    return compilar("c++ -std=c++17", {{"principal.cpp", principal}, {"exportado.h", ExportadorCodigo::gerar(rede, "exportado")}},
+                    "avaliar_exportado");
+}
+
+// Rede acíclica com ocultos de todas as ativações, bias, conexões paralelas e
+// uma conexão chegando numa entrada (que a avaliação ignora)
+static Rede montarRede(unsigned semente) {
+    const int numEntradas = 4, numSaidas = 2, numOcultos = 12;
+    std::mt19937 gerador(semente);
+    std::uniform_real_distribution<float> distribuicao(-1.5f, 1.5f);
+    GerenciadorInovacao inovacoes;
+    Rede rede(numEntradas, numSaidas, inovacoes, gerador);
+
+    for (int h = 0; h < numOcultos; h++) {
+        rede.adicionarNo(1, static_cast<TipoAtivacao>(h % static_cast<int>(TipoAtivacao::NUM_TIPOS)));
+    }
+    // Ordem topológica: entradas, ocultos na ordem em que entraram, saídas
+    std::vector<int> ordem;
+    for (int i = 0; i < numEntradas; i++) ordem.push_back(i);
+    for (int h = 0; h < numOcultos; h++) ordem.push_back(numEntradas + numSaidas + h);
+    for (int o = 0; o < numSaidas; o++) ordem.push_back(numEntradas + o);
+
+    for (size_t a = 0; a < ordem.size(); a++) {
+        for (size_t b = std::max<size_t>(a + 1, numEntradas); b < ordem.size(); b++) {
+            if (gerador() % 3 == 0) rede.adicionarConexao(ordem[a], ordem[b], distribuicao(gerador), inovacoes);
+        }
+    }
+    rede.adicionarConexao(ordem[numEntradas], ordem.back(), distribuicao(gerador), inovacoes);
+    rede.adicionarConexao(ordem[numEntradas], ordem.back(), distribuicao(gerador), inovacoes);
+    rede.adicionarConexao(numEntradas, 0, distribuicao(gerador), inovacoes);
+
+    for (size_t i = numEntradas; i < rede.obterNos().size(); i++) {
+        rede.definirBias(static_cast<int>(i), distribuicao(gerador));
+    }
+    return rede;
+}
+
+// Maior diferença entre o código gerado e Rede::avaliar em entradas aleatórias
+static float compararComRede(Rede& rede, FuncaoExportada funcao) {
+    std::mt19937 gerador(99);
+    std::uniform_real_distribution<float> distribuicao(-2.0f, 2.0f);
+    std::vector<float> entradas(rede.obterNos().size());
+    std::vector<float> saidas(RedeEsparsa(rede).obterNumSaidas());
+    float maiorDiferenca = 0.0f;
+    for (int amostra = 0; amostra < 500; amostra++) {
+        for (float& x : entradas) x = distribuicao(gerador);
+        rede.definirEntradas(entradas.data(), RedeEsparsa(rede).obterNumEntradas());
+        rede.avaliar();
+        funcao(entradas.data(), saidas.data());
+        for (size_t i = 0; i < saidas.size(); i++) {
+            float diferenca = std::abs(saidas[i] - rede.obterSaidas()[i]);
+            if (std::isnan(saidas[i]) != std::isnan(rede.obterSaidas()[i])) diferenca = INFINITY;
+            if (!std::isnan(diferenca)) maiorDiferenca = std::max(maiorDiferenca, diferenca);
+        }
+    }
+    return maiorDiferenca;
+}
+
+static void testarCodigoGerado() {
+    for (unsigned semente = 1; semente <= 5; semente++) {
+        Rede rede = montarRede(semente);
+        VERIFICAR(!RedeEsparsa(rede).possuiRecorrencia());
+
+        FuncaoExportada funcaoC = compilarC(rede);
+        VERIFICAR(funcaoC != nullptr);
+        if (funcaoC) {
+            float diferenca = compararComRede(rede, funcaoC);
+            std::wcout << L"C   (semente " << semente << L"): maior desvio " << diferenca << std::endl;
+            VERIFICAR(diferenca <= TOLERANCIA);
+        }
+
+        FuncaoExportada funcaoCpp = compilarCpp(rede);
+        VERIFICAR(funcaoCpp != nullptr);
+        if (funcaoCpp) {
+            float diferenca = compararComRede(rede, funcaoCpp);
+            std::wcout << L"C++ (semente " << semente << L"): maior desvio " << diferenca << std::endl;
+            VERIFICAR(diferenca <= TOLERANCIA);
+        }
+    }
+}
+
+// Pesos NaN e infinitos viram literais válidos e saturam como no interpretador
+static void testarValoresNaoFinitos() {
+    Rede rede = montarRede(7);
+    std::vector<Conexao> conexoes = rede.obterGenomaCompacto().paraConexoes();
+    conexoes[0].peso = NAN;
+    conexoes[1].peso = INFINITY;
+    conexoes[2].peso = -INFINITY;
+    rede.definirConexoes(conexoes);
+
+    for (FuncaoExportada funcao : {compilarC(rede), compilarCpp(rede)}) {
+        VERIFICAR(funcao != nullptr);
+        if (funcao) VERIFICAR(compararComRede(rede, funcao) <= TOLERANCIA);
+    }
+}
+
+static void testarNomeInvalido() {
+    Rede rede = montarRede(1);
+    for (const char* nome : {"", "1rede", "minha-rede", "a b", "rede;"}) {
+        bool rejeitado = false;
+        try {
+            ExportadorCodigo::gerar(rede, nome);
+        } catch (const std::runtime_error&) {
+            rejeitado = true;
+        }
+        VERIFICAR(rejeitado);
+    }
+}
+
+int main() {
+    testarCodigoGerado();
+    testarValoresNaoFinitos();
+    testarNomeInvalido();
+    return resultado("teste_exportador");
+}
@@ -0,0 +1,106 @@
+#include "../include/GenomaCompacto.h"
+#include "../include/Rede.h"
+#include "Verificacao.h"
+#include <random>
+#include <vector>
+
+using namespace NEAT;
+
+static bool ordenadoPorInovacao(const GenomaCompacto& genoma) {
+    for (int i = 1; i < genoma.tamanho(); i++) {
+        if (genoma.inovacao(i) < genoma.inovacao(i - 1)) return false;
+    }
+    return true;
+}
+
+// Conexões pendentes ficam no fim e, numeradas, voltam para a ordem por
+// inovação, inclusive quando o número já existia e é menor que o último
+static void testarPendentes() {
+    GerenciadorInovacao inovacoes;
+    std::mt19937 gerador(1);
+    Rede rede(3, 2, inovacoes, gerador);
+    rede.adicionarNo(1);
+    rede.adicionarConexao(0, 5, 0.5f, GerenciadorInovacao::PENDENTE);
+    rede.adicionarConexao(5, 3, -0.5f, GerenciadorInovacao::PENDENTE);
+    rede.adicionarConexao(1, 3, 0.1f, inovacoes);  // já existe: inovação 2
+
+    const GenomaCompacto& genoma = rede.obterGenomaCompacto();
+    VERIFICAR(genoma.tamanho() == 9);
+    VERIFICAR(genoma.inovacao(genoma.tamanho() - 1) == GerenciadorInovacao::PENDENTE);
+
+    const int esperada = inovacoes.obterInovacao(0, 5);
+    rede.resolverInovacoes(inovacoes);
+    VERIFICAR(ordenadoPorInovacao(genoma));
+    VERIFICAR(genoma.inovacao(genoma.tamanho() - 2) == esperada);
+    VERIFICAR(genoma.origem(genoma.tamanho() - 1) == 5);
+    VERIFICAR(genoma.contarAtivos() == 9);
+}
+
+// Copiar o genoma compartilha as colunas; mudar um peso duplica só o bloco de pesos
+static void testarCompartilhamento() {
+    GenomaCompacto pai;
+    for (int i = 0; i < 200; i++) {
+        pai.adicionar(i, i % 7, 7 + i % 5, 0.01f * i, i % 3 != 0);
+    }
+    GenomaCompacto filho = pai;
+    VERIFICAR(filho.bytesExclusivos() == 0);
+
+    filho.definirPeso(70, 9.0f);
+    filho.definirAtivo(0, true);
+    VERIFICAR(filho.peso(70) == 9.0f);
+    VERIFICAR(pai.peso(70) == 0.01f * 70);
+    VERIFICAR(!pai.ativo(0) && filho.ativo(0));
+    VERIFICAR(filho.bytesExclusivos() == 64 * sizeof(float) + 64 * sizeof(uint64_t));
+    VERIFICAR(filho.bytesExclusivos() < pai.bytesUsados() / 4);
+}
+
+// Resolver pendentes descarta o fim das colunas: bits de conexões descartadas
+// não podem sobrar ativos
+static void testarBitsAposResolver() {
+    GenomaCompacto genoma;
+    for (int i = 0; i < 60; i++) genoma.adicionar(i, 0, 1, 1.0f, true);
+    for (int i = 0; i < 10; i++) genoma.adicionar(GerenciadorInovacao::PENDENTE, 2, 1, 1.0f, i % 2 == 0);
+    VERIFICAR(genoma.contarAtivos() == 65);
+
+    int proxima = 100;
+    genoma.resolverPendentes([&proxima](int, int) { return proxima++; });
+    VERIFICAR(genoma.tamanho() == 70);
+    VERIFICAR(genoma.contarAtivos() == 65);
+    VERIFICAR(genoma.inovacao(60) == 100 && genoma.ativo(60) && !genoma.ativo(61));
+}
+
+// Ids acima de 16 bits passam as colunas de extremos para 32 bits sem perder dados
+static void testarIdsLargos() {
+    GenomaCompacto genoma;
+    genoma.adicionar(0, 1, 2, 0.5f, true);
+    VERIFICAR(genoma.usaIds16());
+    genoma.adicionar(1, 70000, 3, 0.5f, false);
+    VERIFICAR(!genoma.usaIds16());
+    VERIFICAR(genoma.origem(0) == 1 && genoma.destino(0) == 2);
+    VERIFICAR(genoma.origem(1) == 70000 && !genoma.ativo(1));
+}
+
+// Disjuntos e excedentes vêm só de 'estrutura'
+static void testarCruzamento() {
+    GenomaCompacto estrutura, outro;
+    for (int i : {0, 1, 3, 5}) estrutura.adicionar(i, 0, 1, 1.0f, true);
+    for (int i : {0, 2, 3, 4, 6, 7}) outro.adicionar(i, 0, 1, 2.0f, true);
+
+    std::mt19937 gerador(5);
+    GenomaCompacto filho;
+    GenomaCompacto::cruzar(estrutura, outro, gerador, filho);
+    VERIFICAR(filho.tamanho() == 4);
+    for (int i = 0; i < filho.tamanho(); i++) {
+        VERIFICAR(filho.inovacao(i) == estrutura.inovacao(i));
+    }
+    VERIFICAR(filho.peso(1) == 1.0f && filho.peso(3) == 1.0f);
+}
+
+int main() {
+    testarPendentes();
+    testarCompartilhamento();
+    testarBitsAposResolver();
+    testarIdsLargos();
+    testarCruzamento();
+    return resultado("teste_genoma_compacto");
+}
@@ -0,0 +1,138 @@
+#include "../include/HallDaFama.h"
+#include "Verificacao.h"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+using namespace NEAT;
+
+static std::string arquivoTemporario(const char* nome) {
+    return std::string("/tmp/neat_teste_") + nome + "_" + std::to_string(::getpid()) + ".bin";
+}
+
+static void removerArquivo(const std::string& arquivo) {
+    std::remove(arquivo.c_str());
+    std::remove((arquivo + ".indice").c_str());
+}
+
+// Redes distintas (pesos diferentes), com aptidão crescente
+static std::vector<Rede> criarRedes(int quantidade) {
+    std::mt19937 gerador(4);
+    GerenciadorInovacao inovacoes;
+    std::vector<Rede> redes;
+    for (int i = 0; i < quantidade; i++) {
+        redes.emplace_back(3, 2, inovacoes, gerador);
+        redes.back().adicionarNo(1, TipoAtivacao::GAUSSIANA);
+        redes.back().definirBias(5, 0.1f * i);
+        redes.back().definirAptidao(static_cast<float>(i));
+    }
+    return redes;
+}
+
+// O que foi guardado volta igual ao reabrir, na ordem de aptidão
+static void testarReabrir() {
+    const std::string arquivo = arquivoTemporario("hall_reabrir");
+    removerArquivo(arquivo);
+    std::vector<Rede> redes = criarRedes(4);
+    HallDaFama::Configuracao config;
+    config.arquivo = arquivo;
+    {
+        HallDaFama hall(config);
+        for (int i = 0; i < 4; i++) VERIFICAR(hall.adicionar(redes[i], i));
+        VERIFICAR(!hall.adicionar(redes[2], 9));
+    }
+
+    HallDaFama hall(config);
+    VERIFICAR(hall.tamanho() == 4);
+    std::vector<HallDaFama::Entrada> entradas = hall.melhores(4);
+    std::vector<Rede> carregadas = hall.carregarMelhores(4);
+    VERIFICAR(carregadas.size() == 4);
+    for (int i = 0; i < 4 && i < static_cast<int>(carregadas.size()); i++) {
+        const Rede& original = redes[3 - i];
+        VERIFICAR(entradas[i].aptidao == original.obterAptidao());
+        VERIFICAR(entradas[i].geracao == 3 - i);
+        VERIFICAR(carregadas[i].obterAptidao() == original.obterAptidao());
+        VERIFICAR(HallDaFama::calcularHash(carregadas[i]) == HallDaFama::calcularHash(original));
+        VERIFICAR(carregadas[i].obterNos().size() == original.obterNos().size());
+    }
+    removerArquivo(arquivo);
+}
+
+// Registros gravados depois do último índice são recuperados; o último,
+// cortado no meio, é descartado e o arquivo volta a aceitar genomas
+static void testarCaudaTruncada() {
+    const std::string arquivo = arquivoTemporario("hall_truncado");
+    removerArquivo(arquivo);
+    std::vector<Rede> redes = criarRedes(5);
+    HallDaFama::Configuracao config;
+    config.arquivo = arquivo;
+    const std::string indiceAntigo = arquivo + ".indice.antigo";
+    {
+        HallDaFama hall(config);
+        hall.adicionar(redes[0], 0);
+        hall.adicionar(redes[1], 1);
+        hall.sincronizar();
+        std::filesystem::copy_file(arquivo + ".indice", indiceAntigo,
+                                   std::filesystem::copy_options::overwrite_existing);
+        hall.adicionar(redes[2], 2);
+        hall.adicionar(redes[3], 3);
+    }
+    // Execução interrompida: índice de antes dos dois últimos e o último pela metade
+    std::filesystem::rename(indiceAntigo, arquivo + ".indice");
+    const uintmax_t tamanhoCompleto = std::filesystem::file_size(arquivo);
+    std::filesystem::resize_file(arquivo, tamanhoCompleto - 10);
+
+    {
+        HallDaFama hall(config);
+        VERIFICAR(hall.tamanho() == 3);
+        VERIFICAR(hall.contem(redes[2]));
+        VERIFICAR(!hall.contem(redes[3]));
+        VERIFICAR(std::filesystem::file_size(arquivo) < tamanhoCompleto - 10);
+        VERIFICAR(hall.carregarMelhores(3).size() == 3);
+        VERIFICAR(hall.adicionar(redes[4], 4));
+    }
+
+    HallDaFama hall(config);
+    VERIFICAR(hall.tamanho() == 4);
+    std::vector<Rede> carregadas = hall.carregarMelhores(4);
+    VERIFICAR(carregadas.size() == 4);
+    if (carregadas.size() == 4) {
+        VERIFICAR(HallDaFama::calcularHash(carregadas[0]) == HallDaFama::calcularHash(redes[4]));
+        VERIFICAR(HallDaFama::calcularHash(carregadas[1]) == HallDaFama::calcularHash(redes[2]));
+    }
+    removerArquivo(arquivo);
+}
+
+// Arquivo da versão com a cópia direta de No é recusado, não lido como lixo
+static void testarVersaoAntiga() {
+    const std::string arquivo = arquivoTemporario("hall_antigo");
+    removerArquivo(arquivo);
+    {
+        std::ofstream out(arquivo, std::ios::binary);
+        out.write("NEATHAL1", 8);
+        const char registro[64] = {};
+        out.write(registro, sizeof(registro));
+    }
+    HallDaFama::Configuracao config;
+    config.arquivo = arquivo;
+    bool recusado = false;
+    try {
+        HallDaFama hall(config);
+    } catch (const std::runtime_error&) {
+        recusado = true;
+    }
+    VERIFICAR(recusado);
+    removerArquivo(arquivo);
+}
+
+int main() {
+    testarReabrir();
+    testarCaudaTruncada();
+    testarVersaoAntiga();
+    return resultado("teste_hall_da_fama");
+}
@@ -0,0 +1,66 @@
+#include "../include/Metricas.h"
+#include "../include/Populacao.h"
+#include "Verificacao.h"
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+using namespace NEAT;
+
+static void evoluirComRegistro(const std::string& arquivo, int geracoes) {
+    RegistroMetricas::Configuracao configMetricas;
+    configMetricas.arquivo = arquivo;
+    RegistroMetricas metricas(configMetricas);
+
+    Populacao::Configuracao config;
+    config.tamanhoPopulacao = 20;
+    config.semente = 7;
+    config.logDetalhado = false;
+    Populacao populacao(2, 1, config);
+    populacao.definirRegistroMetricas(&metricas);
+    for (int g = 0; g < geracoes; g++) {
+        populacao.avaliarPopulacao([](Rede& rede) { return 1.0f + rede.obterGenomaCompacto().peso(0); });
+        populacao.evoluir();
+    }
+    metricas.parar();
+}
+
+// Uma gravação interrompida deixa um bloco incompleto no fim; ao continuar o
+// log ele é descartado e os blocos novos continuam alinhados
+static void testarBlocoIncompleto() {
+    const std::string arquivo = "/tmp/neat_teste_metricas_" + std::to_string(::getpid()) + ".bin";
+    std::remove(arquivo.c_str());
+    std::remove((arquivo + ".especies").c_str());
+
+    evoluirComRegistro(arquivo, 3);
+    VERIFICAR(LeitorMetricas::lerColuna(arquivo, "geracao").size() == 3);
+    {
+        // Cabeçalho de um bloco de 5 linhas com só parte da primeira coluna
+        std::ofstream out(arquivo, std::ios::binary | std::ios::app);
+        const uint32_t linhas = 5;
+        const float parcial[3] = {90.0f, 91.0f, 92.0f};
+        out.write(reinterpret_cast<const char*>(&linhas), sizeof(linhas));
+        out.write(reinterpret_cast<const char*>(parcial), sizeof(parcial));
+    }
+
+    evoluirComRegistro(arquivo, 2);
+    const std::vector<float> geracoes = LeitorMetricas::lerColuna(arquivo, "geracao");
+    const std::vector<float> individuos = LeitorMetricas::lerColuna(arquivo, "individuos");
+    VERIFICAR(geracoes.size() == 5);
+    VERIFICAR(individuos.size() == 5);
+    if (geracoes.size() == 5) {
+        const float esperadas[5] = {0, 1, 2, 0, 1};
+        for (int i = 0; i < 5; i++) VERIFICAR(geracoes[i] == esperadas[i]);
+    }
+    for (float valor : individuos) VERIFICAR(valor == 20.0f);
+
+    std::remove(arquivo.c_str());
+    std::remove((arquivo + ".especies").c_str());
+}
+
+int main() {
+    testarBlocoIncompleto();
+    return resultado("teste_metricas");
+}
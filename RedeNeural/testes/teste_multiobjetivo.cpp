@@ -0,0 +1,88 @@
+#include "../include/Populacao.h"
+#include "../include/SelecaoMultiobjetivo.h"
+#include "Verificacao.h"
+#include <random>
+#include <vector>
+
+using namespace NEAT;
+
+// Frentes pela definição: a frente de cada um é 1 + a maior frente de quem o domina
+static std::vector<int> frentesPorForcaBruta(const std::vector<float>& objetivos, int numObjetivos) {
+    const int n = static_cast<int>(objetivos.size()) / numObjetivos;
+    std::vector<int> frente(n, -1);
+    for (int atribuidos = 0, f = 0; atribuidos < n; f++) {
+        std::vector<int> novos;
+        for (int i = 0; i < n; i++) {
+            if (frente[i] >= 0) continue;
+            bool dominado = false;
+            for (int j = 0; j < n && !dominado; j++) {
+                dominado = j != i && (frente[j] < 0 || frente[j] == f) &&
+                           SelecaoMultiobjetivo::domina(&objetivos[j * numObjetivos],
+                                                        &objetivos[i * numObjetivos], numObjetivos);
+            }
+            if (!dominado) novos.push_back(i);
+        }
+        for (int i : novos) frente[i] = f;
+        atribuidos += static_cast<int>(novos.size());
+    }
+    return frente;
+}
+
+// A ordenação com dois e com três objetivos dá as frentes da definição, e as
+// versões float e double (a de Redeneural_2) concordam
+static void testarFrentes() {
+    std::mt19937 gerador(11);
+    std::uniform_int_distribution<int> valor(0, 9);  // valores repetidos de propósito
+    for (int numObjetivos : {2, 3}) {
+        std::vector<float> objetivos(200 * numObjetivos);
+        for (float& v : objetivos) v = static_cast<float>(valor(gerador));
+        std::vector<double> objetivosDouble(objetivos.begin(), objetivos.end());
+
+        std::vector<int> esperadas = frentesPorForcaBruta(objetivos, numObjetivos);
+        auto classificacao = SelecaoMultiobjetivo::classificar(objetivos, numObjetivos);
+        auto classificacaoDouble = classificarPareto(objetivosDouble, numObjetivos);
+        for (size_t i = 0; i < esperadas.size(); i++) {
+            VERIFICAR(classificacao[i].frente == esperadas[i]);
+            VERIFICAR(classificacaoDouble[i].frente == esperadas[i]);
+        }
+    }
+}
+
+// A aptidão medida continua sendo o primeiro objetivo; a posição de Pareto
+// fica só na aptidão de seleção
+static void testarAptidaoSeparada() {
+    Populacao::Configuracao config;
+    config.tamanhoPopulacao = 30;
+    config.semente = 3;
+    config.logDetalhado = false;
+    Populacao populacao(2, 1, config);
+
+    auto objetivosDe = [](Rede& rede, float* objetivos) {
+        objetivos[0] = 10.0f + rede.obterGenomaCompacto().peso(0);
+        objetivos[1] = -rede.obterGenomaCompacto().peso(1);
+    };
+    populacao.avaliarPopulacao(objetivosDe, 2);
+
+    const auto& individuos = populacao.obterIndividuos();
+    const auto& objetivos = populacao.obterObjetivos();
+    const auto& classificacao = populacao.obterClassificacao();
+    float maiorPrimeiro = objetivos[0];
+    for (size_t i = 0; i < individuos.size(); i++) {
+        VERIFICAR(individuos[i].obterAptidao() == objetivos[i * 2]);
+        maiorPrimeiro = std::max(maiorPrimeiro, objetivos[i * 2]);
+        for (size_t j = 0; j < individuos.size(); j++) {
+            if (classificacao[i].frente < classificacao[j].frente) {
+                VERIFICAR(individuos[i].obterAptidaoSelecao() > individuos[j].obterAptidaoSelecao());
+            }
+        }
+    }
+
+    populacao.evoluir();
+    VERIFICAR(populacao.obterMelhorAptidao() == maiorPrimeiro);
+}
+
+int main() {
+    testarFrentes();
+    testarAptidaoSeparada();
+    return resultado("teste_multiobjetivo");
+}
@@ -0,0 +1,89 @@
+#include "../include/Populacao.h"
+#include "Verificacao.h"
+#include <cstring>
+#include <vector>
+
+using namespace NEAT;
+
+static float avaliarXor(Rede& rede) {
+    static const float casos[4][3] = {{0, 0, 0}, {0, 1, 1}, {1, 0, 1}, {1, 1, 0}};
+    float erro = 0.0f;
+    for (const auto& caso : casos) {
+        rede.definirEntradas(caso, 2);
+        rede.avaliar();
+        float diferenca = rede.obterSaidas()[0] - caso[2];
+        erro += diferenca * diferenca;
+    }
+    return 4.0f - erro;
+}
+
+static std::vector<Rede> evoluir(int threads, int fatorPool, int geracoes) {
+    Populacao::Configuracao config;
+    config.tamanhoPopulacao = 60;
+    config.threadsReproducao = threads;
+    config.fatorPoolSubstituto = fatorPool;
+    config.semente = 1234;
+    config.logDetalhado = false;
+
+    Populacao populacao(2, 1, config);
+    for (int g = 0; g < geracoes; g++) {
+        populacao.avaliarPopulacao(avaliarXor);
+        populacao.evoluir();
+    }
+    return populacao.obterIndividuos();
+}
+
+static bool nosIguais(const Rede& a, const Rede& b) {
+    std::vector<No> nosA = a.obterNos().paraVetor();
+    std::vector<No> nosB = b.obterNos().paraVetor();
+    if (nosA.size() != nosB.size()) return false;
+    for (size_t i = 0; i < nosA.size(); i++) {
+        if (nosA[i].id != nosB[i].id || nosA[i].camada != nosB[i].camada ||
+            nosA[i].ativacao != nosB[i].ativacao ||
+            std::memcmp(&nosA[i].bias, &nosB[i].bias, sizeof(float)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool conexoesIguais(const Rede& a, const Rede& b) {
+    const GenomaCompacto& genomaA = a.obterGenomaCompacto();
+    const GenomaCompacto& genomaB = b.obterGenomaCompacto();
+    if (genomaA.tamanho() != genomaB.tamanho()) return false;
+    for (int i = 0; i < genomaA.tamanho(); i++) {
+        float pesoA = genomaA.peso(i), pesoB = genomaB.peso(i);
+        if (genomaA.inovacao(i) != genomaB.inovacao(i) || genomaA.origem(i) != genomaB.origem(i) ||
+            genomaA.destino(i) != genomaB.destino(i) || genomaA.ativo(i) != genomaB.ativo(i) ||
+            std::memcmp(&pesoA, &pesoB, sizeof(float)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// A população depois de várias gerações é a mesma, bit a bit, com uma ou
+// várias threads de reprodução: cada vaga tem o seu gerador e as inovações
+// são numeradas em ordem de vaga
+static void testarMesmaPopulacao(int fatorPool) {
+    const int geracoes = 8;
+    std::vector<Rede> sequencial = evoluir(1, fatorPool, geracoes);
+    for (int threads : {2, 4, 7}) {
+        std::vector<Rede> paralela = evoluir(threads, fatorPool, geracoes);
+        VERIFICAR(paralela.size() == sequencial.size());
+        if (paralela.size() != sequencial.size()) continue;
+        int diferentes = 0;
+        for (size_t i = 0; i < sequencial.size(); i++) {
+            if (!nosIguais(sequencial[i], paralela[i]) || !conexoesIguais(sequencial[i], paralela[i])) {
+                diferentes++;
+            }
+        }
+        VERIFICAR(diferentes == 0);
+    }
+}
+
+int main() {
+    testarMesmaPopulacao(1);
+    testarMesmaPopulacao(3);  // com o modelo substituto pré-selecionando filhos
+    return resultado("teste_reproducao_paralela");
+}
@@ -0,0 +1,181 @@
+#include "../include/ServidorInferencia.h"
+#include "Verificacao.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace NEAT;
+
+static std::string caminhoTemporario(const char* nome) {
+    return std::string("/tmp/neat_teste_") + nome + "_" + std::to_string(::getpid());
+}
+
+static std::string salvarModelo() {
+    std::mt19937 gerador(2);
+    GerenciadorInovacao inovacoes;
+    Rede rede(3, 2, inovacoes, gerador);
+    const std::string arquivo = caminhoTemporario("modelo") + ".bin";
+    rede.salvar(arquivo);
+    return arquivo;
+}
+
+// Um arquivo comum no caminho do socket não é apagado e iniciar() falha
+static void testarArquivoPreservado(const std::string& modelo) {
+    ServidorInferencia::Configuracao config;
+    config.caminhoSocket = caminhoTemporario("nao_socket");
+    std::ofstream(config.caminhoSocket) << "dados";
+
+    ServidorInferencia servidor(config);
+    servidor.adicionarModelo(modelo);
+    bool falhou = false;
+    try {
+        servidor.iniciar();
+    } catch (const std::runtime_error&) {
+        falhou = true;
+    }
+    servidor.parar();
+    VERIFICAR(falhou);
+    std::ifstream in(config.caminhoSocket);
+    std::string conteudo;
+    in >> conteudo;
+    VERIFICAR(conteudo == "dados");
+    std::remove(config.caminhoSocket.c_str());
+}
+
+// Um socket antigo (de uma execução interrompida) é substituído, e o servidor
+// remove o seu ao parar
+static void testarSocketAntigo(const std::string& modelo) {
+    ServidorInferencia::Configuracao config;
+    config.caminhoSocket = caminhoTemporario("antigo") + ".sock";
+    int antigo = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+    sockaddr_un endereco = {};
+    endereco.sun_family = AF_UNIX;
+    std::snprintf(endereco.sun_path, sizeof(endereco.sun_path), "%s", config.caminhoSocket.c_str());
+    VERIFICAR(bind(antigo, reinterpret_cast<sockaddr*>(&endereco), sizeof(endereco)) == 0);
+    close(antigo);
+
+    ServidorInferencia servidor(config);
+    servidor.adicionarModelo(modelo);
+    servidor.iniciar();
+    {
+        ClienteInferencia cliente(config.caminhoSocket);
+        std::vector<float> saidas = cliente.inferir(0, {0.5f, -0.25f, 1.0f});
+        VERIFICAR(saidas.size() == 2);
+        for (float saida : saidas) VERIFICAR(std::isfinite(saida));
+    }
+    servidor.parar();
+    struct stat info;
+    VERIFICAR(lstat(config.caminhoSocket.c_str(), &info) < 0);
+}
+
+// Sem $XDG_RUNTIME_DIR, o caminho padrão fica num diretório 0700 do usuário
+static void testarCaminhoPadrao(const std::string& modelo) {
+    const char* anterior = std::getenv("XDG_RUNTIME_DIR");
+    const std::string valorAnterior = anterior ? anterior : "";
+    unsetenv("XDG_RUNTIME_DIR");
+
+    const std::string caminho = caminhoSocketInferenciaPadrao();
+    VERIFICAR(caminho == "/tmp/neat_inferencia-" + std::to_string(getuid()) + "/inferencia.sock");
+    {
+        ServidorInferencia servidor;
+        servidor.adicionarModelo(modelo);
+        servidor.iniciar();
+        struct stat info;
+        const std::string diretorio = caminho.substr(0, caminho.rfind('/'));
+        VERIFICAR(lstat(diretorio.c_str(), &info) == 0 && S_ISDIR(info.st_mode) &&
+                  (info.st_mode & 077) == 0 && info.st_uid == getuid());
+        ClienteInferencia cliente;
+        VERIFICAR(cliente.inferir(0, {1.0f, 2.0f, 3.0f}).size() == 2);
+        servidor.parar();
+    }
+
+    setenv("XDG_RUNTIME_DIR", "/run/user/teste", 1);
+    VERIFICAR(caminhoSocketInferenciaPadrao() == "/run/user/teste/neat_inferencia.sock");
+    if (anterior) {
+        setenv("XDG_RUNTIME_DIR", valorAnterior.c_str(), 1);
+    } else {
+        unsetenv("XDG_RUNTIME_DIR");
+    }
+}
+
+// Servidor falso que responde a cada requisição com 'resposta' seguido de
+// 'corpo', anunciando em quantidade mais do que manda
+static void responderComCorpoCurto(int ouvinte, MensagemInferencia::Tipo tipo, const std::string& corpo,
+                                   int requisicoes) {
+    int conexao = accept(ouvinte, nullptr, nullptr);
+    char entrada[4096];
+    for (int r = 0; r < requisicoes && conexao >= 0; r++) {
+        ssize_t lidos = recv(conexao, entrada, sizeof(entrada), 0);
+        if (lidos < static_cast<ssize_t>(sizeof(MensagemInferencia))) break;
+        MensagemInferencia resposta;
+        std::memcpy(&resposta, entrada, sizeof(resposta));
+        resposta.tipo = tipo;
+        resposta.quantidade = 1000;
+        std::string mensagem(reinterpret_cast<const char*>(&resposta), sizeof(resposta));
+        mensagem += corpo;
+        send(conexao, mensagem.data(), mensagem.size(), MSG_NOSIGNAL);
+    }
+    if (conexao >= 0) close(conexao);
+}
+
+// O cliente não lê além do que recebeu: saídas anunciadas sem os bytes são
+// recusadas e a mensagem de erro fica só com o texto recebido
+static void testarRespostaCurta() {
+    const std::string caminho = caminhoTemporario("falso") + ".sock";
+    std::remove(caminho.c_str());
+    int ouvinte = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+    sockaddr_un endereco = {};
+    endereco.sun_family = AF_UNIX;
+    std::snprintf(endereco.sun_path, sizeof(endereco.sun_path), "%s", caminho.c_str());
+    VERIFICAR(bind(ouvinte, reinterpret_cast<sockaddr*>(&endereco), sizeof(endereco)) == 0);
+    VERIFICAR(listen(ouvinte, 4) == 0);
+
+    {
+        std::thread servidor(responderComCorpoCurto, ouvinte, MensagemInferencia::INFERENCIA,
+                             std::string(8, '\0'), 1);
+        ClienteInferencia cliente(caminho);
+        bool recusada = false;
+        try {
+            cliente.inferir(0, {1.0f, 2.0f});
+        } catch (const std::runtime_error&) {
+            recusada = true;
+        }
+        servidor.join();
+        VERIFICAR(recusada);
+    }
+    {
+        std::thread servidor(responderComCorpoCurto, ouvinte, MensagemInferencia::ERRO,
+                             std::string("modelo inexistente"), 1);
+        ClienteInferencia cliente(caminho);
+        std::string mensagem;
+        try {
+            cliente.inferir(7, {1.0f});
+        } catch (const std::runtime_error& erro) {
+            mensagem = erro.what();
+        }
+        servidor.join();
+        VERIFICAR(mensagem == "Servidor de inferência: modelo inexistente");
+    }
+    close(ouvinte);
+    std::remove(caminho.c_str());
+}
+
+int main() {
+    const std::string modelo = salvarModelo();
+    testarArquivoPreservado(modelo);
+    testarSocketAntigo(modelo);
+    testarCaminhoPadrao(modelo);
+    testarRespostaCurta();
+    std::remove(modelo.c_str());
+    return resultado("teste_servidor_inferencia");
+}
@@ -0,0 +1,143 @@
+#include "../include/SubstratoHyperNEAT.h"
+#include "../include/RedeEsparsa.h"
+#include "RedeNeural.hpp"
+#include "Verificacao.h"
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace NEAT;
+
+// CPPN pequena com um nó oculto gaussiano e bias nas saídas, uma saída por
+// par de camadas do substrato
+static Rede criarCPPN(int numSaidas) {
+    GerenciadorInovacao inovacoes;
+    std::mt19937 gerador(5);
+    Rede cppn(SubstratoHyperNEAT::NUM_ENTRADAS_CPPN, numSaidas, inovacoes, gerador);
+    SubstratoHyperNEAT::configurarCPPN(cppn);
+    const int oculto = SubstratoHyperNEAT::NUM_ENTRADAS_CPPN + numSaidas;
+    cppn.adicionarNo(1, NEAT::TipoAtivacao::GAUSSIANA);
+    cppn.adicionarConexao(0, oculto, 1.5f, inovacoes);
+    cppn.adicionarConexao(2, oculto, -1.0f, inovacoes);
+    cppn.adicionarConexao(4, oculto, 0.7f, inovacoes);
+    for (int s = 0; s < numSaidas; s++) {
+        const int saida = SubstratoHyperNEAT::NUM_ENTRADAS_CPPN + s;
+        cppn.adicionarConexao(oculto, saida, s % 2 ? -2.0f : 2.0f, inovacoes);
+        cppn.definirBias(saida, 0.1f * s);
+    }
+    return cppn;
+}
+
+// O vetor gerado tem o tamanho e o layout da RedeNeural de mesma topologia:
+// passa por copiarVetorParaCamadas sem sobrar nem faltar, e a propagação
+// sobre o vetor dá o mesmo que a rede montada com ele
+static void testarLayout() {
+    SubstratoHyperNEAT::Configuracao config;
+    config.tamanhoLote = 7;  // lotes que atravessam linhas, o último incompleto
+    SubstratoHyperNEAT substrato({3, 4, 4, 2}, config);
+    substrato.definirGrade(1, 2);
+    Rede cppn = criarCPPN(substrato.obterNumSaidasCPPN());
+
+    RedeNeural rede(2, 3, 4, 2);
+    VERIFICAR(substrato.obterQuantidadePesos() == rede.getQuantidadePesos());
+    VERIFICAR(SubstratoHyperNEAT({3, 4, 2}).obterQuantidadePesos() == RedeNeural(1, 3, 4, 2).getQuantidadePesos());
+
+    std::vector<double> pesos;
+    substrato.gerarPesos(cppn, pesos);
+    VERIFICAR(static_cast<int>(pesos.size()) == rede.getQuantidadePesos());
+    rede.copiarVetorParaCamadas(pesos);
+    std::vector<double> copia;
+    rede.copiarCamadasParaVetor(copia);
+    VERIFICAR(copia == pesos);
+
+    const std::vector<double> entrada = {0.3, -0.8, 0.5};
+    std::vector<double> rascunho(rede.getTamanhoRascunho());
+    double saidaPlana[2];
+    rede.calcularSaidaComPesos(pesos.data(), entrada.data(), saidaPlana, rascunho.data());
+    rede.copiarParaEntrada(entrada);
+    rede.calcularSaida();
+    std::vector<double> saida;
+    rede.copiarDaSaida(saida);
+    for (int i = 0; i < 2; i++) {
+        VERIFICAR(std::isfinite(saidaPlana[i]));
+        VERIFICAR(std::abs(saidaPlana[i] - saida[i]) < 1e-12);
+    }
+}
+
+// Cada peso e bias é a saída da CPPN consultada uma amostra por vez: abaixo
+// do limiar vira 0, acima é reescalado. Confere também que a avaliação em
+// lote de gerarPesos dá o mesmo que avaliar amostra por amostra.
+static void testarExpressao() {
+    SubstratoHyperNEAT::Configuracao config;
+    config.limiarExpressao = 0.3f;
+    config.tamanhoLote = 5;
+    const std::vector<int> camadas = {3, 4, 2};
+    SubstratoHyperNEAT substrato(camadas, config);
+    Rede cppn = criarCPPN(substrato.obterNumSaidasCPPN());
+
+    std::vector<double> pesos;
+    substrato.gerarPesos(cppn, pesos);
+
+    const float escala = config.escalaPeso / (1.0f - config.limiarExpressao);
+    size_t indice = 0;
+    int zerados = 0;
+    int expressos = 0;
+    for (size_t c = 1; c < camadas.size(); c++) {
+        const int numOrigem = camadas[c - 1];
+        for (int destino = 0; destino < camadas[c]; destino++) {
+            const float x2 = camadas[c] > 1 ? -1.0f + 2.0f * destino / (camadas[c] - 1) : 0.0f;
+            for (int origem = 0; origem <= numOrigem; origem++) {
+                // A última coluna da linha é o bias: consulta a partir de (0, 0)
+                const float x1 = origem == numOrigem ? 0.0f : -1.0f + 2.0f * origem / (numOrigem - 1);
+                cppn.definirEntradas({x1, 0.0f, x2, 0.0f, std::sqrt((x2 - x1) * (x2 - x1))});
+                cppn.avaliar();
+                const float valor = cppn.obterSaidas()[c - 1];
+                const float magnitude = std::abs(valor) - config.limiarExpressao;
+                if (magnitude > 0.0f) {
+                    VERIFICAR(pesos[indice] == static_cast<double>(std::copysign(magnitude * escala, valor)));
+                    expressos++;
+                } else {
+                    VERIFICAR(pesos[indice] == 0.0);
+                    zerados++;
+                }
+                indice++;
+            }
+        }
+    }
+    VERIFICAR(indice == pesos.size());
+    VERIFICAR(zerados > 0 && expressos > 0);
+}
+
+// avaliarLote (amostras em colunas) dá exatamente o mesmo que avaliar
+static void testarLote() {
+    Rede cppn = criarCPPN(2);
+    RedeEsparsa plano(cppn);
+    const int numEntradas = plano.obterNumEntradas();
+    const int numSaidas = plano.obterNumSaidas();
+    const int lote = 13;
+
+    std::mt19937 gerador(9);
+    std::uniform_real_distribution<float> distribuicao(-1.0f, 1.0f);
+    std::vector<float> entradas(static_cast<size_t>(numEntradas) * lote);
+    for (float& v : entradas) v = distribuicao(gerador);
+    std::vector<float> saidas(static_cast<size_t>(numSaidas) * lote);
+    plano.avaliarLote(entradas.data(), lote, saidas.data());
+
+    std::vector<float> amostra(numEntradas);
+    std::vector<float> saidaAmostra(numSaidas);
+    for (int a = 0; a < lote; a++) {
+        for (int e = 0; e < numEntradas; e++) amostra[e] = entradas[static_cast<size_t>(e) * lote + a];
+        RedeEsparsa individual(cppn);
+        individual.avaliar(amostra.data(), saidaAmostra.data());
+        for (int s = 0; s < numSaidas; s++) {
+            VERIFICAR(saidas[static_cast<size_t>(s) * lote + a] == saidaAmostra[s]);
+        }
+    }
+}
+
+int main() {
+    testarLayout();
+    testarExpressao();
+    testarLote();
+    return resultado("teste_substrato_hyperneat");
+}
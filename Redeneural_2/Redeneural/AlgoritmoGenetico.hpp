@@ -1,289 +1,490 @@
-#pragma once
-#include "RedeNeural.hpp"
-#include "FuncoesAuxiliares.hpp"
-#include <vector>
-#include <algorithm>
-#include <random>
-#include <functional>
-
-class AlgoritmoGenetico {
-public:
-    struct Individuo {
-        RedeNeural rede;
-        double fitness;
-        double novidade;  // Medida de quão diferente este indivíduo é dos outros
-        
-        Individuo(int numCamadasEscondidas, int numEntradas, 
-                 int numNeuroniosEscondidos, int numSaidas) 
-            : rede(numCamadasEscondidas, numEntradas, 
-                  numNeuroniosEscondidos, numSaidas), 
-              fitness(0.0),
-              novidade(0.0) {}
-    };
-
-    AlgoritmoGenetico(int tamPopulacao, 
-                     int numCamadasEscondidas,
-                     int numEntradas,
-                     int numNeuroniosEscondidos,
-                     int numSaidas)
-        : populacao(),
-          tamanhoPopulacao(tamPopulacao),
-          numCamadasEscondidas(numCamadasEscondidas),
-          numEntradas(numEntradas),
-          numNeuroniosEscondidos(numNeuroniosEscondidos),
-          numSaidas(numSaidas),
-          geracoesSemMelhoria(0),
-          melhorFitnessAnterior(0.0) {}
-
-    void inicializarPopulacao() {
-        populacao.clear();
-        for(int i = 0; i < tamanhoPopulacao; i++) {
-            populacao.emplace_back(numCamadasEscondidas, numEntradas, 
-                                 numNeuroniosEscondidos, numSaidas);
-        }
-    }
-
-    void avaliarPopulacao(const std::function<double(RedeNeural&)>& funcaoAvaliacao) {
-        for(auto& individuo : populacao) {
-            individuo.fitness = funcaoAvaliacao(individuo.rede);
-        }
-        calcularNovidade();
-    }
-
-    void evoluir() {
-        // Verifica se houve melhoria
-        double melhorFitnessAtual = getMelhorFitness();
-        if(melhorFitnessAtual <= melhorFitnessAnterior) {
-            geracoesSemMelhoria++;
-        } else {
-            geracoesSemMelhoria = 0;
-            melhorFitnessAnterior = melhorFitnessAtual;
-        }
-
-        // Ajusta parâmetros baseado no progresso
-        ajustarParametros();
-
-        std::vector<Individuo> novaPopulacao;
-        
-        // Elitismo - mantém os melhores indivíduos e cria cópias mutadas deles
-        std::vector<Individuo> elite = selecionarElite();
-        
-        // Adiciona os elitistas originais
-        novaPopulacao.insert(novaPopulacao.end(), elite.begin(), elite.end());
-        
-        // Cria cópias mutadas dos elitistas
-        for(const auto& elitista : elite) {
-            std::vector<double> genes;
-            elitista.rede.copiarCamadasParaVetor(genes);
-            
-            // Aplica uma mutação mais suave nas cópias dos elitistas
-            mutacaoSuave(genes);
-            
-            Individuo copiaElitista(numCamadasEscondidas, numEntradas, 
-                                  numNeuroniosEscondidos, numSaidas);
-            copiaElitista.rede.copiarVetorParaCamadas(genes);
-            novaPopulacao.push_back(copiaElitista);
-        }
-        
-        // Adiciona alguns indivíduos completamente novos para manter diversidade
-        int numNovos = tamanhoPopulacao * TAXA_NOVOS_INDIVIDUOS;
-        for(int i = 0; i < numNovos; i++) {
-            novaPopulacao.emplace_back(numCamadasEscondidas, numEntradas, 
-                                     numNeuroniosEscondidos, numSaidas);
-        }
-        
-        // Preenche o resto da população com crossover e mutação
-        while(novaPopulacao.size() < tamanhoPopulacao) {
-            Individuo pai1 = selecaoTorneio();
-            Individuo pai2 = selecaoTorneio();
-            
-            std::vector<double> genes1, genes2;
-            pai1.rede.copiarCamadasParaVetor(genes1);
-            pai2.rede.copiarCamadasParaVetor(genes2);
-            
-            std::vector<double> filho1 = genes1;
-            std::vector<double> filho2 = genes2;
-            
-            // Crossover
-            if(std::rand() / (float)RAND_MAX < TAXA_CROSSOVER) {
-                crossover(genes1, genes2, filho1, filho2);
-            }
-            
-            // Mutação adaptativa
-            mutacao(filho1);
-            mutacao(filho2);
-            
-            // Cria novos indivíduos
-            Individuo novoInd1(numCamadasEscondidas, numEntradas, 
-                             numNeuroniosEscondidos, numSaidas);
-            Individuo novoInd2(numCamadasEscondidas, numEntradas, 
-                             numNeuroniosEscondidos, numSaidas);
-            
-            novoInd1.rede.copiarVetorParaCamadas(filho1);
-            novoInd2.rede.copiarVetorParaCamadas(filho2);
-            
-            novaPopulacao.push_back(novoInd1);
-            if(novaPopulacao.size() < tamanhoPopulacao) {
-                novaPopulacao.push_back(novoInd2);
-            }
-        }
-        
-        populacao = std::move(novaPopulacao);
-    }
-    
-    Individuo& getIndividuo(size_t index) { return populacao[index]; }
-    void setIndividuoFitness(size_t index, double fitness) { 
-        populacao[index].fitness = fitness;
-    }
-    size_t getTamanhoPopulacao() const { return populacao.size(); }
-
-    double getMelhorFitness() const {
-        double melhor = -1e9;
-        for(const auto& ind : populacao) {
-            melhor = std::max(melhor, ind.fitness);
-        }
-        return melhor;
-    }
-
-    double getMediaFitness() const {
-        double soma = 0;
-        for(const auto& ind : populacao) {
-            soma += ind.fitness;
-        }
-        return soma / populacao.size();
-    }
-
-private:
-    std::vector<Individuo> populacao;
-    int tamanhoPopulacao;
-    int numCamadasEscondidas;
-    int numEntradas;
-    int numNeuroniosEscondidos;
-    int numSaidas;
-    int geracoesSemMelhoria;
-    double melhorFitnessAnterior;
-    
-    // Parâmetros adaptativos
-    double TAXA_MUTACAO = 0.3;
-    double INTENSIDADE_MUTACAO = 0.3;
-    double TAXA_CROSSOVER = 0.7;
-    const int NUM_ELITISMO = 20;
-    const double TAXA_NOVOS_INDIVIDUOS = 0.1; // 10% de indivíduos novos por geração
-    const double TAXA_MUTACAO_SUAVE = 0.1; // Taxa de mutação para elitistas
-    const double INTENSIDADE_MUTACAO_SUAVE = 0.1; // Intensidade de mutação para elitistas
-    
-    void ajustarParametros() {
-        // Aumenta a taxa e intensidade de mutação se ficar estagnado
-        if(geracoesSemMelhoria > 5) {
-            TAXA_MUTACAO = std::min(0.8, TAXA_MUTACAO * 1.5);
-            INTENSIDADE_MUTACAO = std::min(0.8, INTENSIDADE_MUTACAO * 1.5);
-        } else {
-            TAXA_MUTACAO = 0.3;
-            INTENSIDADE_MUTACAO = 0.3;
-        }
-    }
-    
-    void calcularNovidade() {
-        for(auto& ind1 : populacao) {
-            double somaDistancias = 0;
-            std::vector<double> genes1;
-            ind1.rede.copiarCamadasParaVetor(genes1);
-            
-            for(const auto& ind2 : populacao) {
-                if(&ind1 != &ind2) {
-                    std::vector<double> genes2;
-                    ind2.rede.copiarCamadasParaVetor(genes2);
-                    
-                    // Calcula distância euclidiana entre os genes
-                    double distancia = 0;
-                    for(size_t i = 0; i < genes1.size(); i++) {
-                        double diff = genes1[i] - genes2[i];
-                        distancia += diff * diff;
-                    }
-                    somaDistancias += std::sqrt(distancia);
-                }
-            }
-            ind1.novidade = somaDistancias / (populacao.size() - 1);
-        }
-    }
-    
-    std::vector<Individuo> selecionarElite() {
-        std::vector<Individuo> elite;
-        std::vector<Individuo*> candidatos;
-        
-        // Cria ponteiros para todos os indivíduos
-        for(auto& ind : populacao) {
-            candidatos.push_back(&ind);
-        }
-        
-        // Ordena por fitness e novidade
-        std::sort(candidatos.begin(), candidatos.end(),
-                 [](const Individuo* a, const Individuo* b) {
-                     return (a->fitness * 0.7 + a->novidade * 0.3) >
-                            (b->fitness * 0.7 + b->novidade * 0.3);
-                 });
-        
-        // Seleciona os melhores
-        for(int i = 0; i < NUM_ELITISMO && i < candidatos.size(); i++) {
-            elite.push_back(*candidatos[i]);
-        }
-        
-        return elite;
-    }
-    
-    Individuo& selecaoTorneio() {
-        const int TAMANHO_TORNEIO = 5;
-        std::vector<Individuo*> torneio;
-        
-        // Seleciona indivíduos aleatórios para o torneio
-        for(int i = 0; i < TAMANHO_TORNEIO; i++) {
-            int idx = std::rand() % populacao.size();
-            torneio.push_back(&populacao[idx]);
-        }
-        
-        // Encontra o melhor do torneio considerando fitness e novidade
-        auto melhor = std::max_element(torneio.begin(), torneio.end(),
-            [](const Individuo* a, const Individuo* b) {
-                return (a->fitness * 0.7 + a->novidade * 0.3) <
-                       (b->fitness * 0.7 + b->novidade * 0.3);
-            });
-        
-        return **melhor;
-    }
-    
-    void mutacao(std::vector<double>& pesos) {
-        std::random_device rd;
-        std::mt19937 gen(rd());
-        std::normal_distribution<> d(0, INTENSIDADE_MUTACAO);
-        
-        for(double& peso : pesos) {
-            if(std::rand() / (float)RAND_MAX < TAXA_MUTACAO) {
-                peso += d(gen);
-            }
-        }
-    }
-    
-    void mutacaoSuave(std::vector<double>& pesos) {
-        std::random_device rd;
-        std::mt19937 gen(rd());
-        std::normal_distribution<> d(0, INTENSIDADE_MUTACAO_SUAVE);
-        
-        for(double& peso : pesos) {
-            if(std::rand() / (float)RAND_MAX < TAXA_MUTACAO_SUAVE) {
-                peso += d(gen);
-            }
-        }
-    }
-    
-    void crossover(const std::vector<double>& pesos1, 
-                  const std::vector<double>& pesos2,
-                  std::vector<double>& filho1,
-                  std::vector<double>& filho2) {
-        for(size_t i = 0; i < pesos1.size(); i++) {
-            if(std::rand() / (float)RAND_MAX < 0.5) {
-                filho1[i] = pesos2[i];
-                filho2[i] = pesos1[i];
-            }
-        }
-    }
+#pragma once
+#include "RedeNeural.hpp"
+#include "FuncoesAuxiliares.hpp"
+#include "AmbienteVetorizado.hpp"
+#include "InputsRedeNeural.hpp"
+#include "ModeloSubstituto.hpp"
+#include "SelecaoMultiobjetivo.hpp"
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <functional>
+#include <numeric>
+#include <stdexcept>
+
+class AlgoritmoGenetico {
+public:
+    // PONDERADO: fitness * 0.7 + novidade * 0.3
+    // PARETO: frentes não dominadas e aglomeração (NSGA-II) sobre fitness,
+    //         novidade e os objetivos extras de cada indivíduo
+    enum class ModoSelecao { PONDERADO, PARETO };
+
+    struct Individuo {
+        RedeNeural rede;
+        double fitness;
+        double novidade;  // Medida de quão diferente este indivíduo é dos outros
+        std::vector<double> objetivosExtras;  // maximizados, usados no modo PARETO
+        
+        Individuo(int numCamadasEscondidas, int numEntradas, 
+                 int numNeuroniosEscondidos, int numSaidas) 
+            : rede(numCamadasEscondidas, numEntradas, 
+                  numNeuroniosEscondidos, numSaidas), 
+              fitness(0.0),
+              novidade(0.0) {}
+    };
+
+    AlgoritmoGenetico(int tamPopulacao, 
+                     int numCamadasEscondidas,
+                     int numEntradas,
+                     int numNeuroniosEscondidos,
+                     int numSaidas)
+        : populacao(),
+          tamanhoPopulacao(tamPopulacao),
+          numCamadasEscondidas(numCamadasEscondidas),
+          numEntradas(numEntradas),
+          numNeuroniosEscondidos(numNeuroniosEscondidos),
+          numSaidas(numSaidas),
+          arquitetura(numCamadasEscondidas, numEntradas, numNeuroniosEscondidos, numSaidas),
+          geracoesSemMelhoria(0),
+          melhorFitnessAnterior(0.0) {}
+
+    void inicializarPopulacao() {
+        populacao.clear();
+        for(int i = 0; i < tamanhoPopulacao; i++) {
+            populacao.push_back(novoIndividuo());
+        }
+    }
+
+    // Ativações de 'rede' (mesma topologia) para a população atual e para
+    // todos os indivíduos criados depois; os pesos e bias continuam evoluindo
+    void setArquitetura(const RedeNeural& rede) {
+        arquitetura.copiarAtivacoes(rede);
+        for(auto& individuo : populacao) {
+            individuo.rede.copiarAtivacoes(arquitetura);
+        }
+    }
+
+    void avaliarPopulacao(const std::function<double(RedeNeural&)>& funcaoAvaliacao) {
+        for(auto& individuo : populacao) {
+            individuo.fitness = funcaoAvaliacao(individuo.rede);
+        }
+        calcularNovidade();
+    }
+
+    // Avalia toda a população num ambiente vetorizado: a cada passo as
+    // observações de todos os indivíduos ativos passam pela inferência em lote
+    // e o fitness é a soma das recompensas até o fim do episódio. Com um
+    // pré-processamento definido, o ambiente escreve observações de
+    // getTamanhoObservacao() valores e a rede recebe getTamanhoSaida().
+    void avaliarPopulacao(AmbienteVetorizado& ambiente, int maxPassos) {
+        const int n = populacao.size();
+        if(n == 0) return;
+        
+        const RedeNeural& modelo = populacao[0].rede;
+        const int numPesos = modelo.getQuantidadePesos();
+        
+        // Pesos de toda a população numa única matriz contígua
+        std::vector<double> pesos(static_cast<size_t>(n) * numPesos);
+        std::vector<double> genes;
+        for(int i = 0; i < n; i++) {
+            populacao[i].rede.copiarCamadasParaVetor(genes);
+            std::copy(genes.begin(), genes.end(), pesos.begin() + static_cast<size_t>(i) * numPesos);
+        }
+        
+        const int tamanhoObservacao = preprocessamento ? preprocessamento->getTamanhoObservacao() : numEntradas;
+        if(preprocessamento && preprocessamento->getTamanhoSaida() != numEntradas) {
+            throw std::runtime_error("Pré-processamento com saída diferente das entradas da rede");
+        }
+        std::vector<double> observacoes(static_cast<size_t>(n) * tamanhoObservacao);
+        std::vector<double> entradasRede;
+        if(preprocessamento) {
+            entradasRede.resize(static_cast<size_t>(n) * numEntradas);
+            preprocessamento->reservarEstados(n);
+        }
+        double* entradas = preprocessamento ? entradasRede.data() : observacoes.data();
+        std::vector<double> acoes(static_cast<size_t>(n) * numSaidas, 0.0);
+        std::vector<double> recompensas(n, 0.0);
+        std::vector<double> rascunho(modelo.getTamanhoRascunho());
+        std::vector<uint8_t> ativos(n, 1);
+        std::vector<uint8_t> terminados(n, 0);
+        std::vector<double> totais(n, 0.0);
+        int numAtivos = n;
+        
+        ambiente.reset(n, observacoes);
+        if(preprocessamento) {
+            preprocessamento->processarLote(observacoes.data(), n, entradas, ativos.data());
+        }
+        for(int passo = 0; passo < maxPassos && numAtivos > 0; passo++) {
+            for(int i = 0; i < n; i++) {
+                if(!ativos[i]) continue;
+                modelo.calcularSaidaComPesos(&pesos[static_cast<size_t>(i) * numPesos],
+                                             entradas + static_cast<size_t>(i) * numEntradas,
+                                             &acoes[static_cast<size_t>(i) * numSaidas],
+                                             rascunho.data());
+            }
+            
+            std::fill(terminados.begin(), terminados.end(), 0);
+            ambiente.step(acoes, ativos, observacoes, recompensas, terminados);
+            
+            for(int i = 0; i < n; i++) {
+                if(!ativos[i]) continue;
+                totais[i] += recompensas[i];
+                if(terminados[i]) {
+                    ativos[i] = 0;
+                    numAtivos--;
+                }
+            }
+            if(preprocessamento) {
+                preprocessamento->processarLote(observacoes.data(), n, entradas, ativos.data());
+            }
+        }
+        
+        for(int i = 0; i < n; i++) {
+            populacao[i].fitness = totais[i];
+        }
+        calcularNovidade();
+    }
+
+    void evoluir() {
+        // Verifica se houve melhoria
+        double melhorFitnessAtual = getMelhorFitness();
+        if(melhorFitnessAtual <= melhorFitnessAnterior) {
+            geracoesSemMelhoria++;
+        } else {
+            geracoesSemMelhoria = 0;
+            melhorFitnessAnterior = melhorFitnessAtual;
+        }
+
+        // Ajusta parâmetros baseado no progresso
+        ajustarParametros();
+
+        // Ordem de seleção calculada uma vez para o elitismo e os torneios
+        classificarPopulacao();
+
+        // Treina o modelo substituto com as aptidões reais desta geração
+        if(fatorPoolSubstituto > 1) {
+            modeloSubstituto.envelhecer();
+            std::vector<std::vector<double>> genes(populacao.size());
+            std::vector<double> fitness(populacao.size());
+            for(size_t i = 0; i < populacao.size(); i++) {
+                populacao[i].rede.copiarCamadasParaVetor(genes[i]);
+                fitness[i] = populacao[i].fitness;
+            }
+            modeloSubstituto.adicionarGeracao(genes, fitness);
+        }
+
+        std::vector<Individuo> novaPopulacao;
+        
+        // Elitismo - mantém os melhores indivíduos e cria cópias mutadas deles
+        std::vector<Individuo> elite = selecionarElite();
+        
+        // Adiciona os elitistas originais
+        novaPopulacao.insert(novaPopulacao.end(), elite.begin(), elite.end());
+        
+        // Cria cópias mutadas dos elitistas
+        for(const auto& elitista : elite) {
+            std::vector<double> genes;
+            elitista.rede.copiarCamadasParaVetor(genes);
+            
+            // Aplica uma mutação mais suave nas cópias dos elitistas
+            mutacaoSuave(genes);
+            
+            Individuo copiaElitista = novoIndividuo();
+            copiaElitista.rede.copiarVetorParaCamadas(genes);
+            novaPopulacao.push_back(copiaElitista);
+        }
+        
+        // Adiciona alguns indivíduos completamente novos para manter diversidade
+        int numNovos = tamanhoPopulacao * TAXA_NOVOS_INDIVIDUOS;
+        for(int i = 0; i < numNovos; i++) {
+            novaPopulacao.push_back(novoIndividuo());
+        }
+        
+        // Preenche o resto da população com crossover e mutação. Com o modelo
+        // substituto pronto, gera um grupo maior e mantém só os mais promissores
+        int vagas = std::max(0, tamanhoPopulacao - (int)novaPopulacao.size());
+        bool usarSubstituto = fatorPoolSubstituto > 1 && modeloSubstituto.estaPronto();
+        int candidatos = usarSubstituto ? vagas * fatorPoolSubstituto : vagas;
+        std::vector<std::vector<double>> filhos;
+        filhos.reserve(candidatos + 1);
+
+        while((int)filhos.size() < candidatos) {
+            Individuo pai1 = selecaoTorneio();
+            Individuo pai2 = selecaoTorneio();
+            
+            std::vector<double> genes1, genes2;
+            pai1.rede.copiarCamadasParaVetor(genes1);
+            pai2.rede.copiarCamadasParaVetor(genes2);
+            
+            std::vector<double> filho1 = genes1;
+            std::vector<double> filho2 = genes2;
+            
+            // Crossover
+            if(std::rand() / (float)RAND_MAX < TAXA_CROSSOVER) {
+                crossover(genes1, genes2, filho1, filho2);
+            }
+            
+            // Mutação adaptativa
+            mutacao(filho1);
+            mutacao(filho2);
+            
+            filhos.push_back(std::move(filho1));
+            if((int)filhos.size() < candidatos) {
+                filhos.push_back(std::move(filho2));
+            }
+        }
+
+        std::vector<int> escolhidos(filhos.size());
+        for(size_t i = 0; i < filhos.size(); i++) escolhidos[i] = i;
+        if(usarSubstituto) {
+            std::vector<double> previsoes(filhos.size());
+            for(size_t i = 0; i < filhos.size(); i++) {
+                previsoes[i] = modeloSubstituto.prever(filhos[i]);
+            }
+            std::partial_sort(escolhidos.begin(), escolhidos.begin() + vagas, escolhidos.end(),
+                [&previsoes](int a, int b) { return previsoes[a] > previsoes[b]; });
+            escolhidos.resize(vagas);
+        }
+
+        // Só os filhos escolhidos viram indivíduos (e chegam à avaliação)
+        for(int indice : escolhidos) {
+            Individuo novoInd = novoIndividuo();
+            novoInd.rede.copiarVetorParaCamadas(filhos[indice]);
+            novaPopulacao.push_back(novoInd);
+        }
+        
+        populacao = std::move(novaPopulacao);
+    }
+    
+    Individuo& getIndividuo(size_t index) { return populacao[index]; }
+    void setIndividuoFitness(size_t index, double fitness) { 
+        populacao[index].fitness = fitness;
+    }
+    // Objetivos além de fitness e novidade (ex.: -pesos não nulos); mesmo número para todos
+    void setIndividuoObjetivos(size_t index, const std::vector<double>& objetivos) {
+        populacao[index].objetivosExtras = objetivos;
+    }
+    size_t getTamanhoPopulacao() const { return populacao.size(); }
+
+    RedeNeural& getMelhorIndividuo() {
+        auto it = std::max_element(populacao.begin(), populacao.end(),
+            [](const Individuo& a, const Individuo& b) {
+                return a.fitness < b.fitness;
+            });
+        return it->rede;
+    }
+
+    // Cópias das k redes de maior fitness, da melhor para a pior (para EnsembleRedeNeural)
+    std::vector<RedeNeural> getMelhoresIndividuos(int k) const {
+        std::vector<int> ordem(populacao.size());
+        std::iota(ordem.begin(), ordem.end(), 0);
+        k = std::max(0, std::min(k, static_cast<int>(ordem.size())));
+        std::partial_sort(ordem.begin(), ordem.begin() + k, ordem.end(),
+            [this](int a, int b) { return populacao[a].fitness > populacao[b].fitness; });
+        std::vector<RedeNeural> melhores;
+        melhores.reserve(k);
+        for(int i = 0; i < k; i++) {
+            melhores.push_back(populacao[ordem[i]].rede);
+        }
+        return melhores;
+    }
+
+    // Filhos gerados por vaga antes da pré-seleção pelo modelo substituto (1 = desativado)
+    void setFatorPoolSubstituto(int fator) { fatorPoolSubstituto = std::max(1, fator); }
+
+    void setModoSelecao(ModoSelecao modo) { modoSelecao = modo; }
+    // Pré-processamento das observações em avaliarPopulacao(ambiente, ...);
+    // não é copiado, precisa viver enquanto o algoritmo o usar (nullptr desliga)
+    void setPreprocessamento(InputsRedeNeural* pipeline) { preprocessamento = pipeline; }
+
+    // Índices dos indivíduos não dominados da população atual (já avaliada)
+    std::vector<int> getFrentePareto() const {
+        std::vector<SelecaoMultiobjetivo::Classificacao> atual = classificarPareto();
+        std::vector<int> frente;
+        for(size_t i = 0; i < atual.size(); i++) {
+            if(atual[i].frente == 0) frente.push_back(i);
+        }
+        return frente;
+    }
+
+    double getMelhorFitness() const {
+        double melhor = -1e9;
+        for(const auto& ind : populacao) {
+            melhor = std::max(melhor, ind.fitness);
+        }
+        return melhor;
+    }
+
+    double getMediaFitness() const {
+        double soma = 0;
+        for(const auto& ind : populacao) {
+            soma += ind.fitness;
+        }
+        return soma / populacao.size();
+    }
+
+private:
+    std::vector<Individuo> populacao;
+    int tamanhoPopulacao;
+    int numCamadasEscondidas;
+    int numEntradas;
+    int numNeuroniosEscondidos;
+    int numSaidas;
+    RedeNeural arquitetura;  // só as ativações, copiadas para cada indivíduo novo
+    int geracoesSemMelhoria;
+    double melhorFitnessAnterior;
+    int fatorPoolSubstituto = 1;
+    ModeloSubstituto modeloSubstituto;
+    ModoSelecao modoSelecao = ModoSelecao::PONDERADO;
+    InputsRedeNeural* preprocessamento = nullptr;
+    std::vector<double> pontuacao;                                   // modo PONDERADO
+    std::vector<SelecaoMultiobjetivo::Classificacao> classificacao;  // modo PARETO
+    
+    // Parâmetros adaptativos
+    double TAXA_MUTACAO = 0.3;
+    double INTENSIDADE_MUTACAO = 0.3;
+    double TAXA_CROSSOVER = 0.7;
+    const int NUM_ELITISMO = 20;
+    const double TAXA_NOVOS_INDIVIDUOS = 0.1; // 10% de indivíduos novos por geração
+    const double TAXA_MUTACAO_SUAVE = 0.1; // Taxa de mutação para elitistas
+    const double INTENSIDADE_MUTACAO_SUAVE = 0.1; // Intensidade de mutação para elitistas
+    
+    Individuo novoIndividuo() const {
+        Individuo individuo(numCamadasEscondidas, numEntradas, numNeuroniosEscondidos, numSaidas);
+        individuo.rede.copiarAtivacoes(arquitetura);
+        return individuo;
+    }
+
+    void ajustarParametros() {
+        // Aumenta a taxa e intensidade de mutação se ficar estagnado
+        if(geracoesSemMelhoria > 5) {
+            TAXA_MUTACAO = std::min(0.8, TAXA_MUTACAO * 1.5);
+            INTENSIDADE_MUTACAO = std::min(0.8, INTENSIDADE_MUTACAO * 1.5);
+        } else {
+            TAXA_MUTACAO = 0.3;
+            INTENSIDADE_MUTACAO = 0.3;
+        }
+    }
+    
+    void calcularNovidade() {
+        for(auto& ind1 : populacao) {
+            double somaDistancias = 0;
+            std::vector<double> genes1;
+            ind1.rede.copiarCamadasParaVetor(genes1);
+            
+            for(const auto& ind2 : populacao) {
+                if(&ind1 != &ind2) {
+                    std::vector<double> genes2;
+                    ind2.rede.copiarCamadasParaVetor(genes2);
+                    
+                    // Calcula distância euclidiana entre os genes
+                    double distancia = 0;
+                    for(size_t i = 0; i < genes1.size(); i++) {
+                        double diff = genes1[i] - genes2[i];
+                        distancia += diff * diff;
+                    }
+                    somaDistancias += std::sqrt(distancia);
+                }
+            }
+            ind1.novidade = somaDistancias / (populacao.size() - 1);
+        }
+    }
+    
+    void classificarPopulacao() {
+        const int n = populacao.size();
+        if(modoSelecao == ModoSelecao::PONDERADO) {
+            pontuacao.resize(n);
+            for(int i = 0; i < n; i++) {
+                pontuacao[i] = populacao[i].fitness * 0.7 + populacao[i].novidade * 0.3;
+            }
+            classificacao.clear();
+            return;
+        }
+        classificacao = classificarPareto();
+    }
+
+    std::vector<SelecaoMultiobjetivo::Classificacao> classificarPareto() const {
+        const int n = populacao.size();
+        size_t numExtras = 0;
+        for(const auto& ind : populacao) numExtras = std::max(numExtras, ind.objetivosExtras.size());
+        const int numObjetivos = 2 + numExtras;
+        std::vector<double> objetivos((size_t)n * numObjetivos, 0.0);
+        for(int i = 0; i < n; i++) {
+            double* linha = &objetivos[(size_t)i * numObjetivos];
+            linha[0] = populacao[i].fitness;
+            linha[1] = populacao[i].novidade;
+            std::copy(populacao[i].objetivosExtras.begin(), populacao[i].objetivosExtras.end(), linha + 2);
+        }
+        return SelecaoMultiobjetivo::classificar(objetivos, numObjetivos);
+    }
+
+    bool melhorQue(int a, int b) const {
+        if(modoSelecao == ModoSelecao::PARETO) {
+            return SelecaoMultiobjetivo::melhor(classificacao[a], classificacao[b]);
+        }
+        return pontuacao[a] > pontuacao[b];
+    }
+    
+    std::vector<Individuo> selecionarElite() {
+        std::vector<int> indices(populacao.size());
+        std::iota(indices.begin(), indices.end(), 0);
+        
+        // Só os NUM_ELITISMO primeiros precisam ficar ordenados
+        int numElite = std::min<int>(NUM_ELITISMO, indices.size());
+        std::partial_sort(indices.begin(), indices.begin() + numElite, indices.end(),
+            [this](int a, int b) { return melhorQue(a, b); });
+        
+        std::vector<Individuo> elite;
+        for(int i = 0; i < numElite; i++) {
+            elite.push_back(populacao[indices[i]]);
+        }
+        return elite;
+    }
+    
+    Individuo& selecaoTorneio() {
+        const int TAMANHO_TORNEIO = 5;
+        
+        int melhor = std::rand() % populacao.size();
+        for(int i = 1; i < TAMANHO_TORNEIO; i++) {
+            int idx = std::rand() % populacao.size();
+            if(melhorQue(idx, melhor)) melhor = idx;
+        }
+        return populacao[melhor];
+    }
+    
+    void mutacao(std::vector<double>& pesos) {
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::normal_distribution<> d(0, INTENSIDADE_MUTACAO);
+        
+        for(double& peso : pesos) {
+            if(std::rand() / (float)RAND_MAX < TAXA_MUTACAO) {
+                peso += d(gen);
+            }
+        }
+    }
+    
+    void mutacaoSuave(std::vector<double>& pesos) {
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::normal_distribution<> d(0, INTENSIDADE_MUTACAO_SUAVE);
+        
+        for(double& peso : pesos) {
+            if(std::rand() / (float)RAND_MAX < TAXA_MUTACAO_SUAVE) {
+                peso += d(gen);
+            }
+        }
+    }
+    
+    void crossover(const std::vector<double>& pesos1, 
+                  const std::vector<double>& pesos2,
+                  std::vector<double>& filho1,
+                  std::vector<double>& filho2) {
+        for(size_t i = 0; i < pesos1.size(); i++) {
+            if(std::rand() / (float)RAND_MAX < 0.5) {
+                filho1[i] = pesos2[i];
+                filho2[i] = pesos1[i];
+            }
+        }
+    }
 }; 
\ No newline at end of file
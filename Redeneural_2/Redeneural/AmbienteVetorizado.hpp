@@ -0,0 +1,23 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+
+// Ambiente que simula um episódio por indivíduo, todos avançando em lote.
+// As matrizes são planas em ordem de linha: uma linha por indivíduo.
+class AmbienteVetorizado {
+public:
+    virtual ~AmbienteVetorizado() = default;
+
+    // Reinicia 'quantidade' episódios e escreve as observações iniciais
+    // (quantidade x entradas da rede)
+    virtual void reset(int quantidade, std::vector<double>& observacoes) = 0;
+
+    // Aplica as ações (quantidade x saídas da rede) dos episódios ativos.
+    // Escreve as novas observações, a recompensa do passo e, em 'terminados',
+    // 1 para os episódios que acabaram neste passo.
+    virtual void step(const std::vector<double>& acoes,
+                      const std::vector<uint8_t>& ativos,
+                      std::vector<double>& observacoes,
+                      std::vector<double>& recompensas,
+                      std::vector<uint8_t>& terminados) = 0;
+};
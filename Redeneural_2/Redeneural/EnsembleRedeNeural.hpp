@@ -0,0 +1,215 @@
+#pragma once
+#include "RedeNeural.hpp"
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+// Conjunto de K redes com a mesma topologia e as mesmas ativações avaliadas
+// numa única passada. Os pesos (e bias) ficam intercalados: o peso w de todos
+// os modelos ocupa K posições contíguas (pesos[w * K + k]), assim como os
+// valores de cada neurônio.
+// Cada produto vira um laço de K elementos sem desvios, que o compilador
+// vetoriza, e os pesos são lidos em sequência uma vez só; para K pequeno o
+// custo fica próximo ao de uma rede.
+class EnsembleRedeNeural {
+public:
+    // MEDIA: média das saídas dos modelos
+    // MAIORIA: fração dos votos; com uma saída, cada modelo vota saída > 0.5,
+    //          com várias, vota na de maior valor
+    // MAIOR_CONFIANCA: saídas do modelo mais longe de 0.5 em alguma saída
+    enum class Agregacao { MEDIA, MAIORIA, MAIOR_CONFIANCA };
+
+    EnsembleRedeNeural(const std::vector<RedeNeural>& redes, Agregacao agregacao = Agregacao::MEDIA)
+        : numModelos(redes.size()), agregacao(agregacao) {
+        if(redes.empty()) {
+            throw std::runtime_error("Ensemble sem redes");
+        }
+        tamanhos = redes[0].getTopologia();
+        ativacoes.resize(tamanhos.size());
+        for(size_t c = 1; c < tamanhos.size(); c++) {
+            ativacoes[c] = redes[0].getAtivacoes(c);
+        }
+        const int numPesos = redes[0].getQuantidadePesos();
+        pesos.resize(static_cast<size_t>(numPesos) * numModelos);
+        std::vector<double> genes;
+        for(int k = 0; k < numModelos; k++) {
+            if(redes[k].getTopologia() != tamanhos) {
+                throw std::runtime_error("Redes do ensemble com topologias diferentes");
+            }
+            for(size_t c = 1; c < tamanhos.size(); c++) {
+                if(redes[k].getAtivacoes(c) != ativacoes[c]) {
+                    throw std::runtime_error("Redes do ensemble com ativações diferentes");
+                }
+            }
+            redes[k].copiarCamadasParaVetor(genes);
+            for(int w = 0; w < numPesos; w++) {
+                pesos[static_cast<size_t>(w) * numModelos + k] = genes[w];
+            }
+        }
+
+        int maior = 0;
+        for(int tamanho : tamanhos) {
+            maior = std::max(maior, tamanho);
+        }
+        atual.resize(static_cast<size_t>(maior) * numModelos);
+        proximo.resize(static_cast<size_t>(maior) * numModelos);
+        saidasModelos.resize(static_cast<size_t>(tamanhos.back()) * numModelos);
+        saidas.resize(tamanhos.back());
+    }
+
+    // Avalia os K modelos e escreve a saída agregada (getNumSaidas() valores)
+    void calcularSaida(const double* entrada, double* saida) {
+        const int K = numModelos;
+
+        // Entrada replicada por modelo
+        for(int j = 0; j < tamanhos[0]; j++) {
+            std::fill(atual.begin() + static_cast<size_t>(j) * K,
+                      atual.begin() + static_cast<size_t>(j + 1) * K, entrada[j]);
+        }
+
+        const double* w = pesos.data();
+        const size_t numCamadas = tamanhos.size();
+        for(size_t c = 1; c < numCamadas; c++) {
+            const int tamanhoOrigem = tamanhos[c - 1];
+            const bool ultima = c + 1 == numCamadas;
+            double* destino = ultima ? saidasModelos.data() : proximo.data();
+            switch(K) {
+            case 1: w = camada<1>(w, atual.data(), destino, tamanhoOrigem, tamanhos[c]); break;
+            case 2: w = camada<2>(w, atual.data(), destino, tamanhoOrigem, tamanhos[c]); break;
+            case 4: w = camada<4>(w, atual.data(), destino, tamanhoOrigem, tamanhos[c]); break;
+            case 8: w = camada<8>(w, atual.data(), destino, tamanhoOrigem, tamanhos[c]); break;
+            default:
+                for(int i = 0; i < tamanhos[c]; i++) {
+                    double* soma = destino + static_cast<size_t>(i) * K;
+                    std::fill(soma, soma + K, 0.0);
+                    for(int j = 0; j < tamanhoOrigem; j++) {
+                        const double* origem = atual.data() + static_cast<size_t>(j) * K;
+                        for(int k = 0; k < K; k++) {
+                            soma[k] += w[k] * origem[k];
+                        }
+                        w += K;
+                    }
+                    for(int k = 0; k < K; k++) {
+                        soma[k] += w[k];
+                    }
+                    w += K;
+                }
+            }
+
+            // Mesmas ativações de calcularSaida; cada neurônio ocupa K valores
+            RedeNeural::aplicarAtivacoes(ativacoes[c].data(), tamanhos[c], destino, K);
+            if(!ultima) {
+                std::swap(atual, proximo);
+            }
+        }
+
+        agregar(saida);
+    }
+
+    const std::vector<double>& calcularSaida(const std::vector<double>& entrada) {
+        if(entrada.size() < static_cast<size_t>(tamanhos[0])) {
+            throw std::runtime_error("Número de entradas menor que o da rede");
+        }
+        calcularSaida(entrada.data(), saidas.data());
+        return saidas;
+    }
+
+    // Saída 'i' do modelo 'k' na última avaliação
+    double getSaidaModelo(int k, int i) const { return saidasModelos[static_cast<size_t>(i) * numModelos + k]; }
+
+    void setAgregacao(Agregacao novaAgregacao) { agregacao = novaAgregacao; }
+    Agregacao getAgregacao() const { return agregacao; }
+    int getNumModelos() const { return numModelos; }
+    int getNumEntradas() const { return tamanhos.front(); }
+    int getNumSaidas() const { return tamanhos.back(); }
+
+private:
+    int numModelos;
+    Agregacao agregacao;
+    std::vector<int> tamanhos;       // neurônios por camada, da entrada à saída
+    std::vector<std::vector<TipoAtivacao>> ativacoes;  // por camada, comuns aos modelos
+    std::vector<double> pesos;       // intercalados: pesos[w * numModelos + k]
+    std::vector<double> atual;
+    std::vector<double> proximo;
+    std::vector<double> saidasModelos;
+    std::vector<double> saidas;
+
+    // Produto de uma camada com K fixo: as K somas ficam em registradores e o
+    // laço interno vira instruções vetoriais de largura K. Cada linha termina
+    // pelos K bias. Retorna o próximo peso.
+    template<int K>
+    static const double* camada(const double* w, const double* origem, double* destino,
+                                int tamanhoOrigem, int tamanhoDestino) {
+        for(int i = 0; i < tamanhoDestino; i++) {
+            double soma[K] = {};
+            for(int j = 0; j < tamanhoOrigem; j++) {
+                for(int k = 0; k < K; k++) {
+                    soma[k] += w[k] * origem[j * K + k];
+                }
+                w += K;
+            }
+            for(int k = 0; k < K; k++) {
+                soma[k] += w[k];
+            }
+            w += K;
+            std::copy(soma, soma + K, destino + static_cast<size_t>(i) * K);
+        }
+        return w;
+    }
+
+    void agregar(double* saida) const {
+        const int K = numModelos;
+        const int numSaidas = tamanhos.back();
+        const double* s = saidasModelos.data();
+
+        switch(agregacao) {
+        case Agregacao::MEDIA:
+            for(int i = 0; i < numSaidas; i++) {
+                double soma = 0.0;
+                for(int k = 0; k < K; k++) {
+                    soma += s[i * K + k];
+                }
+                saida[i] = soma / K;
+            }
+            break;
+
+        case Agregacao::MAIORIA:
+            if(numSaidas == 1) {
+                int votos = 0;
+                for(int k = 0; k < K; k++) {
+                    votos += s[k] > 0.5;
+                }
+                saida[0] = static_cast<double>(votos) / K;
+            } else {
+                std::fill(saida, saida + numSaidas, 0.0);
+                for(int k = 0; k < K; k++) {
+                    int escolhida = 0;
+                    for(int i = 1; i < numSaidas; i++) {
+                        if(s[i * K + k] > s[escolhida * K + k]) escolhida = i;
+                    }
+                    saida[escolhida] += 1.0 / K;
+                }
+            }
+            break;
+
+        case Agregacao::MAIOR_CONFIANCA: {
+            int melhor = 0;
+            double maiorConfianca = -1.0;
+            for(int k = 0; k < K; k++) {
+                for(int i = 0; i < numSaidas; i++) {
+                    double confianca = std::abs(s[i * K + k] - 0.5);
+                    if(confianca > maiorConfianca) {
+                        maiorConfianca = confianca;
+                        melhor = k;
+                    }
+                }
+            }
+            for(int i = 0; i < numSaidas; i++) {
+                saida[i] = s[i * K + melhor];
+            }
+            break;
+        }
+        }
+    }
+};
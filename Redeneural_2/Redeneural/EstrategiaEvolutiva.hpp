@@ -0,0 +1,293 @@
+#pragma once
+#include "RedeNeural.hpp"
+#include "AmbienteVetorizado.hpp"
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <functional>
+#include <thread>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+// Estratégia evolutiva no estilo OpenAI-ES sobre o vetor de pesos da rede
+// (layout de copiarCamadasParaVetor). Alternativa ao AlgoritmoGenetico com a
+// mesma interface de avaliação: cada geração amostra pares antitéticos
+// θ ± σε, avalia em paralelo, transforma o fitness em ranks centrados e
+// aplica o gradiente estimado com Adam. Os ruídos nunca ficam guardados:
+// cada par é reconstruído a partir da semente da geração e do índice.
+class EstrategiaEvolutiva {
+public:
+    struct Configuracao {
+        int numPares;            // a população tem 2 * numPares perturbações
+        double sigma;            // desvio do ruído
+        double taxaAprendizado;  // passo do Adam
+        double beta1;
+        double beta2;
+        double decaimentoPesos;  // penalidade L2 sobre θ
+        int numThreads;          // 0 = núcleos disponíveis
+        uint64_t semente;
+
+        Configuracao() {
+            numPares = 50;
+            sigma = 0.05;
+            taxaAprendizado = 0.01;
+            beta1 = 0.9;
+            beta2 = 0.999;
+            decaimentoPesos = 0.005;
+            numThreads = 0;
+            semente = 42;
+        }
+    };
+
+    EstrategiaEvolutiva(int numCamadasEscondidas,
+                        int numEntradas,
+                        int numNeuroniosEscondidos,
+                        int numSaidas,
+                        const Configuracao& config = Configuracao())
+        : config(config),
+          numEntradas(numEntradas),
+          numSaidas(numSaidas),
+          modelo(numCamadasEscondidas, numEntradas, numNeuroniosEscondidos, numSaidas),
+          melhorRede(modelo),
+          gerador(config.semente),
+          geracao(0),
+          indiceMelhor(-1) {
+        inicializarPopulacao();
+    }
+
+    // Recomeça a partir de 'rede', que precisa ter a mesma topologia: as
+    // ativações passam a ser as dela e θ começa nos seus pesos e bias
+    void setArquitetura(const RedeNeural& rede) {
+        if(rede.getTopologia() != modelo.getTopologia()) {
+            throw std::runtime_error("Arquitetura com topologia diferente da estratégia");
+        }
+        modelo = rede;
+        melhorRede = rede;
+        inicializarPopulacao();
+    }
+
+    // Recomeça a partir dos pesos aleatórios da rede modelo
+    void inicializarPopulacao() {
+        modelo.copiarCamadasParaVetor(theta);
+        momento.assign(theta.size(), 0.0);
+        velocidade.assign(theta.size(), 0.0);
+        fitness.assign(2 * config.numPares, 0.0);
+        geracao = 0;
+        indiceMelhor = -1;
+        semente = gerador();
+    }
+
+    // Avalia todas as perturbações em paralelo. Cada thread usa a sua cópia da
+    // rede, então a função só precisa ser segura para chamadas concorrentes.
+    void avaliarPopulacao(const std::function<double(RedeNeural&)>& funcaoAvaliacao) {
+        const int n = getTamanhoPopulacao();
+        std::atomic<int> proximo(0);
+
+        auto trabalhador = [&]() {
+            RedeNeural rede = modelo;
+            std::vector<double> pesos(theta.size());
+            std::vector<double> ruido(theta.size());
+            int i;
+            while((i = proximo.fetch_add(1)) < n) {
+                montarPesos(i, ruido, pesos);
+                rede.copiarVetorParaCamadas(pesos);
+                fitness[i] = funcaoAvaliacao(rede);
+            }
+        };
+        executarEmParalelo(trabalhador);
+        registrarMelhor();
+    }
+
+    // Avalia todas as perturbações num ambiente vetorizado, como no AlgoritmoGenetico
+    void avaliarPopulacao(AmbienteVetorizado& ambiente, int maxPassos) {
+        const int n = getTamanhoPopulacao();
+        const size_t numPesos = theta.size();
+
+        std::vector<double> pesos(static_cast<size_t>(n) * numPesos);
+        std::vector<double> ruido(numPesos);
+        std::vector<double> linha(numPesos);
+        for(int i = 0; i < n; i++) {
+            montarPesos(i, ruido, linha);
+            std::copy(linha.begin(), linha.end(), pesos.begin() + static_cast<size_t>(i) * numPesos);
+        }
+
+        std::vector<double> observacoes(static_cast<size_t>(n) * numEntradas);
+        std::vector<double> acoes(static_cast<size_t>(n) * numSaidas, 0.0);
+        std::vector<double> recompensas(n, 0.0);
+        std::vector<double> rascunho(modelo.getTamanhoRascunho());
+        std::vector<uint8_t> ativos(n, 1);
+        std::vector<uint8_t> terminados(n, 0);
+        std::fill(fitness.begin(), fitness.end(), 0.0);
+        int numAtivos = n;
+
+        ambiente.reset(n, observacoes);
+        for(int passo = 0; passo < maxPassos && numAtivos > 0; passo++) {
+            for(int i = 0; i < n; i++) {
+                if(!ativos[i]) continue;
+                modelo.calcularSaidaComPesos(&pesos[static_cast<size_t>(i) * numPesos],
+                                             &observacoes[static_cast<size_t>(i) * numEntradas],
+                                             &acoes[static_cast<size_t>(i) * numSaidas],
+                                             rascunho.data());
+            }
+
+            std::fill(terminados.begin(), terminados.end(), 0);
+            ambiente.step(acoes, ativos, observacoes, recompensas, terminados);
+
+            for(int i = 0; i < n; i++) {
+                if(!ativos[i]) continue;
+                fitness[i] += recompensas[i];
+                if(terminados[i]) {
+                    ativos[i] = 0;
+                    numAtivos--;
+                }
+            }
+        }
+        registrarMelhor();
+    }
+
+    // Estima o gradiente a partir dos ranks e atualiza θ com Adam
+    void evoluir() {
+        const int n = getTamanhoPopulacao();
+        const size_t numPesos = theta.size();
+
+        // Ranks centrados em [-0.5, 0.5]: imunes à escala e a outliers do fitness
+        std::vector<int> ordem(n);
+        for(int i = 0; i < n; i++) ordem[i] = i;
+        std::sort(ordem.begin(), ordem.end(),
+                  [this](int a, int b) { return fitness[a] < fitness[b]; });
+        std::vector<double> utilidade(n);
+        for(int r = 0; r < n; r++) {
+            utilidade[ordem[r]] = n > 1 ? static_cast<double>(r) / (n - 1) - 0.5 : 0.0;
+        }
+
+        // Cada thread reconstrói os ruídos de um bloco de pares e acumula localmente
+        int numThreads = obterNumThreads();
+        std::vector<std::vector<double>> parciais(numThreads, std::vector<double>(numPesos, 0.0));
+        std::atomic<int> proximoPar(0);
+        std::atomic<int> proximaThread(0);
+        auto trabalhador = [&]() {
+            std::vector<double>& parcial = parciais[proximaThread.fetch_add(1)];
+            std::vector<double> ruido(numPesos);
+            int par;
+            while((par = proximoPar.fetch_add(1)) < config.numPares) {
+                gerarRuido(par, ruido);
+                double peso = utilidade[2 * par] - utilidade[2 * par + 1];
+                for(size_t j = 0; j < numPesos; j++) {
+                    parcial[j] += peso * ruido[j];
+                }
+            }
+        };
+        executarEmParalelo(trabalhador, numThreads);
+
+        geracao++;
+        const double escala = 1.0 / (n * config.sigma);
+        const double correcao1 = 1.0 - std::pow(config.beta1, geracao);
+        const double correcao2 = 1.0 - std::pow(config.beta2, geracao);
+        for(size_t j = 0; j < numPesos; j++) {
+            double gradiente = -config.decaimentoPesos * theta[j];
+            for(const auto& parcial : parciais) {
+                gradiente += parcial[j] * escala;
+            }
+
+            // Subida do gradiente (maximizar fitness)
+            momento[j] = config.beta1 * momento[j] + (1.0 - config.beta1) * gradiente;
+            velocidade[j] = config.beta2 * velocidade[j] + (1.0 - config.beta2) * gradiente * gradiente;
+            double mChapeu = momento[j] / correcao1;
+            double vChapeu = velocidade[j] / correcao2;
+            theta[j] += config.taxaAprendizado * mChapeu / (std::sqrt(vChapeu) + 1e-8);
+        }
+
+        semente = gerador();
+        indiceMelhor = -1;
+    }
+
+    // Melhor perturbação avaliada na geração atual
+    RedeNeural& getMelhorIndividuo() { return melhorRede; }
+
+    // Rede com os pesos médios θ, que é o que a estratégia otimiza
+    RedeNeural getRedeMedia() const {
+        RedeNeural rede = modelo;
+        rede.copiarVetorParaCamadas(theta);
+        return rede;
+    }
+
+    size_t getTamanhoPopulacao() const { return 2 * config.numPares; }
+    double getFitness(size_t index) const { return fitness[index]; }
+    int getGeracao() const { return geracao; }
+
+    double getMelhorFitness() const {
+        return indiceMelhor >= 0 ? fitness[indiceMelhor] : -1e9;
+    }
+
+    double getMediaFitness() const {
+        double soma = 0;
+        for(double valor : fitness) {
+            soma += valor;
+        }
+        return soma / fitness.size();
+    }
+
+private:
+    Configuracao config;
+    int numEntradas;
+    int numSaidas;
+    RedeNeural modelo;            // só define a arquitetura (topologia e ativações) e os pesos iniciais
+    RedeNeural melhorRede;
+    std::vector<double> theta;
+    std::vector<double> momento;
+    std::vector<double> velocidade;
+    std::vector<double> fitness;  // índice 2k = θ + σε_k, 2k + 1 = θ - σε_k
+    std::mt19937_64 gerador;
+    uint64_t semente;             // semente dos ruídos da geração atual
+    int geracao;
+    int indiceMelhor;
+
+    // Ruído do par reconstruído deterministicamente a partir da semente da geração
+    void gerarRuido(int par, std::vector<double>& ruido) const {
+        std::mt19937_64 geradorPar(semente ^ (0x9E3779B97F4A7C15ULL * (par + 1)));
+        std::normal_distribution<double> normal(0.0, 1.0);
+        for(double& valor : ruido) {
+            valor = normal(geradorPar);
+        }
+    }
+
+    void montarPesos(int indice, std::vector<double>& ruido, std::vector<double>& pesos) const {
+        gerarRuido(indice / 2, ruido);
+        double sinal = (indice % 2 == 0) ? config.sigma : -config.sigma;
+        for(size_t j = 0; j < theta.size(); j++) {
+            pesos[j] = theta[j] + sinal * ruido[j];
+        }
+    }
+
+    void registrarMelhor() {
+        indiceMelhor = std::max_element(fitness.begin(), fitness.end()) - fitness.begin();
+        std::vector<double> ruido(theta.size());
+        std::vector<double> pesos(theta.size());
+        montarPesos(indiceMelhor, ruido, pesos);
+        melhorRede.copiarVetorParaCamadas(pesos);
+    }
+
+    int obterNumThreads() const {
+        int numThreads = config.numThreads > 0 ? config.numThreads
+                                                : static_cast<int>(std::thread::hardware_concurrency());
+        return std::max(1, std::min(numThreads, config.numPares));
+    }
+
+    template<typename Funcao>
+    void executarEmParalelo(Funcao& trabalhador, int numThreads = 0) {
+        if(numThreads <= 0) numThreads = obterNumThreads();
+        if(numThreads == 1) {
+            trabalhador();
+            return;
+        }
+        std::vector<std::thread> threads;
+        for(int t = 0; t < numThreads; t++) {
+            threads.emplace_back(std::ref(trabalhador));
+        }
+        for(auto& thread : threads) {
+            thread.join();
+        }
+    }
+};
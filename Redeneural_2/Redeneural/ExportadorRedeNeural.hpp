@@ -0,0 +1,174 @@
+#pragma once
+#include "RedeNeural.hpp"
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <cstdio>
+#include <cctype>
+#include <cmath>
+#include <stdexcept>
+
+// Gera um cabeçalho C++ autônomo que avalia uma RedeNeural fixa: uma matriz
+// constexpr de pesos e um vetor de bias por camada e laços com limites
+// constantes, que o compilador desenrola e vetoriza. As ativações são cópias
+// das de RedeNeural::aplicarAtivacao, com a mesma exponencial, então o código
+// gerado dá as mesmas saídas. Dispensa a biblioteca e o carregarRede.
+class ExportadorRedeNeural {
+public:
+    // namespace 'nome' com NUM_ENTRADAS, NUM_SAIDAS e
+    // void avaliar(const double* entradas, double* saidas)
+    static std::string gerar(const RedeNeural& rede, const std::string& nome) {
+        validarNome(nome);
+        const std::vector<int> tamanhos = rede.getTopologia();
+
+        std::vector<double> pesos;
+        rede.copiarCamadasParaVetor(pesos);
+
+        std::ostringstream codigo;
+        codigo << "// Gerado por ExportadorRedeNeural: " << tamanhos.front() << " entradas, "
+               << tamanhos.back() << " saídas, " << pesos.size() << " pesos\n"
+               << "#pragma once\n#include <algorithm>\n#include <cmath>\n#include <cstdint>\n#include <cstring>\n\n"
+               << "namespace " << nome << " {\n\n"
+               << "constexpr int NUM_ENTRADAS = " << tamanhos.front() << ";\n"
+               << "constexpr int NUM_SAIDAS = " << tamanhos.back() << ";\n\n";
+
+        // Uma matriz [neurônios][entradas] e um vetor de bias por camada
+        size_t pos = 0;
+        for(size_t c = 1; c < tamanhos.size(); c++) {
+            std::vector<double> bias;
+            codigo << "constexpr double PESOS_" << c << "[" << tamanhos[c] << "][" << tamanhos[c - 1] << "] = {\n";
+            for(int i = 0; i < tamanhos[c]; i++) {
+                codigo << "    {";
+                for(int j = 0; j < tamanhos[c - 1]; j++) {
+                    codigo << (j > 0 ? ", " : "") << literal(pesos[pos++]);
+                }
+                bias.push_back(pesos[pos++]);
+                codigo << "}" << (i + 1 < tamanhos[c] ? "," : "") << "\n";
+            }
+            codigo << "};\n";
+            codigo << "constexpr double BIAS_" << c << "[" << tamanhos[c] << "] = {";
+            for(size_t i = 0; i < bias.size(); i++) {
+                codigo << (i > 0 ? ", " : "") << literal(bias[i]);
+            }
+            codigo << "};\n\n";
+        }
+        codigo << funcoesAtivacao();
+
+        codigo << "inline void avaliar(const double* entradas, double* saidas) {\n";
+        std::string origem = "entradas";
+        for(size_t c = 1; c < tamanhos.size(); c++) {
+            bool saida = c + 1 == tamanhos.size();
+            std::string destino = saida ? "saidas" : "c" + std::to_string(c);
+            if(!saida) {
+                codigo << "    double " << destino << "[" << tamanhos[c] << "];\n";
+            }
+            codigo << "    for(int i = 0; i < " << tamanhos[c] << "; i++) {\n"
+                   << "        double soma = 0;\n"
+                   << "        for(int j = 0; j < " << tamanhos[c - 1] << "; j++) {\n"
+                   << "            soma += PESOS_" << c << "[i][j] * " << origem << "[j];\n"
+                   << "        }\n"
+                   << "        " << destino << "[i] = soma + BIAS_" << c << "[i];\n"
+                   << "    }\n";
+
+            // Um laço por trecho de neurônios com a mesma ativação
+            const std::vector<TipoAtivacao>& tipos = rede.getAtivacoes(c);
+            for(size_t inicio = 0; inicio < tipos.size();) {
+                size_t fim = inicio + 1;
+                while(fim < tipos.size() && tipos[fim] == tipos[inicio]) fim++;
+                const char* funcao = nomeFuncao(tipos[inicio]);
+                if(funcao) {
+                    codigo << "    for(int i = " << inicio << "; i < " << fim << "; i++) "
+                           << destino << "[i] = " << funcao << "(" << destino << "[i]);\n";
+                }
+                inicio = fim;
+            }
+            origem = destino;
+        }
+        codigo << "}\n\n} // namespace " << nome << "\n";
+        return codigo.str();
+    }
+
+    static void exportar(const RedeNeural& rede, const std::string& arquivo, const std::string& nome) {
+        std::ofstream out(arquivo);
+        if(!out) {
+            throw std::runtime_error("Erro ao abrir arquivo para escrita: " + arquivo);
+        }
+        out << gerar(rede, nome);
+    }
+
+private:
+    // Função gerada para cada ativação; nullptr para a identidade
+    static const char* nomeFuncao(TipoAtivacao tipo) {
+        switch(tipo) {
+        case TipoAtivacao::SIGMOIDE:  return "sigmoide";
+        case TipoAtivacao::TANH:      return "tangente";
+        case TipoAtivacao::RELU:      return "relu";
+        case TipoAtivacao::DEGRAU:    return "degrau";
+        case TipoAtivacao::GAUSSIANA: return "gaussiana";
+        default:                      return nullptr;
+        }
+    }
+
+    // Mesmas contas de RedeNeural::aplicarAtivacao (redeNeural.cpp), na mesma ordem
+    static std::string funcoesAtivacao() {
+        return
+            "inline double saturar(double x, double limite) { return std::min(limite, std::max(-limite, x)); }\n\n"
+            "inline double expVetorial(double x) {\n"
+            "    double t = x * 1.4426950408889634;\n"
+            "    double m = t + 6755399441055744.0;\n"
+            "    int64_t inteiro;\n"
+            "    std::memcpy(&inteiro, &m, sizeof(inteiro));\n"
+            "    inteiro -= 0x4338000000000000LL;\n"
+            "    double g = (t - (m - 6755399441055744.0)) * 0.6931471805599453;\n"
+            "    double p = 1.0 / 479001600.0;\n"
+            "    p = p * g + 1.0 / 39916800.0;\n"
+            "    p = p * g + 1.0 / 3628800.0;\n"
+            "    p = p * g + 1.0 / 362880.0;\n"
+            "    p = p * g + 1.0 / 40320.0;\n"
+            "    p = p * g + 1.0 / 5040.0;\n"
+            "    p = p * g + 1.0 / 720.0;\n"
+            "    p = p * g + 1.0 / 120.0;\n"
+            "    p = p * g + 1.0 / 24.0;\n"
+            "    p = p * g + 1.0 / 6.0;\n"
+            "    p = p * g + 0.5;\n"
+            "    p = p * g + 1.0;\n"
+            "    p = p * g + 1.0;\n"
+            "    int64_t bits;\n"
+            "    std::memcpy(&bits, &p, sizeof(bits));\n"
+            "    bits += inteiro * (int64_t(1) << 52);\n"
+            "    double resultado;\n"
+            "    std::memcpy(&resultado, &bits, sizeof(resultado));\n"
+            "    return resultado;\n"
+            "}\n\n"
+            "inline double sigmoide(double x) { return 1.0 / (1.0 + expVetorial(-saturar(x, 350.0))); }\n"
+            "inline double tangente(double x) { return 1.0 - 2.0 / (expVetorial(2.0 * saturar(x, 350.0)) + 1.0); }\n"
+            "inline double relu(double x) { return std::max(0.0, x); }\n"
+            "inline double degrau(double x) { return x > 0.0 ? 1.0 : 0.0; }\n"
+            "inline double gaussiana(double x) { x = saturar(x, 26.0); return expVetorial(-x * x); }\n\n";
+    }
+
+    // 'nome' vira o namespace do código gerado
+    static void validarNome(const std::string& nome) {
+        bool valido = !nome.empty() && !std::isdigit(static_cast<unsigned char>(nome[0]));
+        for(char c : nome) {
+            if(!std::isalnum(static_cast<unsigned char>(c)) && c != '_') valido = false;
+        }
+        if(!valido) {
+            throw std::runtime_error("Nome inválido para o código gerado: " + nome);
+        }
+    }
+
+    // Literal que reproduz exatamente o double (17 dígitos significativos).
+    // NaN e infinitos usam as macros de <cmath>.
+    static std::string literal(double valor) {
+        if(std::isnan(valor)) return "NAN";
+        if(std::isinf(valor)) return valor > 0 ? "INFINITY" : "(-INFINITY)";
+        char texto[40];
+        std::snprintf(texto, sizeof(texto), "%.17g", valor);
+        std::string resultado(texto);
+        if(resultado.find_first_of(".eE") == std::string::npos) {
+            resultado += ".0";
+        }
+        return resultado;
+    }
+};
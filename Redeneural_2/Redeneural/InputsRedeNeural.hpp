@@ -1,19 +1,257 @@
-#pragma once
-#include <vector>
-
-class InputsRedeNeural {
-public:
-    // Métodos estáticos para processar entradas da rede
-    static std::vector<double> processarEntradas(const std::vector<double>& dadosEntrada) {
-        std::vector<double> entradas;
-        entradas.reserve(dadosEntrada.size());
-        
-        // Aqui você pode adicionar qualquer pré-processamento necessário
-        // dos dados de entrada antes de alimentar a rede neural
-        for(const auto& dado : dadosEntrada) {
-            entradas.push_back(dado);
-        }
-        
-        return entradas;
-    }
-};
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+// Pré-processamento das observações antes da rede: etapas compostas na ordem
+// em que são adicionadas (normalização, corte, escala) e empilhamento dos
+// últimos quadros. Todos os buffers são alocados na configuração; por passo,
+// processarLote() roda sem alocar, no próprio vetor de observações, com laços
+// sem desvios que o compilador vetoriza.
+//
+// Uma instância serve a população inteira: as estatísticas da normalização
+// são compartilhadas e o histórico de quadros tem uma posição por indivíduo.
+// aplicar() só lê o estado e pode ser chamado de várias threads; observar(),
+// empilhar() e processarLote() não.
+class InputsRedeNeural {
+public:
+    enum class TipoEtapa { NORMALIZAR, CORTAR, ESCALAR };
+
+    struct Etapa {
+        TipoEtapa tipo;
+        double a;  // NORMALIZAR: epsilon; CORTAR: mínimo; ESCALAR: fator
+        double b;  // CORTAR: máximo; ESCALAR: deslocamento
+    };
+
+private:
+    int tamanhoObservacao;
+    std::vector<Etapa> etapas;
+    bool atualizarEstatisticas;
+
+    // Média e variância acumuladas (Welford, com lotes combinados por Chan)
+    double contagem;
+    std::vector<double> media;
+    std::vector<double> m2;
+    std::vector<double> inversoDesvio;  // 1 / sqrt(variância + epsilon)
+    std::vector<double> mediaLote;
+    std::vector<double> m2Lote;
+    double epsilon;
+
+    // Histórico circular: quadros x tamanhoObservacao por posição
+    int quadros;
+    std::vector<double> historico;
+    std::vector<int> proximoQuadro;  // -1 = vazio desde o último reinício
+
+    void recalcularInversoDesvio() {
+        for(int i = 0; i < tamanhoObservacao; i++) {
+            double variancia = contagem > 1 ? m2[i] / contagem : 1.0;
+            inversoDesvio[i] = 1.0 / std::sqrt(variancia + epsilon);
+        }
+    }
+
+    bool normaliza() const {
+        return std::any_of(etapas.begin(), etapas.end(),
+                           [](const Etapa& e) { return e.tipo == TipoEtapa::NORMALIZAR; });
+    }
+
+public:
+    explicit InputsRedeNeural(int tamanhoObservacao = 0)
+        : tamanhoObservacao(tamanhoObservacao),
+          atualizarEstatisticas(true),
+          contagem(0.0),
+          media(tamanhoObservacao, 0.0),
+          m2(tamanhoObservacao, 0.0),
+          inversoDesvio(tamanhoObservacao, 1.0),
+          mediaLote(tamanhoObservacao, 0.0),
+          m2Lote(tamanhoObservacao, 0.0),
+          epsilon(1e-8),
+          quadros(1) {}
+
+    // Etapas, aplicadas na ordem em que são adicionadas
+    InputsRedeNeural& adicionarNormalizacao(double epsilonVariancia = 1e-8) {
+        epsilon = epsilonVariancia;
+        etapas.push_back({TipoEtapa::NORMALIZAR, epsilonVariancia, 0.0});
+        recalcularInversoDesvio();
+        return *this;
+    }
+
+    InputsRedeNeural& adicionarCorte(double minimo, double maximo) {
+        etapas.push_back({TipoEtapa::CORTAR, minimo, maximo});
+        return *this;
+    }
+
+    InputsRedeNeural& adicionarEscala(double fator, double deslocamento = 0.0) {
+        etapas.push_back({TipoEtapa::ESCALAR, fator, deslocamento});
+        return *this;
+    }
+
+    // A rede recebe os 'numQuadros' últimos quadros, do mais antigo ao mais novo
+    InputsRedeNeural& definirEmpilhamento(int numQuadros) {
+        quadros = std::max(1, numQuadros);
+        historico.assign(proximoQuadro.size() * quadros * tamanhoObservacao, 0.0);
+        std::fill(proximoQuadro.begin(), proximoQuadro.end(), -1);
+        return *this;
+    }
+
+    // Aloca o histórico de quadros para 'quantidade' indivíduos
+    void reservarEstados(int quantidade) {
+        proximoQuadro.assign(quantidade, -1);
+        historico.assign(static_cast<size_t>(quantidade) * quadros * tamanhoObservacao, 0.0);
+    }
+
+    // Início de episódio: o próximo quadro preenche todo o histórico da posição
+    void reiniciar(int indice) { proximoQuadro[indice] = -1; }
+    void reiniciarTodos() { std::fill(proximoQuadro.begin(), proximoQuadro.end(), -1); }
+
+    // Estatísticas congeladas (avaliação do campeão, por exemplo)
+    void setAtualizarEstatisticas(bool atualizar) { atualizarEstatisticas = atualizar; }
+
+    // Acumula 'quantidade' observações (linhas contíguas) na média e variância.
+    // Linhas com ativos[i] == 0 são ignoradas.
+    void observar(const double* observacoes, int quantidade, const uint8_t* ativos = nullptr) {
+        std::fill(mediaLote.begin(), mediaLote.end(), 0.0);
+        std::fill(m2Lote.begin(), m2Lote.end(), 0.0);
+        double* mb = mediaLote.data();
+        double* sb = m2Lote.data();
+        double n = 0.0;
+        for(int r = 0; r < quantidade; r++) {
+            if(ativos && !ativos[r]) continue;
+            n += 1.0;
+            const double* linha = observacoes + static_cast<size_t>(r) * tamanhoObservacao;
+            for(int i = 0; i < tamanhoObservacao; i++) {
+                mb[i] += linha[i];
+            }
+        }
+        if(n == 0.0) return;
+        for(int i = 0; i < tamanhoObservacao; i++) {
+            mb[i] /= n;
+        }
+        for(int r = 0; r < quantidade; r++) {
+            if(ativos && !ativos[r]) continue;
+            const double* linha = observacoes + static_cast<size_t>(r) * tamanhoObservacao;
+            for(int i = 0; i < tamanhoObservacao; i++) {
+                double d = linha[i] - mb[i];
+                sb[i] += d * d;
+            }
+        }
+
+        const double total = contagem + n;
+        const double pesoLote = n / total;
+        const double pesoCruzado = contagem * n / total;
+        for(int i = 0; i < tamanhoObservacao; i++) {
+            double delta = mb[i] - media[i];
+            media[i] += delta * pesoLote;
+            m2[i] += sb[i] + delta * delta * pesoCruzado;
+        }
+        contagem = total;
+        recalcularInversoDesvio();
+    }
+
+    // Aplica as etapas em 'quantidade' observações, no lugar
+    void aplicar(double* dados, int quantidade) const {
+        const double* mu = media.data();
+        const double* inv = inversoDesvio.data();
+        for(int r = 0; r < quantidade; r++) {
+            double* x = dados + static_cast<size_t>(r) * tamanhoObservacao;
+            for(const Etapa& etapa : etapas) {
+                switch(etapa.tipo) {
+                case TipoEtapa::NORMALIZAR:
+                    for(int i = 0; i < tamanhoObservacao; i++) {
+                        x[i] = (x[i] - mu[i]) * inv[i];
+                    }
+                    break;
+                case TipoEtapa::CORTAR: {
+                    const double minimo = etapa.a;
+                    const double maximo = etapa.b;
+                    for(int i = 0; i < tamanhoObservacao; i++) {
+                        x[i] = std::min(std::max(x[i], minimo), maximo);
+                    }
+                    break;
+                }
+                case TipoEtapa::ESCALAR: {
+                    const double fator = etapa.a;
+                    const double deslocamento = etapa.b;
+                    for(int i = 0; i < tamanhoObservacao; i++) {
+                        x[i] = x[i] * fator + deslocamento;
+                    }
+                    break;
+                }
+                }
+            }
+        }
+    }
+
+    // Guarda a observação (já processada) no histórico do indivíduo e escreve
+    // em 'destino' os quadros empilhados (getTamanhoSaida() valores)
+    void empilhar(int indice, const double* observacao, double* destino) {
+        const size_t tamanhoQuadro = tamanhoObservacao;
+        double* base = historico.data() + static_cast<size_t>(indice) * quadros * tamanhoQuadro;
+        int& proximo = proximoQuadro[indice];
+        if(proximo < 0) {
+            for(int q = 0; q < quadros; q++) {
+                std::copy(observacao, observacao + tamanhoQuadro, base + q * tamanhoQuadro);
+            }
+            proximo = 0;
+        } else {
+            std::copy(observacao, observacao + tamanhoQuadro, base + proximo * tamanhoQuadro);
+        }
+        proximo = (proximo + 1) % quadros;
+
+        // O mais antigo está em 'proximo'
+        const size_t antigos = static_cast<size_t>(quadros - proximo) * tamanhoQuadro;
+        std::copy(base + proximo * tamanhoQuadro, base + quadros * tamanhoQuadro, destino);
+        std::copy(base, base + proximo * tamanhoQuadro, destino + antigos);
+    }
+
+    // Passo completo sobre a matriz de observações (uma linha por indivíduo):
+    // atualiza as estatísticas, aplica as etapas no lugar e, com
+    // empilhamento, escreve as entradas da rede em 'destino'
+    // (quantidade x getTamanhoSaida()). Sem empilhamento o resultado fica em
+    // 'observacoes' e 'destino' pode ser nulo.
+    void processarLote(double* observacoes, int quantidade, double* destino = nullptr,
+                       const uint8_t* ativos = nullptr) {
+        if(atualizarEstatisticas && normaliza()) {
+            observar(observacoes, quantidade, ativos);
+        }
+        aplicar(observacoes, quantidade);
+        if(destino == nullptr || destino == observacoes) {
+            if(quadros > 1) {
+                throw std::runtime_error("Empilhamento de quadros precisa de um destino separado");
+            }
+            return;
+        }
+        const size_t saida = getTamanhoSaida();
+        if(quadros == 1) {
+            std::copy(observacoes, observacoes + static_cast<size_t>(quantidade) * saida, destino);
+            return;
+        }
+        if(proximoQuadro.size() < static_cast<size_t>(quantidade)) {
+            throw std::runtime_error("Estados de empilhamento não reservados para todos os indivíduos");
+        }
+        for(int r = 0; r < quantidade; r++) {
+            if(ativos && !ativos[r]) continue;
+            empilhar(r, observacoes + static_cast<size_t>(r) * tamanhoObservacao,
+                     destino + r * saida);
+        }
+    }
+
+    int getTamanhoObservacao() const { return tamanhoObservacao; }
+    int getTamanhoSaida() const { return tamanhoObservacao * quadros; }
+    int getQuadros() const { return quadros; }
+    double getContagem() const { return contagem; }
+    const std::vector<double>& getMedia() const { return media; }
+    double getVariancia(int i) const { return contagem > 1 ? m2[i] / contagem : 1.0; }
+    const std::vector<Etapa>& getEtapas() const { return etapas; }
+
+    // Cópia simples, mantida por compatibilidade; aloca a cada chamada
+    static std::vector<double> processarEntradas(const std::vector<double>& dadosEntrada) {
+        return std::vector<double>(dadosEntrada.begin(), dadosEntrada.end());
+    }
+
+    // Mesma cópia num vetor reaproveitado: só aloca se o tamanho crescer
+    static void processarEntradas(const std::vector<double>& dadosEntrada, std::vector<double>& destino) {
+        destino.assign(dadosEntrada.begin(), dadosEntrada.end());
+    }
+};
@@ -0,0 +1,89 @@
+#pragma once
+#include "RegressaoRidge.h"  // de RedeNeural/include
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+// Modelo barato de aptidão (regressão ridge treinada online) usado para
+// pré-selecionar filhos antes da avaliação completa. As características são
+// estatísticas do vetor de pesos mais os próprios pesos; redes grandes têm os
+// pesos somados em grupos para manter o sistema pequeno. A regressão é a
+// mesma do ModeloSubstituto da biblioteca NEAT.
+class ModeloSubstituto {
+public:
+    static constexpr int MAX_GRUPOS = 64;
+
+    ModeloSubstituto(double regularizacao = 1.0, double fatorEsquecimento = 0.9)
+        : regressao(0, regularizacao, fatorEsquecimento), numGrupos(0) {}
+
+    // Desconta as amostras antigas; chamado uma vez por geração
+    void envelhecer() {
+        regressao.envelhecer();
+    }
+
+    void adicionarAmostra(const std::vector<double>& genes, double fitness) {
+        prepararCaracteristicas(genes);
+        extrairCaracteristicas(genes, x.data());
+        regressao.adicionarAmostra(x.data(), fitness);
+    }
+
+    // Amostras de uma geração avaliada; vetores de pesos repetidos contam uma vez só
+    void adicionarGeracao(const std::vector<std::vector<double>>& genes, const std::vector<double>& fitness) {
+        if(genes.empty()) return;
+        prepararCaracteristicas(genes[0]);
+        const int n = regressao.obterNumCaracteristicas();
+        std::vector<double> linhas(genes.size() * n);
+        for(size_t i = 0; i < genes.size(); i++) {
+            extrairCaracteristicas(genes[i], &linhas[i * n]);
+        }
+        regressao.adicionarLote(linhas.data(), fitness.data(), genes.size());
+    }
+
+    double prever(const std::vector<double>& genes) {
+        if(regressao.obterNumCaracteristicas() == 0) return 0;
+        regressao.resolver();
+        extrairCaracteristicas(genes, x.data());
+        return regressao.prever(x.data());
+    }
+
+    // Só ranqueia com amostras suficientes para o número de características
+    bool estaPronto() const {
+        const int n = regressao.obterNumCaracteristicas();
+        return n > 0 && regressao.obterAmostras() >= 2 * n;
+    }
+
+private:
+    NEAT::RegressaoRidge regressao;
+    int numGrupos;
+    std::vector<double> x;       // rascunho das características
+
+    // O número de características sai do tamanho do primeiro genoma visto
+    void prepararCaracteristicas(const std::vector<double>& genes) {
+        if(regressao.obterNumCaracteristicas() > 0) return;
+        numGrupos = std::max<int>(1, std::min<int>(genes.size(), MAX_GRUPOS));
+        regressao.redimensionar(5 + numGrupos);
+        x.resize(5 + numGrupos);
+    }
+
+    void extrairCaracteristicas(const std::vector<double>& genes, double* destino) const {
+        std::fill(destino, destino + 5 + numGrupos, 0.0);
+
+        double soma = 0, somaQuadrados = 0, somaAbs = 0, maiorAbs = 0;
+        for(size_t i = 0; i < genes.size(); i++) {
+            double peso = genes[i];
+            soma += peso;
+            somaQuadrados += peso * peso;
+            somaAbs += std::abs(peso);
+            maiorAbs = std::max(maiorAbs, std::abs(peso));
+            destino[5 + i % numGrupos] += peso;
+        }
+
+        double total = genes.empty() ? 1.0 : genes.size();
+        double media = soma / total;
+        destino[0] = 1.0;  // intercepto
+        destino[1] = media;
+        destino[2] = std::sqrt(std::max(0.0, somaQuadrados / total - media * media));
+        destino[3] = somaAbs / total;
+        destino[4] = maiorAbs;
+    }
+};
@@ -1,76 +1,141 @@
-#pragma once
-#include <vector>
-#include <cmath>
-#include <memory>
-#include <string>
-
-class Neuronio {
-private:
-    std::vector<double> pesos;
-    double erro;
-    double saida;
-
-public:
-    Neuronio(int quantidadeLigacoes);
-    
-    double getSaida() const { return saida; }
-    void setSaida(double valor) { saida = valor; }
-    
-    double getErro() const { return erro; }
-    void setErro(double valor) { erro = valor; }
-    
-    double getPeso(int index) const { return pesos[index]; }
-    void setPeso(int index, double valor) { pesos[index] = valor; }
-    
-    int getQuantidadeLigacoes() const { return pesos.size(); }
-    std::vector<double>& getPesos() { return pesos; }
-    const std::vector<double>& getPesos() const { return pesos; }
-};
-
-class Camada {
-private:
-    std::vector<Neuronio> neuronios;
-
-public:
-    Camada(int quantidadeNeuronios, int quantidadeLigacoes);
-    
-    Neuronio& getNeuronio(int index) { return neuronios[index]; }
-    const Neuronio& getNeuronio(int index) const { return neuronios[index]; }
-    
-    int getQuantidadeNeuronios() const { return neuronios.size(); }
-};
-
-class RedeNeural {
-private:
-    static constexpr double TAXA_APRENDIZADO = 0.1;
-    static constexpr double TAXA_PESO_INICIAL = 1.0;
-    static constexpr int BIAS = 1;
-
-    Camada camadaEntrada;
-    std::vector<Camada> camadasEscondidas;
-    Camada camadaSaida;
-
-    static double relu(double x);
-    static double sigmoid(double x);
-
-public:
-    RedeNeural(int quantidadeEscondidas, 
-               int qtdNeuroniosEntrada, 
-               int qtdNeuroniosEscondida, 
-               int qtdNeuroniosSaida);
-
-    void calcularSaida();
-    void copiarParaEntrada(const std::vector<double>& vetorEntrada);
-    void copiarDaSaida(std::vector<double>& vetorSaida);
-    
-    int getQuantidadePesos() const;
-    void copiarVetorParaCamadas(const std::vector<double>& vetor);
-    void copiarCamadasParaVetor(std::vector<double>& vetor) const;
-
-    const std::vector<Camada>& getCamadasEscondidas() const { return camadasEscondidas; }
-    const Camada& getCamadaSaida() const { return camadaSaida; }
-    const Camada& getCamadaEntrada() const { return camadaEntrada; }
-
-    static RedeNeural carregarRede(const std::string& nomeArquivo);
-    void salvarRede(const std::string& nomeArquivo) const;
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <cmath>
+#include <memory>
+#include <string>
+
+// Ativação de cada neurônio; as funções em double ficam em
+// RedeNeural::aplicarAtivacao. Os valores são os gravados no arquivo e os
+// mesmos de NEAT::TipoAtivacao, então os dois formatos numeram igual.
+enum class TipoAtivacao : int32_t {
+    IDENTIDADE = 0,
+    SIGMOIDE,
+    TANH,
+    RELU,
+    DEGRAU,
+    GAUSSIANA,
+    NUM_TIPOS
+};
+
+class Neuronio {
+private:
+    std::vector<double> pesos;
+    double bias;
+    double erro;
+    double saida;
+
+public:
+    Neuronio(int quantidadeLigacoes);
+    
+    double getSaida() const { return saida; }
+    void setSaida(double valor) { saida = valor; }
+    
+    double getErro() const { return erro; }
+    void setErro(double valor) { erro = valor; }
+    
+    double getPeso(int index) const { return pesos[index]; }
+    void setPeso(int index, double valor) { pesos[index] = valor; }
+    
+    double getBias() const { return bias; }
+    void setBias(double valor) { bias = valor; }
+    
+    int getQuantidadeLigacoes() const { return pesos.size(); }
+    std::vector<double>& getPesos() { return pesos; }
+    const std::vector<double>& getPesos() const { return pesos; }
+};
+
+class Camada {
+private:
+    std::vector<Neuronio> neuronios;
+    // Ativação de cada neurônio, contígua para os laços agrupados por tipo
+    std::vector<TipoAtivacao> ativacoes;
+
+public:
+    Camada(int quantidadeNeuronios, int quantidadeLigacoes,
+           TipoAtivacao ativacao = TipoAtivacao::IDENTIDADE);
+    
+    Neuronio& getNeuronio(int index) { return neuronios[index]; }
+    const Neuronio& getNeuronio(int index) const { return neuronios[index]; }
+    
+    TipoAtivacao getAtivacao(int index) const { return ativacoes[index]; }
+    void setAtivacao(int index, TipoAtivacao tipo) { ativacoes[index] = tipo; }
+    const std::vector<TipoAtivacao>& getAtivacoes() const { return ativacoes; }
+    
+    int getQuantidadeNeuronios() const { return neuronios.size(); }
+};
+
+class RedeNeural {
+private:
+    static constexpr double TAXA_APRENDIZADO = 0.1;
+    static constexpr double TAXA_PESO_INICIAL = 1.0;
+    static constexpr int BIAS = 1;
+
+    Camada camadaEntrada;
+    std::vector<Camada> camadasEscondidas;
+    Camada camadaSaida;
+
+    // Camadas calculadas numeradas como em getTopologia(): 1..escondidas, depois a saída
+    Camada& getCamadaCalculada(int camada);
+    const Camada& getCamadaCalculada(int camada) const;
+
+public:
+    RedeNeural(int quantidadeEscondidas, 
+               int qtdNeuroniosEntrada, 
+               int qtdNeuroniosEscondida, 
+               int qtdNeuroniosSaida);
+
+    static double getTaxaAprendizado() { return TAXA_APRENDIZADO; }
+
+    // Ativações em double sem chamadas à libm (exp por Taylor com o expoente
+    // montado nos bits), então os laços sobre um bloco vetorizam. Entradas
+    // fora de ±350 (±26 na gaussiana) são saturadas antes, num laço à parte.
+    static void aplicarAtivacao(TipoAtivacao tipo, double* valores, int quantidade);
+    // 'quantidade' neurônios com as ativações 'tipos'; cada neurônio ocupa
+    // 'largura' valores seguidos (o ensemble guarda um por modelo). Trechos
+    // com o mesmo tipo viram uma chamada a aplicarAtivacao.
+    static void aplicarAtivacoes(const TipoAtivacao* tipos, int quantidade, double* valores, int largura = 1);
+    static double ativar(TipoAtivacao tipo, double x);
+    // Derivada em relação à soma, a partir da soma e do valor já ativado
+    static double derivadaAtivacao(TipoAtivacao tipo, double soma, double valor);
+
+    // Por padrão as escondidas usam tanh e a saída sigmoide. 'camada' segue
+    // getTopologia(): de 1 (primeira escondida) até a saída.
+    void setAtivacao(int camada, int neuronio, TipoAtivacao tipo);
+    void setAtivacaoCamada(int camada, TipoAtivacao tipo);
+    const std::vector<TipoAtivacao>& getAtivacoes(int camada) const;
+    // Copia as ativações de uma rede com a mesma topologia
+    void copiarAtivacoes(const RedeNeural& origem);
+
+    // Neurônios por camada, da entrada à saída
+    std::vector<int> getTopologia() const;
+
+    // soma = Σ peso * entrada, depois + bias, depois a ativação do neurônio
+    void calcularSaida();
+    // Propagação sobre um vetor de pesos plano (layout de copiarCamadasParaVetor).
+    // 'rascunho' precisa de getTamanhoRascunho() posições.
+    void calcularSaidaComPesos(const double* pesos, const double* entrada, 
+                               double* saida, double* rascunho) const;
+    int getTamanhoRascunho() const;
+    void copiarParaEntrada(const std::vector<double>& vetorEntrada);
+    void copiarDaSaida(std::vector<double>& vetorSaida);
+    // Sem alocação: 'quantidade' entradas lidas de 'entrada'; a saída precisa
+    // de espaço para todos os neurônios de saída
+    void copiarParaEntrada(const double* entrada, int quantidade);
+    void copiarDaSaida(double* saida) const;
+    
+    // Vetor plano: para cada camada calculada e cada neurônio, os pesos das
+    // ligações seguidos do bias
+    int getQuantidadePesos() const;
+    void copiarVetorParaCamadas(const std::vector<double>& vetor);
+    void copiarCamadasParaVetor(std::vector<double>& vetor) const;
+
+    const std::vector<Camada>& getCamadasEscondidas() const { return camadasEscondidas; }
+    const Camada& getCamadaSaida() const { return camadaSaida; }
+    const Camada& getCamadaEntrada() const { return camadaEntrada; }
+
+    // O arquivo guarda a versão, a topologia, as ativações e o vetor plano.
+    // carregarRede também lê o formato antigo (só topologia e pesos, sem bias).
+    static RedeNeural carregarRede(const std::string& nomeArquivo);
+    void salvarRede(const std::string& nomeArquivo) const;
 }; 
\ No newline at end of file
@@ -0,0 +1,188 @@
+#pragma once
+#include "RedeNeural.hpp"
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+
+// Versão podada de uma RedeNeural para implantação: cada camada vira uma
+// matriz CSR (uma linha por neurônio) só com os pesos |w| > limiar, e a
+// inferência é um SpMV por camada com os bias e as ativações de calcularSaida.
+// Os bias não são podados nem entram na contagem de pesos.
+class RedeNeuralEsparsa {
+public:
+    struct RelatorioPoda {
+        int pesosTotais;
+        int pesosMantidos;
+        double esparsidade;
+        double nsDensa;      // calcularSaidaComPesos sobre o vetor denso
+        double nsEsparsa;
+        double aceleracao;
+        double maiorDiferencaSaida;  // entre as duas, nas mesmas entradas
+        bool saidasPreservadas;      // maiorDiferencaSaida <= tolerância
+    };
+
+    RedeNeuralEsparsa(const RedeNeural& rede, double limiar = 0.0) {
+        tamanhos = rede.getTopologia();
+
+        std::vector<double> denso;
+        rede.copiarCamadasParaVetor(denso);
+        pesosTotais = 0;
+
+        // Linhas de todas as camadas num único CSR; cada camada guarda a primeira linha
+        size_t pos = 0;
+        inicioLinha.push_back(0);
+        for(size_t c = 1; c < tamanhos.size(); c++) {
+            primeiraLinha.push_back(inicioLinha.size() - 1);
+            const std::vector<TipoAtivacao>& tipos = rede.getAtivacoes(c);
+            ativacoes.insert(ativacoes.end(), tipos.begin(), tipos.end());
+            for(int i = 0; i < tamanhos[c]; i++) {
+                for(int j = 0; j < tamanhos[c - 1]; j++) {
+                    double peso = denso[pos++];
+                    if(!deveSerPodado(peso, limiar)) {
+                        colunas.push_back(j);
+                        pesos.push_back(peso);
+                    }
+                }
+                pesosTotais += tamanhos[c - 1];
+                bias.push_back(denso[pos++]);
+                inicioLinha.push_back(pesos.size());
+            }
+        }
+
+        int maior = 0;
+        for(size_t c = 1; c + 1 < tamanhos.size(); c++) {
+            maior = std::max(maior, tamanhos[c]);
+        }
+        rascunho.resize(2 * maior);
+    }
+
+    void calcularSaida(const double* entrada, double* saida) {
+        double* atual = rascunho.data();
+        double* proximo = rascunho.data() + rascunho.size() / 2;
+        const double* origem = entrada;
+        const size_t ultima = tamanhos.size() - 1;
+
+        for(size_t c = 1; c < tamanhos.size(); c++) {
+            double* destino = (c == ultima) ? saida : atual;
+            const int primeira = primeiraLinha[c - 1];
+            int linha = primeira;
+            for(int i = 0; i < tamanhos[c]; i++, linha++) {
+                double soma = 0;
+                for(int k = inicioLinha[linha]; k < inicioLinha[linha + 1]; k++) {
+                    soma += pesos[k] * origem[colunas[k]];
+                }
+                destino[i] = soma + bias[linha];
+            }
+            RedeNeural::aplicarAtivacoes(&ativacoes[primeira], tamanhos[c], destino);
+            origem = atual;
+            std::swap(atual, proximo);
+        }
+    }
+
+    void calcularSaida(const std::vector<double>& entrada, std::vector<double>& saida) {
+        saida.resize(tamanhos.back());
+        calcularSaida(entrada.data(), saida.data());
+    }
+
+    int getPesosTotais() const { return pesosTotais; }
+    int getPesosMantidos() const { return pesos.size(); }
+    double getEsparsidade() const {
+        return pesosTotais > 0 ? 1.0 - (double)pesos.size() / pesosTotais : 0.0;
+    }
+
+    // Critério único de poda, usado ao compilar e em podarPesos
+    static bool deveSerPodado(double peso, double limiar) { return std::abs(peso) <= limiar; }
+
+    // Zera na rede densa os pesos com |w| <= limiar; os bias ficam. A máscara
+    // devolvida (1 = mantido) serve para TreinadorRede::definirMascara no ajuste fino.
+    static std::vector<uint8_t> podarPesos(RedeNeural& rede, double limiar) {
+        std::vector<double> genes;
+        rede.copiarCamadasParaVetor(genes);
+        std::vector<uint8_t> mascara(genes.size(), 1);
+        const std::vector<int> tamanhos = rede.getTopologia();
+        size_t k = 0;
+        for(size_t c = 1; c < tamanhos.size(); c++) {
+            for(int i = 0; i < tamanhos[c]; i++, k++) {
+                for(int j = 0; j < tamanhos[c - 1]; j++, k++) {
+                    if(deveSerPodado(genes[k], limiar)) {
+                        genes[k] = 0.0;
+                        mascara[k] = 0;
+                    }
+                }
+            }
+        }
+        rede.copiarVetorParaCamadas(genes);
+        return mascara;
+    }
+
+    // Mede a aceleração em relação à inferência densa com entradas aleatórias e
+    // confere que as saídas das duas não diferem além da tolerância
+    RelatorioPoda compararCom(const RedeNeural& densa, int repeticoes = 10000, double tolerancia = 1e-9) {
+        using relogio = std::chrono::steady_clock;
+        const int numEntradas = tamanhos.front();
+        const int numSaidas = tamanhos.back();
+        std::vector<double> amostras(static_cast<size_t>(repeticoes) * numEntradas);
+        for(double& valor : amostras) {
+            valor = (std::rand() % 2000 - 1000) / 1000.0;
+        }
+
+        std::vector<double> genes;
+        densa.copiarCamadasParaVetor(genes);
+        std::vector<double> rascunhoDenso(densa.getTamanhoRascunho());
+        std::vector<double> saida(numSaidas);
+        std::vector<double> saidaEsparsa(numSaidas);
+        double maiorDiferenca = 0;
+        for(int r = 0; r < repeticoes; r++) {
+            const double* entrada = &amostras[static_cast<size_t>(r) * numEntradas];
+            densa.calcularSaidaComPesos(genes.data(), entrada, saida.data(), rascunhoDenso.data());
+            calcularSaida(entrada, saidaEsparsa.data());
+            for(int i = 0; i < numSaidas; i++) {
+                double diferenca = std::abs(saida[i] - saidaEsparsa[i]);
+                if(std::isnan(diferenca)) diferenca = std::numeric_limits<double>::infinity();
+                maiorDiferenca = std::max(maiorDiferenca, diferenca);
+            }
+        }
+
+        double acumulador = 0;  // impede que o compilador descarte as avaliações
+        auto inicio = relogio::now();
+        for(int r = 0; r < repeticoes; r++) {
+            densa.calcularSaidaComPesos(genes.data(), &amostras[static_cast<size_t>(r) * numEntradas],
+                                        saida.data(), rascunhoDenso.data());
+            acumulador += saida[0];
+        }
+        auto meio = relogio::now();
+        for(int r = 0; r < repeticoes; r++) {
+            calcularSaida(&amostras[static_cast<size_t>(r) * numEntradas], saida.data());
+            acumulador -= saida[0];
+        }
+        auto fim = relogio::now();
+        volatile double sumidouro = acumulador;
+        (void)sumidouro;
+
+        RelatorioPoda relatorio;
+        relatorio.pesosTotais = getPesosTotais();
+        relatorio.pesosMantidos = getPesosMantidos();
+        relatorio.esparsidade = getEsparsidade();
+        relatorio.nsDensa = std::chrono::duration<double, std::nano>(meio - inicio).count() / repeticoes;
+        relatorio.nsEsparsa = std::chrono::duration<double, std::nano>(fim - meio).count() / repeticoes;
+        relatorio.aceleracao = relatorio.nsEsparsa > 0 ? relatorio.nsDensa / relatorio.nsEsparsa : 0.0;
+        relatorio.maiorDiferencaSaida = maiorDiferenca;
+        relatorio.saidasPreservadas = maiorDiferenca <= tolerancia;
+        return relatorio;
+    }
+
+private:
+    std::vector<int> tamanhos;      // neurônios por camada, da entrada à saída
+    std::vector<int> primeiraLinha; // primeira linha CSR de cada camada calculada
+    std::vector<int> inicioLinha;
+    std::vector<int> colunas;
+    std::vector<double> pesos;
+    std::vector<double> bias;                // um por linha
+    std::vector<TipoAtivacao> ativacoes;     // uma por linha
+    std::vector<double> rascunho;
+    int pesosTotais;
+};
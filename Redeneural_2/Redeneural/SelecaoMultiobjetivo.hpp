@@ -0,0 +1,30 @@
+#pragma once
+#include "OrdenacaoPareto.h"  // de RedeNeural/include
+#include <vector>
+
+// Seleção multiobjetivo no estilo NSGA-II: frentes não dominadas e distância
+// de aglomeração. Todos os objetivos são maximizados (custos com sinal
+// trocado); 'objetivos' tem numObjetivos valores por indivíduo, em sequência.
+// A ordenação é a mesma da SelecaoMultiobjetivo da biblioteca NEAT.
+class SelecaoMultiobjetivo {
+public:
+    using Classificacao = NEAT::ClassificacaoPareto<double>;
+
+    static bool domina(const double* a, const double* b, int numObjetivos) {
+        return NEAT::dominaPareto(a, b, numObjetivos);
+    }
+
+    // O(N log N) com dois objetivos; com M > 2, pior caso O(M·N²)
+    static std::vector<std::vector<int>> ordenarNaoDominados(const std::vector<double>& objetivos, int numObjetivos) {
+        return NEAT::ordenarNaoDominados(objetivos, numObjetivos);
+    }
+
+    static std::vector<Classificacao> classificar(const std::vector<double>& objetivos, int numObjetivos) {
+        return NEAT::classificarPareto(objetivos, numObjetivos);
+    }
+
+    // Frente menor primeiro; na mesma frente, a menos povoada
+    static bool melhor(const Classificacao& a, const Classificacao& b) {
+        return NEAT::melhorPareto(a, b);
+    }
+};
@@ -0,0 +1,296 @@
+#pragma once
+#include "RedeNeural.hpp"
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <cmath>
+#include <stdexcept>
+#include <cstdint>
+
+// Treino supervisionado por retropropagação em minilotes. Os pesos ficam num
+// vetor plano (layout de copiarCamadasParaVetor), uma matriz linhas x
+// (colunas + 1) contígua por camada com o bias na última coluna, e as somas e
+// ativações do lote também são matrizes contíguas (uma linha por exemplo). Serve para refinar campeões da evolução com dados
+// gravados: ao final os pesos voltam para a própria rede (refinamento lamarckiano).
+class TreinadorRede {
+public:
+    enum class Otimizador { SGD, ADAM };
+
+    struct Configuracao {
+        Otimizador otimizador;
+        double taxaAprendizado;  // SGD costuma ir bem com RedeNeural::getTaxaAprendizado()
+        double momento;          // momento do SGD (0 = sem momento)
+        double beta1;            // Adam
+        double beta2;
+        int tamanhoLote;
+        unsigned semente;        // embaralhamento das épocas
+
+        Configuracao() {
+            otimizador = Otimizador::ADAM;
+            taxaAprendizado = 0.001;
+            momento = 0.0;
+            beta1 = 0.9;
+            beta2 = 0.999;
+            tamanhoLote = 32;
+            semente = 42;
+        }
+    };
+
+    TreinadorRede(RedeNeural& rede, const Configuracao& config = Configuracao())
+        : rede(rede), config(config), passos(0), gerador(config.semente) {
+        tamanhos = rede.getTopologia();
+        tiposAtivacao.resize(tamanhos.size());
+        deslocamentos.push_back(0);
+        for(size_t c = 1; c < tamanhos.size(); c++) {
+            tiposAtivacao[c] = rede.getAtivacoes(c);
+            deslocamentos.push_back(deslocamentos.back() + tamanhos[c] * (tamanhos[c - 1] + 1));
+        }
+
+        rede.copiarCamadasParaVetor(pesos);
+        gradiente.assign(pesos.size(), 0.0);
+        primeiroMomento.assign(pesos.size(), 0.0);
+        segundoMomento.assign(pesos.size(), 0.0);
+        somas.resize(tamanhos.size());
+        ativacoes.resize(tamanhos.size());
+        deltas.resize(tamanhos.size());
+    }
+
+    int getNumEntradas() const { return tamanhos.front(); }
+    int getNumSaidas() const { return tamanhos.back(); }
+
+    // Um passo de gradiente sobre 'quantidade' exemplos (linhas contíguas).
+    // Retorna o erro quadrático médio do lote antes da atualização.
+    double treinarLote(const double* entradas, const double* alvos, int quantidade) {
+        double erro;
+        propagar(entradas, quantidade);
+        retropropagar(alvos, quantidade, erro);
+        aplicarGradiente();
+        return erro;
+    }
+
+    // Uma época em minilotes embaralhados; entradas e alvos têm uma linha por exemplo
+    double treinarEpoca(const std::vector<double>& entradas, const std::vector<double>& alvos) {
+        const int numExemplos = validarDados(entradas, alvos);
+        const int nEntrada = getNumEntradas();
+        const int nSaida = getNumSaidas();
+
+        ordem.resize(numExemplos);
+        for(int i = 0; i < numExemplos; i++) ordem[i] = i;
+        std::shuffle(ordem.begin(), ordem.end(), gerador);
+
+        double somaErro = 0;
+        for(int inicio = 0; inicio < numExemplos; inicio += config.tamanhoLote) {
+            int quantidade = std::min(config.tamanhoLote, numExemplos - inicio);
+            loteEntradas.resize(static_cast<size_t>(quantidade) * nEntrada);
+            loteAlvos.resize(static_cast<size_t>(quantidade) * nSaida);
+            for(int b = 0; b < quantidade; b++) {
+                int exemplo = ordem[inicio + b];
+                std::copy_n(&entradas[static_cast<size_t>(exemplo) * nEntrada], nEntrada,
+                            &loteEntradas[static_cast<size_t>(b) * nEntrada]);
+                std::copy_n(&alvos[static_cast<size_t>(exemplo) * nSaida], nSaida,
+                            &loteAlvos[static_cast<size_t>(b) * nSaida]);
+            }
+            somaErro += treinarLote(loteEntradas.data(), loteAlvos.data(), quantidade) * quantidade;
+        }
+        return somaErro / numExemplos;
+    }
+
+    // Treina por várias épocas e grava os pesos de volta na rede
+    double treinar(const std::vector<double>& entradas, const std::vector<double>& alvos, int epocas) {
+        double erro = 0;
+        for(int e = 0; e < epocas; e++) {
+            erro = treinarEpoca(entradas, alvos);
+        }
+        atualizarRede();
+        return erro;
+    }
+
+    // Erro quadrático médio sem alterar os pesos
+    double calcularErro(const std::vector<double>& entradas, const std::vector<double>& alvos) {
+        const int numExemplos = validarDados(entradas, alvos);
+        propagar(entradas.data(), numExemplos);
+        const std::vector<double>& saidas = ativacoes.back();
+        double soma = 0;
+        for(size_t i = 0; i < saidas.size(); i++) {
+            double diferenca = saidas[i] - alvos[i];
+            soma += diferenca * diferenca;
+        }
+        return soma / saidas.size();
+    }
+
+    // Gradiente do erro de calcularErro() em relação aos pesos (layout de
+    // copiarCamadasParaVetor), sem alterar os pesos nem aplicar a máscara
+    const std::vector<double>& calcularGradiente(const std::vector<double>& entradas,
+                                                 const std::vector<double>& alvos) {
+        const int numExemplos = validarDados(entradas, alvos);
+        double erro;
+        propagar(entradas.data(), numExemplos);
+        retropropagar(alvos.data(), numExemplos, erro);
+        return gradiente;
+    }
+
+    void atualizarRede() { rede.copiarVetorParaCamadas(pesos); }
+
+    // Pesos com máscara 0 ficam presos em zero (ajuste fino depois de uma poda)
+    void definirMascara(const std::vector<uint8_t>& novaMascara) {
+        if(novaMascara.size() != pesos.size()) {
+            throw std::runtime_error("Máscara com tamanho diferente do número de pesos");
+        }
+        mascara = novaMascara;
+        for(size_t k = 0; k < pesos.size(); k++) {
+            if(!mascara[k]) pesos[k] = 0.0;
+        }
+    }
+
+private:
+    RedeNeural& rede;
+    Configuracao config;
+    std::vector<int> tamanhos;        // neurônios por camada, da entrada à saída
+    std::vector<std::vector<TipoAtivacao>> tiposAtivacao; // por camada, copiados da rede
+    std::vector<size_t> deslocamentos; // início da matriz de cada camada em 'pesos'
+    std::vector<double> pesos;
+    std::vector<double> gradiente;
+    std::vector<double> primeiroMomento;
+    std::vector<double> segundoMomento;
+    std::vector<uint8_t> mascara;     // vazia = todos os pesos treináveis
+    std::vector<std::vector<double>> somas;     // lote x neurônios, antes da ativação
+    std::vector<std::vector<double>> ativacoes; // lote x neurônios, por camada
+    std::vector<std::vector<double>> deltas;
+    std::vector<int> ordem;
+    std::vector<double> loteEntradas;
+    std::vector<double> loteAlvos;
+    int passos;
+    std::mt19937 gerador;
+
+    int validarDados(const std::vector<double>& entradas, const std::vector<double>& alvos) const {
+        int numExemplos = entradas.size() / getNumEntradas();
+        if(numExemplos == 0 || entradas.size() % getNumEntradas() != 0 ||
+           alvos.size() != static_cast<size_t>(numExemplos) * getNumSaidas()) {
+            throw std::runtime_error("Dimensões de entradas e alvos incompatíveis com a rede");
+        }
+        return numExemplos;
+    }
+
+    // Propagação do lote com as mesmas contas de calcularSaida
+    void propagar(const double* entradas, int quantidade) {
+        ativacoes[0].assign(entradas, entradas + static_cast<size_t>(quantidade) * tamanhos[0]);
+
+        for(size_t c = 1; c < tamanhos.size(); c++) {
+            const int linhas = tamanhos[c];
+            const int colunas = tamanhos[c - 1];
+            const double* w = &pesos[deslocamentos[c - 1]];
+            const std::vector<double>& anterior = ativacoes[c - 1];
+            std::vector<double>& z = somas[c];
+            std::vector<double>& atual = ativacoes[c];
+            z.resize(static_cast<size_t>(quantidade) * linhas);
+
+            for(int b = 0; b < quantidade; b++) {
+                const double* x = &anterior[static_cast<size_t>(b) * colunas];
+                double* soma = &z[static_cast<size_t>(b) * linhas];
+                for(int i = 0; i < linhas; i++) {
+                    const double* linha = w + static_cast<size_t>(i) * (colunas + 1);
+                    double s = 0;
+                    for(int j = 0; j < colunas; j++) {
+                        s += linha[j] * x[j];
+                    }
+                    soma[i] = s + linha[colunas];
+                }
+            }
+            atual = z;
+            for(int b = 0; b < quantidade; b++) {
+                RedeNeural::aplicarAtivacoes(tiposAtivacao[c].data(), linhas, &atual[static_cast<size_t>(b) * linhas]);
+            }
+        }
+    }
+
+    // Gradiente do erro quadrático médio; 'erro' recebe o valor do lote
+    void retropropagar(const double* alvos, int quantidade, double& erro) {
+        const size_t ultima = tamanhos.size() - 1;
+        const int nSaida = tamanhos[ultima];
+        const std::vector<double>& saidas = ativacoes[ultima];
+        const std::vector<double>& somasSaida = somas[ultima];
+        std::vector<double>& deltaSaida = deltas[ultima];
+        deltaSaida.resize(saidas.size());
+
+        double soma = 0;
+        const double escala = 2.0 / (static_cast<double>(quantidade) * nSaida);
+        for(size_t k = 0; k < saidas.size(); k++) {
+            double diferenca = saidas[k] - alvos[k];
+            soma += diferenca * diferenca;
+            deltaSaida[k] = escala * diferenca *
+                            RedeNeural::derivadaAtivacao(tiposAtivacao[ultima][k % nSaida], somasSaida[k], saidas[k]);
+        }
+        erro = soma / saidas.size();
+
+        std::fill(gradiente.begin(), gradiente.end(), 0.0);
+        for(size_t c = ultima; c >= 1; c--) {
+            const int linhas = tamanhos[c];
+            const int colunas = tamanhos[c - 1];
+            const double* w = &pesos[deslocamentos[c - 1]];
+            double* g = &gradiente[deslocamentos[c - 1]];
+            const std::vector<double>& delta = deltas[c];
+            const std::vector<double>& anterior = ativacoes[c - 1];
+
+            // dW = delta^T * A_anterior; o bias é uma entrada fixa em 1
+            for(int b = 0; b < quantidade; b++) {
+                const double* d = &delta[static_cast<size_t>(b) * linhas];
+                const double* x = &anterior[static_cast<size_t>(b) * colunas];
+                for(int i = 0; i < linhas; i++) {
+                    double* linha = g + static_cast<size_t>(i) * (colunas + 1);
+                    for(int j = 0; j < colunas; j++) {
+                        linha[j] += d[i] * x[j];
+                    }
+                    linha[colunas] += d[i];
+                }
+            }
+
+            if(c == 1) break;  // a entrada não tem delta
+
+            // delta_anterior = (delta * W) ⊙ f'(z_anterior)
+            std::vector<double>& deltaAnterior = deltas[c - 1];
+            deltaAnterior.assign(static_cast<size_t>(quantidade) * colunas, 0.0);
+            const TipoAtivacao* tipos = tiposAtivacao[c - 1].data();
+            for(int b = 0; b < quantidade; b++) {
+                const double* d = &delta[static_cast<size_t>(b) * linhas];
+                double* dAnt = &deltaAnterior[static_cast<size_t>(b) * colunas];
+                for(int i = 0; i < linhas; i++) {
+                    const double* linha = w + static_cast<size_t>(i) * (colunas + 1);
+                    for(int j = 0; j < colunas; j++) {
+                        dAnt[j] += d[i] * linha[j];
+                    }
+                }
+                const double* a = &anterior[static_cast<size_t>(b) * colunas];
+                const double* z = &somas[c - 1][static_cast<size_t>(b) * colunas];
+                for(int j = 0; j < colunas; j++) {
+                    dAnt[j] *= RedeNeural::derivadaAtivacao(tipos[j], z[j], a[j]);
+                }
+            }
+        }
+    }
+
+    void aplicarGradiente() {
+        passos++;
+        if(!mascara.empty()) {
+            for(size_t k = 0; k < gradiente.size(); k++) {
+                if(!mascara[k]) gradiente[k] = 0.0;
+            }
+        }
+        if(config.otimizador == Otimizador::SGD) {
+            for(size_t k = 0; k < pesos.size(); k++) {
+                primeiroMomento[k] = config.momento * primeiroMomento[k] + gradiente[k];
+                pesos[k] -= config.taxaAprendizado * primeiroMomento[k];
+            }
+            return;
+        }
+
+        const double correcao1 = 1.0 - std::pow(config.beta1, passos);
+        const double correcao2 = 1.0 - std::pow(config.beta2, passos);
+        for(size_t k = 0; k < pesos.size(); k++) {
+            primeiroMomento[k] = config.beta1 * primeiroMomento[k] + (1.0 - config.beta1) * gradiente[k];
+            segundoMomento[k] = config.beta2 * segundoMomento[k] + (1.0 - config.beta2) * gradiente[k] * gradiente[k];
+            double mChapeu = primeiroMomento[k] / correcao1;
+            double vChapeu = segundoMomento[k] / correcao2;
+            pesos[k] -= config.taxaAprendizado * mChapeu / (std::sqrt(vChapeu) + 1e-8);
+        }
+    }
+};
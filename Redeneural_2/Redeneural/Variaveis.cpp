@@ -1,9 +1,9 @@
-#include "Variaveis.hpp"
-
-namespace Variaveis {
-    int GeracaoCompleta = 0;
-    std::vector<double> BestFitnessPopulacao;
-    std::vector<double> MediaFitnessPopulacao;
-    std::vector<double> MediaFitnessFilhos;
-    RedeNeural* MelhorRede = nullptr;
+#include "Variaveis.hpp"
+
+namespace Variaveis {
+    int GeracaoCompleta = 0;
+    JanelaHistorico<double, JANELA_HISTORICO> BestFitnessPopulacao;
+    JanelaHistorico<double, JANELA_HISTORICO> MediaFitnessPopulacao;
+    JanelaHistorico<double, JANELA_HISTORICO> MediaFitnessFilhos;
+    RedeNeural* MelhorRede = nullptr;
 } 
\ No newline at end of file
@@ -1,24 +1,65 @@
-#pragma once
-#include <vector>
-#include "RedeNeural.hpp"
-
-namespace Variaveis {
-    // Constantes para a rede neural
-    constexpr int POPULACAO_MAX = 1000;
-    constexpr int POPULACAO_TAMANHO = 100;
-    
-    // Parâmetros da rede neural
-    constexpr int BIRD_BRAIN_QTD_LAYERS = 1;    // Quantidade de camadas escondidas
-    constexpr int BIRD_BRAIN_QTD_INPUT = 5;     // Quantidade de neurônios na entrada
-    constexpr int BIRD_BRAIN_QTD_HIDE = 4;      // Quantidade de neurônios na camada escondida
-    constexpr int BIRD_BRAIN_QTD_OUTPUT = 2;    // Quantidade de neurônios na saída
-
-    // Variáveis para controle de gerações
-    extern int GeracaoCompleta;
-    extern std::vector<double> BestFitnessPopulacao;
-    extern std::vector<double> MediaFitnessPopulacao;
-    extern std::vector<double> MediaFitnessFilhos;
-    
-    // Variável para armazenar a melhor rede
-    extern RedeNeural* MelhorRede;
-}
+#pragma once
+#include <cassert>
+#include <vector>
+#include <cstddef>
+#include "RedeNeural.hpp"
+
+// Histórico circular de tamanho fixo: guarda só os últimos 'capacidade'
+// valores, então a memória não cresce em execuções longas.
+// indice 0 = mais antigo ainda guardado.
+template<typename T, size_t capacidade>
+class JanelaHistorico {
+private:
+    std::vector<T> valores;
+    size_t inicio = 0;
+    size_t total = 0;   // quantos valores já foram adicionados
+
+public:
+    void push_back(const T& valor){
+        if(valores.size() < capacidade){
+            valores.push_back(valor);
+        }else{
+            valores[inicio] = valor;
+            inicio = (inicio + 1) % capacidade;
+        }
+        total++;
+    }
+
+    size_t size() const { return valores.size(); }
+    bool empty() const { return valores.empty(); }
+    size_t totalAdicionados() const { return total; }
+    // Exigem a janela não vazia (como em std::vector)
+    const T& operator[](size_t indice) const {
+        assert(indice < valores.size());
+        return valores[(inicio + indice) % valores.size()];
+    }
+    const T& back() const {
+        assert(!valores.empty());
+        return (*this)[valores.size() - 1];
+    }
+    void clear(){ valores.clear(); inicio = 0; total = 0; }
+};
+
+namespace Variaveis {
+    // Constantes para a rede neural
+    constexpr int POPULACAO_MAX = 1000;
+    constexpr int POPULACAO_TAMANHO = 100;
+    
+    // Parâmetros da rede neural
+    constexpr int BIRD_BRAIN_QTD_LAYERS = 1;    // Quantidade de camadas escondidas
+    constexpr int BIRD_BRAIN_QTD_INPUT = 5;     // Quantidade de neurônios na entrada
+    constexpr int BIRD_BRAIN_QTD_HIDE = 4;      // Quantidade de neurônios na camada escondida
+    constexpr int BIRD_BRAIN_QTD_OUTPUT = 2;    // Quantidade de neurônios na saída
+
+    // Gerações mantidas nos históricos de fitness
+    constexpr size_t JANELA_HISTORICO = 1000;
+
+    // Variáveis para controle de gerações
+    extern int GeracaoCompleta;
+    extern JanelaHistorico<double, JANELA_HISTORICO> BestFitnessPopulacao;
+    extern JanelaHistorico<double, JANELA_HISTORICO> MediaFitnessPopulacao;
+    extern JanelaHistorico<double, JANELA_HISTORICO> MediaFitnessFilhos;
+    
+    // Variável para armazenar a melhor rede
+    extern RedeNeural* MelhorRede;
+}
@@ -1,201 +1,405 @@
-#include "RedeNeural.hpp"
-#include <cmath>
-#include <fstream>
-
-RedeNeural::RedeNeural(int quantidadeEscondidas, 
-                       int qtdNeuroniosEntrada, 
-                       int qtdNeuroniosEscondida, 
-                       int qtdNeuroniosSaida)
-    : camadaEntrada(qtdNeuroniosEntrada, 0),
-      camadaSaida(qtdNeuroniosSaida, qtdNeuroniosEscondida)
-{
-    // Inicializa camadas escondidas
-    for(int i = 0; i < quantidadeEscondidas; i++) {
-        int entradasCamada = (i == 0) ? qtdNeuroniosEntrada : qtdNeuroniosEscondida;
-        camadasEscondidas.emplace_back(qtdNeuroniosEscondida, entradasCamada);
-    }
-}
-
-void RedeNeural::calcularSaida() {
-    // Propaga valores da entrada para primeira camada escondida
-    for(int i = 0; i < camadasEscondidas[0].getQuantidadeNeuronios(); i++) {
-        double soma = 0;
-        for(int j = 0; j < camadaEntrada.getQuantidadeNeuronios(); j++) {
-            soma += camadaEntrada.getNeuronio(j).getSaida() * 
-                    camadasEscondidas[0].getNeuronio(i).getPeso(j);
-        }
-        camadasEscondidas[0].getNeuronio(i).setSaida(tanh(soma));
-    }
-    
-    // Propaga entre camadas escondidas
-    for(size_t c = 1; c < camadasEscondidas.size(); c++) {
-        for(int i = 0; i < camadasEscondidas[c].getQuantidadeNeuronios(); i++) {
-            double soma = 0;
-            for(int j = 0; j < camadasEscondidas[c-1].getQuantidadeNeuronios(); j++) {
-                soma += camadasEscondidas[c-1].getNeuronio(j).getSaida() * 
-                        camadasEscondidas[c].getNeuronio(i).getPeso(j);
-            }
-            camadasEscondidas[c].getNeuronio(i).setSaida(tanh(soma));
-        }
-    }
-    
-    // Propaga para camada de saída
-    for(int i = 0; i < camadaSaida.getQuantidadeNeuronios(); i++) {
-        double soma = 0;
-        for(int j = 0; j < camadasEscondidas.back().getQuantidadeNeuronios(); j++) {
-            soma += camadasEscondidas.back().getNeuronio(j).getSaida() * 
-                    camadaSaida.getNeuronio(i).getPeso(j);
-        }
-        camadaSaida.getNeuronio(i).setSaida(sigmoid(soma));
-    }
-}
-
-void RedeNeural::copiarParaEntrada(const std::vector<double>& vetorEntrada) {
-    for(size_t i = 0; i < vetorEntrada.size() && i < (size_t)camadaEntrada.getQuantidadeNeuronios(); i++) {
-        camadaEntrada.getNeuronio(i).setSaida(vetorEntrada[i]);
-    }
-}
-
-void RedeNeural::copiarDaSaida(std::vector<double>& vetorSaida) {
-    vetorSaida.clear();
-    for(int i = 0; i < camadaSaida.getQuantidadeNeuronios(); i++) {
-        vetorSaida.push_back(camadaSaida.getNeuronio(i).getSaida());
-    }
-}
-
-double RedeNeural::sigmoid(double x) {
-    return 1.0 / (1.0 + std::exp(-x));
-}
-
-double RedeNeural::relu(double x) {
-    return x > 0 ? x : x * 0.01; // Leaky ReLU (não usado mais)
-}
-
-int RedeNeural::getQuantidadePesos() const {
-    int total = 0;
-    
-    // Pesos da primeira camada escondida
-    total += camadasEscondidas[0].getQuantidadeNeuronios() * 
-             camadaEntrada.getQuantidadeNeuronios();
-    
-    // Pesos entre camadas escondidas
-    for(size_t i = 1; i < camadasEscondidas.size(); i++) {
-        total += camadasEscondidas[i].getQuantidadeNeuronios() * 
-                 camadasEscondidas[i-1].getQuantidadeNeuronios();
-    }
-    
-    // Pesos da camada de saída
-    total += camadaSaida.getQuantidadeNeuronios() * 
-             camadasEscondidas.back().getQuantidadeNeuronios();
-    
-    return total;
-}
-
-void RedeNeural::copiarVetorParaCamadas(const std::vector<double>& vetor) {
-    size_t pos = 0;
-    
-    // Copia para primeira camada escondida
-    for(int i = 0; i < camadasEscondidas[0].getQuantidadeNeuronios(); i++) {
-        for(int j = 0; j < camadaEntrada.getQuantidadeNeuronios(); j++) {
-            if(pos < vetor.size()) {
-                camadasEscondidas[0].getNeuronio(i).setPeso(j, vetor[pos++]);
-            }
-        }
-    }
-    
-    // Copia entre camadas escondidas
-    for(size_t c = 1; c < camadasEscondidas.size(); c++) {
-        for(int i = 0; i < camadasEscondidas[c].getQuantidadeNeuronios(); i++) {
-            for(int j = 0; j < camadasEscondidas[c-1].getQuantidadeNeuronios(); j++) {
-                if(pos < vetor.size()) {
-                    camadasEscondidas[c].getNeuronio(i).setPeso(j, vetor[pos++]);
-                }
-            }
-        }
-    }
-    
-    // Copia para camada de saída
-    for(int i = 0; i < camadaSaida.getQuantidadeNeuronios(); i++) {
-        for(int j = 0; j < camadasEscondidas.back().getQuantidadeNeuronios(); j++) {
-            if(pos < vetor.size()) {
-                camadaSaida.getNeuronio(i).setPeso(j, vetor[pos++]);
-            }
-        }
-    }
-}
-
-void RedeNeural::copiarCamadasParaVetor(std::vector<double>& vetor) const {
-    vetor.clear();
-    
-    // Copia da primeira camada escondida
-    for(int i = 0; i < camadasEscondidas[0].getQuantidadeNeuronios(); i++) {
-        for(int j = 0; j < camadaEntrada.getQuantidadeNeuronios(); j++) {
-            vetor.push_back(camadasEscondidas[0].getNeuronio(i).getPeso(j));
-        }
-    }
-    
-    // Copia entre camadas escondidas
-    for(size_t c = 1; c < camadasEscondidas.size(); c++) {
-        for(int i = 0; i < camadasEscondidas[c].getQuantidadeNeuronios(); i++) {
-            for(int j = 0; j < camadasEscondidas[c-1].getQuantidadeNeuronios(); j++) {
-                vetor.push_back(camadasEscondidas[c].getNeuronio(i).getPeso(j));
-            }
-        }
-    }
-    
-    // Copia da camada de saída
-    for(int i = 0; i < camadaSaida.getQuantidadeNeuronios(); i++) {
-        for(int j = 0; j < camadasEscondidas.back().getQuantidadeNeuronios(); j++) {
-            vetor.push_back(camadaSaida.getNeuronio(i).getPeso(j));
-        }
-    }
-}
-
-RedeNeural RedeNeural::carregarRede(const std::string& nomeArquivo) {
-    std::ifstream arquivo(nomeArquivo, std::ios::binary);
-    if(!arquivo) {
-        throw std::runtime_error("Erro ao abrir arquivo para leitura");
-    }
-    
-    int quantidadeEscondidas, qtdNeuroniosEntrada, qtdNeuroniosEscondida, qtdNeuroniosSaida;
-    arquivo.read(reinterpret_cast<char*>(&quantidadeEscondidas), sizeof(int));
-    arquivo.read(reinterpret_cast<char*>(&qtdNeuroniosEntrada), sizeof(int));
-    arquivo.read(reinterpret_cast<char*>(&qtdNeuroniosEscondida), sizeof(int));
-    arquivo.read(reinterpret_cast<char*>(&qtdNeuroniosSaida), sizeof(int));
-    
-    RedeNeural rede(quantidadeEscondidas, qtdNeuroniosEntrada, 
-                    qtdNeuroniosEscondida, qtdNeuroniosSaida);
-    
-    std::vector<double> pesos;
-    double peso;
-    while(arquivo.read(reinterpret_cast<char*>(&peso), sizeof(double))) {
-        pesos.push_back(peso);
-    }
-    
-    rede.copiarVetorParaCamadas(pesos);
-    return rede;
-}
-
-void RedeNeural::salvarRede(const std::string& nomeArquivo) const {
-    std::ofstream arquivo(nomeArquivo, std::ios::binary);
-    if(!arquivo) {
-        throw std::runtime_error("Erro ao abrir arquivo para escrita");
-    }
-    
-    int quantidadeEscondidas = camadasEscondidas.size();
-    int qtdNeuroniosEntrada = camadaEntrada.getQuantidadeNeuronios();
-    int qtdNeuroniosEscondida = camadasEscondidas[0].getQuantidadeNeuronios();
-    int qtdNeuroniosSaida = camadaSaida.getQuantidadeNeuronios();
-    
-    arquivo.write(reinterpret_cast<const char*>(&quantidadeEscondidas), sizeof(int));
-    arquivo.write(reinterpret_cast<const char*>(&qtdNeuroniosEntrada), sizeof(int));
-    arquivo.write(reinterpret_cast<const char*>(&qtdNeuroniosEscondida), sizeof(int));
-    arquivo.write(reinterpret_cast<const char*>(&qtdNeuroniosSaida), sizeof(int));
-    
-    std::vector<double> pesos;
-    copiarCamadasParaVetor(pesos);
-    
-    for(double peso : pesos) {
-        arquivo.write(reinterpret_cast<const char*>(&peso), sizeof(double));
-    }
-}
+#include "RedeNeural.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+
+// exp(x) = 2^i * e^g, com i = round(x / ln 2) montado direto no expoente e
+// e^g (|g| <= ln(2) / 2) por Taylor de grau 12: erro relativo ~1e-16, sem
+// desvios nem chamadas à libm, então os laços de ativação vetorizam.
+// Requer |x| <= 700; quem chama satura a entrada antes.
+inline double expVetorial(double x) {
+    double t = x * 1.4426950408889634;
+    double m = t + 6755399441055744.0;  // 1.5 * 2^52: arredonda para inteiro
+    int64_t inteiro;
+    std::memcpy(&inteiro, &m, sizeof(inteiro));
+    inteiro -= 0x4338000000000000LL;
+    double g = (t - (m - 6755399441055744.0)) * 0.6931471805599453;
+
+    double p = 1.0 / 479001600.0;
+    p = p * g + 1.0 / 39916800.0;
+    p = p * g + 1.0 / 3628800.0;
+    p = p * g + 1.0 / 362880.0;
+    p = p * g + 1.0 / 40320.0;
+    p = p * g + 1.0 / 5040.0;
+    p = p * g + 1.0 / 720.0;
+    p = p * g + 1.0 / 120.0;
+    p = p * g + 1.0 / 24.0;
+    p = p * g + 1.0 / 6.0;
+    p = p * g + 0.5;
+    p = p * g + 1.0;
+    p = p * g + 1.0;
+    int64_t bits;
+    std::memcpy(&bits, &p, sizeof(bits));
+    bits += inteiro * (int64_t(1) << 52);
+    double resultado;
+    std::memcpy(&resultado, &bits, sizeof(resultado));
+    return resultado;
+}
+
+// Fora desses limites as funções já estão saturadas em double
+void saturar(double* valores, int quantidade, double limite) {
+    for(int i = 0; i < quantidade; i++) {
+        valores[i] = std::min(limite, std::max(-limite, valores[i]));
+    }
+}
+
+// Arquivos novos começam por -VERSAO_ARQUIVO; nos antigos o primeiro inteiro
+// é a quantidade de camadas escondidas, sempre positiva
+const int VERSAO_ARQUIVO = 2;
+
+} // namespace
+
+RedeNeural::RedeNeural(int quantidadeEscondidas,
+                       int qtdNeuroniosEntrada,
+                       int qtdNeuroniosEscondida,
+                       int qtdNeuroniosSaida)
+    : camadaEntrada(qtdNeuroniosEntrada, 0),
+      camadaSaida(qtdNeuroniosSaida, qtdNeuroniosEscondida, TipoAtivacao::SIGMOIDE)
+{
+    // Inicializa camadas escondidas
+    for(int i = 0; i < quantidadeEscondidas; i++) {
+        int entradasCamada = (i == 0) ? qtdNeuroniosEntrada : qtdNeuroniosEscondida;
+        camadasEscondidas.emplace_back(qtdNeuroniosEscondida, entradasCamada, TipoAtivacao::TANH);
+    }
+}
+
+void RedeNeural::aplicarAtivacao(TipoAtivacao tipo, double* valores, int quantidade) {
+    switch(tipo) {
+    case TipoAtivacao::SIGMOIDE:
+        saturar(valores, quantidade, 350.0);
+        for(int i = 0; i < quantidade; i++) {
+            valores[i] = 1.0 / (1.0 + expVetorial(-valores[i]));
+        }
+        break;
+    case TipoAtivacao::TANH:
+        saturar(valores, quantidade, 350.0);
+        for(int i = 0; i < quantidade; i++) {
+            valores[i] = 1.0 - 2.0 / (expVetorial(2.0 * valores[i]) + 1.0);
+        }
+        break;
+    case TipoAtivacao::RELU:
+        for(int i = 0; i < quantidade; i++) {
+            valores[i] = std::max(0.0, valores[i]);
+        }
+        break;
+    case TipoAtivacao::DEGRAU:
+        for(int i = 0; i < quantidade; i++) {
+            valores[i] = valores[i] > 0.0 ? 1.0 : 0.0;
+        }
+        break;
+    case TipoAtivacao::GAUSSIANA:
+        saturar(valores, quantidade, 26.0);
+        for(int i = 0; i < quantidade; i++) {
+            valores[i] = expVetorial(-valores[i] * valores[i]);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void RedeNeural::aplicarAtivacoes(const TipoAtivacao* tipos, int quantidade, double* valores, int largura) {
+    for(int inicio = 0; inicio < quantidade;) {
+        int fim = inicio + 1;
+        while(fim < quantidade && tipos[fim] == tipos[inicio]) fim++;
+        aplicarAtivacao(tipos[inicio], valores + static_cast<size_t>(inicio) * largura, (fim - inicio) * largura);
+        inicio = fim;
+    }
+}
+
+double RedeNeural::ativar(TipoAtivacao tipo, double x) {
+    aplicarAtivacao(tipo, &x, 1);
+    return x;
+}
+
+double RedeNeural::derivadaAtivacao(TipoAtivacao tipo, double soma, double valor) {
+    switch(tipo) {
+    case TipoAtivacao::SIGMOIDE:  return valor * (1.0 - valor);
+    case TipoAtivacao::TANH:      return 1.0 - valor * valor;
+    case TipoAtivacao::RELU:      return soma > 0.0 ? 1.0 : 0.0;
+    case TipoAtivacao::DEGRAU:    return 0.0;
+    case TipoAtivacao::GAUSSIANA: return -2.0 * soma * valor;
+    default:                      return 1.0;
+    }
+}
+
+Camada& RedeNeural::getCamadaCalculada(int camada) {
+    return camada <= static_cast<int>(camadasEscondidas.size()) ? camadasEscondidas[camada - 1] : camadaSaida;
+}
+
+const Camada& RedeNeural::getCamadaCalculada(int camada) const {
+    return camada <= static_cast<int>(camadasEscondidas.size()) ? camadasEscondidas[camada - 1] : camadaSaida;
+}
+
+void RedeNeural::setAtivacao(int camada, int neuronio, TipoAtivacao tipo) {
+    getCamadaCalculada(camada).setAtivacao(neuronio, tipo);
+}
+
+void RedeNeural::setAtivacaoCamada(int camada, TipoAtivacao tipo) {
+    Camada& alvo = getCamadaCalculada(camada);
+    for(int i = 0; i < alvo.getQuantidadeNeuronios(); i++) {
+        alvo.setAtivacao(i, tipo);
+    }
+}
+
+const std::vector<TipoAtivacao>& RedeNeural::getAtivacoes(int camada) const {
+    return getCamadaCalculada(camada).getAtivacoes();
+}
+
+void RedeNeural::copiarAtivacoes(const RedeNeural& origem) {
+    if(origem.getTopologia() != getTopologia()) {
+        throw std::runtime_error("Ativações copiadas de uma rede com outra topologia");
+    }
+    for(int c = 1; c <= static_cast<int>(camadasEscondidas.size()) + 1; c++) {
+        const std::vector<TipoAtivacao>& tipos = origem.getAtivacoes(c);
+        for(size_t i = 0; i < tipos.size(); i++) {
+            setAtivacao(c, i, tipos[i]);
+        }
+    }
+}
+
+std::vector<int> RedeNeural::getTopologia() const {
+    std::vector<int> tamanhos;
+    tamanhos.push_back(camadaEntrada.getQuantidadeNeuronios());
+    for(const auto& camada : camadasEscondidas) {
+        tamanhos.push_back(camada.getQuantidadeNeuronios());
+    }
+    tamanhos.push_back(camadaSaida.getQuantidadeNeuronios());
+    return tamanhos;
+}
+
+void RedeNeural::calcularSaida() {
+    const Camada* anterior = &camadaEntrada;
+    for(int c = 1; c <= static_cast<int>(camadasEscondidas.size()) + 1; c++) {
+        Camada& camada = getCamadaCalculada(c);
+        for(int i = 0; i < camada.getQuantidadeNeuronios(); i++) {
+            Neuronio& neuronio = camada.getNeuronio(i);
+            double soma = 0;
+            for(int j = 0; j < anterior->getQuantidadeNeuronios(); j++) {
+                soma += anterior->getNeuronio(j).getSaida() * neuronio.getPeso(j);
+            }
+            soma += neuronio.getBias();
+            neuronio.setSaida(ativar(camada.getAtivacao(i), soma));
+        }
+        anterior = &camada;
+    }
+}
+
+void RedeNeural::calcularSaidaComPesos(const double* pesos, const double* entrada,
+                                       double* saida, double* rascunho) const {
+    double* atual = rascunho;
+    double* proximo = rascunho + getTamanhoRascunho() / 2;
+    const double* origem = entrada;
+    int tamanhoOrigem = camadaEntrada.getQuantidadeNeuronios();
+    const int numCamadas = camadasEscondidas.size() + 1;
+
+    // Linhas contíguas de pesos, uma por neurônio, cada uma terminada pelo bias
+    for(int c = 1; c <= numCamadas; c++) {
+        const Camada& camada = getCamadaCalculada(c);
+        const int n = camada.getQuantidadeNeuronios();
+        double* destino = (c == numCamadas) ? saida : atual;
+        for(int i = 0; i < n; i++) {
+            double soma = 0;
+            for(int j = 0; j < tamanhoOrigem; j++) {
+                soma += pesos[j] * origem[j];
+            }
+            soma += pesos[tamanhoOrigem];
+            pesos += tamanhoOrigem + 1;
+            destino[i] = soma;
+        }
+        aplicarAtivacoes(camada.getAtivacoes().data(), n, destino);
+        origem = atual;
+        tamanhoOrigem = n;
+        std::swap(atual, proximo);
+    }
+}
+
+int RedeNeural::getTamanhoRascunho() const {
+    int maior = 0;
+    for(const auto& camada : camadasEscondidas) {
+        maior = std::max(maior, camada.getQuantidadeNeuronios());
+    }
+    return 2 * maior;
+}
+
+void RedeNeural::copiarParaEntrada(const std::vector<double>& vetorEntrada) {
+    copiarParaEntrada(vetorEntrada.data(), static_cast<int>(vetorEntrada.size()));
+}
+
+void RedeNeural::copiarDaSaida(std::vector<double>& vetorSaida) {
+    // resize só aloca quando o vetor ainda não tem o tamanho da saída
+    vetorSaida.resize(camadaSaida.getQuantidadeNeuronios());
+    copiarDaSaida(vetorSaida.data());
+}
+
+void RedeNeural::copiarParaEntrada(const double* entrada, int quantidade) {
+    int n = std::min(quantidade, camadaEntrada.getQuantidadeNeuronios());
+    for(int i = 0; i < n; i++) {
+        camadaEntrada.getNeuronio(i).setSaida(entrada[i]);
+    }
+}
+
+void RedeNeural::copiarDaSaida(double* saida) const {
+    for(int i = 0; i < camadaSaida.getQuantidadeNeuronios(); i++) {
+        saida[i] = camadaSaida.getNeuronio(i).getSaida();
+    }
+}
+
+int RedeNeural::getQuantidadePesos() const {
+    const std::vector<int> tamanhos = getTopologia();
+    int total = 0;
+    for(size_t c = 1; c < tamanhos.size(); c++) {
+        total += tamanhos[c] * (tamanhos[c - 1] + 1);
+    }
+    return total;
+}
+
+void RedeNeural::copiarVetorParaCamadas(const std::vector<double>& vetor) {
+    size_t pos = 0;
+    for(int c = 1; c <= static_cast<int>(camadasEscondidas.size()) + 1; c++) {
+        Camada& camada = getCamadaCalculada(c);
+        for(int i = 0; i < camada.getQuantidadeNeuronios(); i++) {
+            Neuronio& neuronio = camada.getNeuronio(i);
+            for(int j = 0; j < neuronio.getQuantidadeLigacoes(); j++) {
+                if(pos < vetor.size()) {
+                    neuronio.setPeso(j, vetor[pos++]);
+                }
+            }
+            if(pos < vetor.size()) {
+                neuronio.setBias(vetor[pos++]);
+            }
+        }
+    }
+}
+
+void RedeNeural::copiarCamadasParaVetor(std::vector<double>& vetor) const {
+    vetor.clear();
+    for(int c = 1; c <= static_cast<int>(camadasEscondidas.size()) + 1; c++) {
+        const Camada& camada = getCamadaCalculada(c);
+        for(int i = 0; i < camada.getQuantidadeNeuronios(); i++) {
+            const Neuronio& neuronio = camada.getNeuronio(i);
+            vetor.insert(vetor.end(), neuronio.getPesos().begin(), neuronio.getPesos().end());
+            vetor.push_back(neuronio.getBias());
+        }
+    }
+}
+
+RedeNeural RedeNeural::carregarRede(const std::string& nomeArquivo) {
+    std::ifstream arquivo(nomeArquivo, std::ios::binary);
+    if(!arquivo) {
+        throw std::runtime_error("Erro ao abrir arquivo para leitura");
+    }
+
+    int versao = 1;
+    int quantidadeEscondidas, qtdNeuroniosEntrada, qtdNeuroniosEscondida, qtdNeuroniosSaida;
+    arquivo.read(reinterpret_cast<char*>(&quantidadeEscondidas), sizeof(int));
+    if(quantidadeEscondidas < 0) {
+        versao = -quantidadeEscondidas;
+        arquivo.read(reinterpret_cast<char*>(&quantidadeEscondidas), sizeof(int));
+    }
+    arquivo.read(reinterpret_cast<char*>(&qtdNeuroniosEntrada), sizeof(int));
+    arquivo.read(reinterpret_cast<char*>(&qtdNeuroniosEscondida), sizeof(int));
+    arquivo.read(reinterpret_cast<char*>(&qtdNeuroniosSaida), sizeof(int));
+    if(!arquivo || versao > VERSAO_ARQUIVO) {
+        throw std::runtime_error("Arquivo de rede inválido ou de versão desconhecida");
+    }
+
+    // A topologia vem do arquivo: antes de alocar a rede, confere que os
+    // pesos das ligações cabem no que resta dele
+    const std::streampos posicao = arquivo.tellg();
+    arquivo.seekg(0, std::ios::end);
+    const uint64_t restante = static_cast<uint64_t>(arquivo.tellg() - posicao);
+    arquivo.seekg(posicao);
+    if(quantidadeEscondidas < 1 || qtdNeuroniosEntrada < 1 ||
+       qtdNeuroniosEscondida < 1 || qtdNeuroniosSaida < 1) {
+        throw std::runtime_error("Arquivo de rede com topologia inválida");
+    }
+    const uint64_t ligacoes =
+        static_cast<uint64_t>(qtdNeuroniosEscondida) * qtdNeuroniosEntrada +
+        static_cast<uint64_t>(qtdNeuroniosEscondida) * qtdNeuroniosEscondida * (quantidadeEscondidas - 1) +
+        static_cast<uint64_t>(qtdNeuroniosSaida) * qtdNeuroniosEscondida;
+    if(ligacoes > restante / sizeof(double)) {
+        throw std::runtime_error("Arquivo de rede incompleto");
+    }
+
+    RedeNeural rede(quantidadeEscondidas, qtdNeuroniosEntrada,
+                    qtdNeuroniosEscondida, qtdNeuroniosSaida);
+
+    if(versao == 1) {
+        // Formato antigo: pesos sem bias até o fim do arquivo; ativações padrão
+        std::vector<double> pesosAntigos;
+        double peso;
+        while(arquivo.read(reinterpret_cast<char*>(&peso), sizeof(double))) {
+            pesosAntigos.push_back(peso);
+        }
+        std::vector<double> pesos;
+        std::vector<int> tamanhos = rede.getTopologia();
+        size_t pos = 0;
+        for(size_t c = 1; c < tamanhos.size(); c++) {
+            for(int i = 0; i < tamanhos[c]; i++) {
+                for(int j = 0; j < tamanhos[c - 1] && pos < pesosAntigos.size(); j++) {
+                    pesos.push_back(pesosAntigos[pos++]);
+                }
+                pesos.push_back(0.0);
+            }
+        }
+        rede.copiarVetorParaCamadas(pesos);
+        return rede;
+    }
+
+    for(int c = 1; c <= quantidadeEscondidas + 1; c++) {
+        for(size_t i = 0; i < rede.getAtivacoes(c).size(); i++) {
+            int32_t tipo;
+            arquivo.read(reinterpret_cast<char*>(&tipo), sizeof(tipo));
+            if(!arquivo || tipo < 0 || tipo >= static_cast<int32_t>(TipoAtivacao::NUM_TIPOS)) {
+                throw std::runtime_error("Arquivo de rede com ativação inválida");
+            }
+            rede.setAtivacao(c, i, static_cast<TipoAtivacao>(tipo));
+        }
+    }
+    std::vector<double> pesos(rede.getQuantidadePesos());
+    arquivo.read(reinterpret_cast<char*>(pesos.data()), pesos.size() * sizeof(double));
+    if(!arquivo) {
+        throw std::runtime_error("Arquivo de rede incompleto");
+    }
+    rede.copiarVetorParaCamadas(pesos);
+    return rede;
+}
+
+void RedeNeural::salvarRede(const std::string& nomeArquivo) const {
+    std::ofstream arquivo(nomeArquivo, std::ios::binary);
+    if(!arquivo) {
+        throw std::runtime_error("Erro ao abrir arquivo para escrita");
+    }
+
+    int marcaVersao = -VERSAO_ARQUIVO;
+    int quantidadeEscondidas = camadasEscondidas.size();
+    int qtdNeuroniosEntrada = camadaEntrada.getQuantidadeNeuronios();
+    int qtdNeuroniosEscondida = camadasEscondidas[0].getQuantidadeNeuronios();
+    int qtdNeuroniosSaida = camadaSaida.getQuantidadeNeuronios();
+
+    arquivo.write(reinterpret_cast<const char*>(&marcaVersao), sizeof(int));
+    arquivo.write(reinterpret_cast<const char*>(&quantidadeEscondidas), sizeof(int));
+    arquivo.write(reinterpret_cast<const char*>(&qtdNeuroniosEntrada), sizeof(int));
+    arquivo.write(reinterpret_cast<const char*>(&qtdNeuroniosEscondida), sizeof(int));
+    arquivo.write(reinterpret_cast<const char*>(&qtdNeuroniosSaida), sizeof(int));
+
+    for(int c = 1; c <= quantidadeEscondidas + 1; c++) {
+        for(TipoAtivacao tipo : getAtivacoes(c)) {
+            int32_t valor = static_cast<int32_t>(tipo);
+            arquivo.write(reinterpret_cast<const char*>(&valor), sizeof(valor));
+        }
+    }
+
+    std::vector<double> pesos;
+    copiarCamadasParaVetor(pesos);
+
+    for(double peso : pesos) {
+        arquivo.write(reinterpret_cast<const char*>(&peso), sizeof(double));
+    }
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include <cstdio>
+
+// Verificações mínimas dos testes: cada falha é impressa e o teste termina
+// com código diferente de zero (veja resultado())
+inline int& falhasVerificacao() {
+    static int falhas = 0;
+    return falhas;
+}
+
+#define VERIFICAR(condicao) \
+    do { \
+        if(!(condicao)) { \
+            std::fprintf(stderr, "%s:%d: falhou: %s\n", __FILE__, __LINE__, #condicao); \
+            falhasVerificacao()++; \
+        } \
+    } while(0)
+
+inline int resultado(const char* nome) {
+    if(falhasVerificacao() == 0) {
+        std::printf("%s: ok\n", nome);
+        return 0;
+    }
+    std::printf("%s: %d falha(s)\n", nome, falhasVerificacao());
+    return 1;
+}
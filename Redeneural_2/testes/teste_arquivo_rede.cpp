@@ -0,0 +1,106 @@
+#include "../Redeneural/RedeNeural.hpp"
+#include "Verificacao.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+static std::string arquivoTemporario(const char* nome) {
+    return std::string("/tmp/rede_teste_") + nome + "_" + std::to_string(::getpid()) + ".bin";
+}
+
+static std::vector<double> avaliar(RedeNeural& rede, const std::vector<double>& entradas) {
+    std::vector<double> saidas;
+    rede.copiarParaEntrada(entradas);
+    rede.calcularSaida();
+    rede.copiarDaSaida(saidas);
+    return saidas;
+}
+
+// Pesos, bias e ativações voltam iguais
+static void testarIdaEVolta() {
+    RedeNeural rede(2, 3, 4, 2);
+    rede.setAtivacao(1, 0, TipoAtivacao::GAUSSIANA);
+    rede.setAtivacaoCamada(2, TipoAtivacao::RELU);
+    rede.setAtivacao(3, 1, TipoAtivacao::IDENTIDADE);
+    std::vector<double> pesos;
+    rede.copiarCamadasParaVetor(pesos);
+    for(size_t k = 0; k < pesos.size(); k++) pesos[k] += 0.01 * k;
+    rede.copiarVetorParaCamadas(pesos);
+
+    const std::string arquivo = arquivoTemporario("ida_volta");
+    rede.salvarRede(arquivo);
+    RedeNeural carregada = RedeNeural::carregarRede(arquivo);
+    std::remove(arquivo.c_str());
+
+    std::vector<double> pesosCarregados;
+    carregada.copiarCamadasParaVetor(pesosCarregados);
+    VERIFICAR(pesosCarregados == pesos);
+    for(int c = 1; c <= 3; c++) {
+        VERIFICAR(carregada.getAtivacoes(c) == rede.getAtivacoes(c));
+    }
+    const std::vector<double> entradas = {0.3, -0.6, 0.9};
+    VERIFICAR(avaliar(carregada, entradas) == avaliar(rede, entradas));
+}
+
+// Arquivo antigo: topologia e pesos sem bias, ativações tanh e sigmoide
+static void testarFormatoAntigo() {
+    const int topologia[] = {1, 2, 2, 1};  // escondidas, entrada, neurônios, saída
+    const std::vector<double> pesosAntigos = {0.5, -0.25, 1.0, 2.0, 0.75, -1.5};
+    const std::string arquivo = arquivoTemporario("antigo");
+    {
+        std::ofstream out(arquivo, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(topologia), sizeof(topologia));
+        out.write(reinterpret_cast<const char*>(pesosAntigos.data()), pesosAntigos.size() * sizeof(double));
+    }
+    RedeNeural rede = RedeNeural::carregarRede(arquivo);
+    std::remove(arquivo.c_str());
+
+    std::vector<double> pesos;
+    rede.copiarCamadasParaVetor(pesos);
+    const std::vector<double> esperado = {0.5, -0.25, 0.0, 1.0, 2.0, 0.0, 0.75, -1.5, 0.0};
+    VERIFICAR(pesos == esperado);
+    VERIFICAR(rede.getAtivacoes(1) == std::vector<TipoAtivacao>(2, TipoAtivacao::TANH));
+    VERIFICAR(rede.getAtivacoes(2) == std::vector<TipoAtivacao>(1, TipoAtivacao::SIGMOIDE));
+}
+
+static bool recusa(const std::string& arquivo) {
+    try {
+        RedeNeural::carregarRede(arquivo);
+    } catch(const std::runtime_error&) {
+        return true;
+    }
+    return false;
+}
+
+// Ativação fora do enum e topologia maior que o arquivo são recusadas
+static void testarArquivoCorrompido() {
+    const std::string arquivo = arquivoTemporario("corrompido");
+    RedeNeural rede(1, 2, 2, 1);
+    rede.salvarRede(arquivo);
+    {
+        // A primeira ativação fica depois do cabeçalho de cinco inteiros
+        std::fstream io(arquivo, std::ios::binary | std::ios::in | std::ios::out);
+        io.seekp(5 * sizeof(int));
+        int32_t tipo = 99;
+        io.write(reinterpret_cast<const char*>(&tipo), sizeof(tipo));
+    }
+    VERIFICAR(recusa(arquivo));
+    {
+        std::ofstream out(arquivo, std::ios::binary);
+        const int cabecalho[] = {-2, 1000, 100000, 100000, 100000};
+        out.write(reinterpret_cast<const char*>(cabecalho), sizeof(cabecalho));
+    }
+    VERIFICAR(recusa(arquivo));
+    std::remove(arquivo.c_str());
+}
+
+int main() {
+    testarIdaEVolta();
+    testarFormatoAntigo();
+    testarArquivoCorrompido();
+    return resultado("teste_arquivo_rede");
+}
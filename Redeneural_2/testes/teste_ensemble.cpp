@@ -0,0 +1,66 @@
+#include "../Redeneural/EnsembleRedeNeural.hpp"
+#include "Verificacao.hpp"
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Redes com bias e ativações variadas (as mesmas em todos os modelos)
+static std::vector<RedeNeural> montarRedes(int quantidade) {
+    std::mt19937 gerador(5);
+    std::uniform_real_distribution<double> distribuicao(-1.0, 1.0);
+    std::vector<RedeNeural> redes;
+    for(int k = 0; k < quantidade; k++) {
+        RedeNeural rede(2, 3, 6, 2);
+        rede.setAtivacao(1, 1, TipoAtivacao::RELU);
+        rede.setAtivacao(1, 4, TipoAtivacao::GAUSSIANA);
+        rede.setAtivacaoCamada(2, TipoAtivacao::SIGMOIDE);
+        rede.setAtivacao(3, 0, TipoAtivacao::IDENTIDADE);
+        std::vector<double> pesos;
+        rede.copiarCamadasParaVetor(pesos);
+        for(double& peso : pesos) peso = distribuicao(gerador);
+        rede.copiarVetorParaCamadas(pesos);
+        redes.push_back(rede);
+    }
+    return redes;
+}
+
+// Cada modelo do ensemble calcula o mesmo que a sua rede sozinha, com K
+// especializado (1, 2, 4, 8) e genérico (3)
+static void testarModelos() {
+    for(int quantidade : {1, 2, 3, 4, 8}) {
+        std::vector<RedeNeural> redes = montarRedes(quantidade);
+        EnsembleRedeNeural ensemble(redes);
+        const std::vector<double> entrada = {0.4, -0.8, 0.2};
+        ensemble.calcularSaida(entrada);
+
+        double maiorDiferenca = 0;
+        for(int k = 0; k < quantidade; k++) {
+            std::vector<double> saida;
+            redes[k].copiarParaEntrada(entrada);
+            redes[k].calcularSaida();
+            redes[k].copiarDaSaida(saida);
+            for(int i = 0; i < 2; i++) {
+                maiorDiferenca = std::max(maiorDiferenca, std::abs(saida[i] - ensemble.getSaidaModelo(k, i)));
+            }
+        }
+        VERIFICAR(maiorDiferenca < 1e-12);
+    }
+}
+
+static void testarAtivacoesDiferentes() {
+    std::vector<RedeNeural> redes = montarRedes(2);
+    redes[1].setAtivacao(2, 3, TipoAtivacao::DEGRAU);
+    bool rejeitado = false;
+    try {
+        EnsembleRedeNeural ensemble(redes);
+    } catch(const std::runtime_error&) {
+        rejeitado = true;
+    }
+    VERIFICAR(rejeitado);
+}
+
+int main() {
+    testarModelos();
+    testarAtivacoesDiferentes();
+    return resultado("teste_ensemble");
+}
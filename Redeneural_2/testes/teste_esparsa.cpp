@@ -0,0 +1,46 @@
+#include "../Redeneural/RedeNeuralEsparsa.hpp"
+#include "Verificacao.hpp"
+#include <cmath>
+
+// Sem poda, a versão CSR reproduz a rede densa
+static void testarSemPoda() {
+    RedeNeural rede(2, 4, 6, 3);
+    rede.setAtivacaoCamada(2, TipoAtivacao::RELU);
+    rede.setAtivacao(3, 0, TipoAtivacao::IDENTIDADE);
+    RedeNeuralEsparsa esparsa(rede, 0.0);
+    RedeNeuralEsparsa::RelatorioPoda relatorio = esparsa.compararCom(rede, 200);
+    VERIFICAR(relatorio.saidasPreservadas);
+    VERIFICAR(relatorio.maiorDiferencaSaida == 0.0);
+}
+
+// Os pesos que a compilação descarta são exatamente os que podarPesos zera,
+// então a rede podada e a versão CSR calculam a mesma coisa. Os bias (última
+// posição de cada linha de 3 + 1 ou 8 + 1 valores) nunca são podados.
+static void testarLimiarConsistente() {
+    RedeNeural rede(1, 3, 8, 2);
+    rede.setAtivacao(1, 2, TipoAtivacao::RELU);
+    rede.setAtivacao(1, 5, TipoAtivacao::GAUSSIANA);
+    std::vector<double> pesos;
+    rede.copiarCamadasParaVetor(pesos);
+    for(size_t k = 3; k < 8 * 4; k += 4) pesos[k] = 0.01 * k;  // bias pequenos
+    rede.copiarVetorParaCamadas(pesos);
+    const double limiar = std::abs(pesos[2]);  // um peso fica exatamente no limiar
+
+    RedeNeuralEsparsa esparsa(rede, limiar);
+    std::vector<uint8_t> mascara = RedeNeuralEsparsa::podarPesos(rede, limiar);
+    VERIFICAR(mascara[2] == 0);
+
+    int mantidos = 0;
+    for(uint8_t m : mascara) mantidos += m;
+    const int numBias = 8 + 2;
+    VERIFICAR(mantidos == esparsa.getPesosMantidos() + numBias);
+    VERIFICAR(esparsa.getPesosTotais() + numBias == rede.getQuantidadePesos());
+    for(size_t k = 3; k < 8 * 4; k += 4) VERIFICAR(mascara[k] == 1);
+    VERIFICAR(esparsa.compararCom(rede, 200).saidasPreservadas);
+}
+
+int main() {
+    testarSemPoda();
+    testarLimiarConsistente();
+    return resultado("teste_esparsa");
+}
@@ -0,0 +1,127 @@
+#include "../Redeneural/ExportadorRedeNeural.hpp"
+#include "Verificacao.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+#include <dlfcn.h>
+#include <unistd.h>
+
+// O cabeçalho gerado faz as mesmas contas de calcularSaida, na mesma ordem e
+// com a mesma exponencial; a tolerância só cobre o compilador contrair
+// multiplicação e soma em FMA
+const double TOLERANCIA = 1e-12;
+
+using FuncaoExportada = void (*)(const double* entradas, double* saidas);
+
+// Compila o cabeçalho gerado, incluído por uma função extern "C" para o
+// dlsym, num diretório temporário; nullptr se a compilação falhar
+static FuncaoExportada compilar(const std::string& cabecalho) {
+    char modelo[] = "/tmp/rede_teste_XXXXXX";
+    if(!mkdtemp(modelo)) return nullptr;
+    const std::string diretorio = modelo;
+    std::ofstream(diretorio + "/exportado.h") << cabecalho;
+    std::ofstream(diretorio + "/principal.cpp")
+        << "#include \"exportado.h\"\n"
+        << "extern \"C\" void avaliar_exportado(const double* e, double* s) { exportado::avaliar(e, s); }\n";
+
+    const std::string biblioteca = diretorio + "/exportado.so";
+    const std::string comando = "c++ -std=c++17 -O2 -shared -fPIC -o '" + biblioteca + "' '" +
+                                diretorio + "/principal.cpp'";
+    const bool compilou = std::system(comando.c_str()) == 0;
+    void* handle = compilou ? dlopen(biblioteca.c_str(), RTLD_NOW | RTLD_LOCAL) : nullptr;
+
+    // A biblioteca já carregada continua válida depois de apagada
+    std::system(("rm -rf '" + diretorio + "'").c_str());
+    return handle ? reinterpret_cast<FuncaoExportada>(dlsym(handle, "avaliar_exportado")) : nullptr;
+}
+
+// Maior diferença entre o código gerado e calcularSaida em entradas aleatórias
+static double compararComRede(RedeNeural& rede, FuncaoExportada funcao) {
+    const int numEntradas = rede.getCamadaEntrada().getQuantidadeNeuronios();
+    const int numSaidas = rede.getCamadaSaida().getQuantidadeNeuronios();
+    std::mt19937 gerador(99);
+    std::uniform_real_distribution<double> distribuicao(-2.0, 2.0);
+    std::vector<double> entradas(numEntradas), esperado(numSaidas), obtido(numSaidas);
+    double maiorDiferenca = 0;
+    for(int amostra = 0; amostra < 500; amostra++) {
+        for(double& x : entradas) x = distribuicao(gerador);
+        rede.copiarParaEntrada(entradas.data(), numEntradas);
+        rede.calcularSaida();
+        rede.copiarDaSaida(esperado.data());
+        funcao(entradas.data(), obtido.data());
+        for(int i = 0; i < numSaidas; i++) {
+            double diferenca = std::abs(esperado[i] - obtido[i]);
+            if(std::isnan(esperado[i]) != std::isnan(obtido[i])) diferenca = INFINITY;
+            if(!std::isnan(diferenca)) maiorDiferenca = std::max(maiorDiferenca, diferenca);
+        }
+    }
+    return maiorDiferenca;
+}
+
+// Rede com bias e todas as ativações, em trechos de tamanhos variados
+static RedeNeural montarRede(int escondidas, int entradas, int neuronios, int saidas, unsigned semente) {
+    RedeNeural rede(escondidas, entradas, neuronios, saidas);
+    std::mt19937 gerador(semente);
+    std::uniform_real_distribution<double> distribuicao(-1.5, 1.5);
+    const int numTipos = static_cast<int>(TipoAtivacao::NUM_TIPOS);
+    for(int c = 1; c <= escondidas + 1; c++) {
+        for(size_t i = 0; i < rede.getAtivacoes(c).size(); i++) {
+            rede.setAtivacao(c, i, static_cast<TipoAtivacao>((i / 2 + c) % numTipos));
+        }
+    }
+    std::vector<double> pesos;
+    rede.copiarCamadasParaVetor(pesos);
+    for(double& peso : pesos) peso = distribuicao(gerador);
+    rede.copiarVetorParaCamadas(pesos);
+    return rede;
+}
+
+static void testarCodigoGerado() {
+    RedeNeural rede = montarRede(3, 5, 8, 3, 1);
+    FuncaoExportada funcao = compilar(ExportadorRedeNeural::gerar(rede, "exportado"));
+    VERIFICAR(funcao != nullptr);
+    if(funcao) {
+        double diferenca = compararComRede(rede, funcao);
+        std::printf("exportador: maior diferença %.2e\n", diferenca);
+        VERIFICAR(diferenca <= TOLERANCIA);
+    }
+}
+
+// Pesos NaN e infinitos viram literais válidos e dão as mesmas saídas
+static void testarValoresNaoFinitos() {
+    RedeNeural rede = montarRede(1, 3, 4, 2, 2);
+    std::vector<double> pesos;
+    rede.copiarCamadasParaVetor(pesos);
+    pesos[0] = NAN;
+    pesos[5] = INFINITY;
+    pesos[9] = -INFINITY;
+    pesos[3] = NAN;  // bias
+    rede.copiarVetorParaCamadas(pesos);
+
+    FuncaoExportada funcao = compilar(ExportadorRedeNeural::gerar(rede, "exportado"));
+    VERIFICAR(funcao != nullptr);
+    if(funcao) VERIFICAR(compararComRede(rede, funcao) <= TOLERANCIA);
+}
+
+static void testarNomeInvalido() {
+    RedeNeural rede(1, 2, 2, 1);
+    for(const char* nome : {"", "1rede", "minha-rede", "a b", "rede;"}) {
+        bool rejeitado = false;
+        try {
+            ExportadorRedeNeural::gerar(rede, nome);
+        } catch(const std::runtime_error&) {
+            rejeitado = true;
+        }
+        VERIFICAR(rejeitado);
+    }
+}
+
+int main() {
+    testarCodigoGerado();
+    testarValoresNaoFinitos();
+    testarNomeInvalido();
+    return resultado("teste_exportador");
+}
@@ -0,0 +1,100 @@
+#include "../Redeneural/TreinadorRede.hpp"
+#include "Verificacao.hpp"
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Compara o gradiente da retropropagação com diferenças centrais de
+// calcularErro() para todos os pesos e bias de uma rede com duas camadas
+// escondidas e ativações diferentes em cada neurônio (o degrau fica de fora:
+// a derivada é zero e a diferença finita explode no salto)
+static void testarGradiente() {
+    RedeNeural rede(2, 3, 5, 2);
+    const TipoAtivacao tipos[] = {TipoAtivacao::IDENTIDADE, TipoAtivacao::SIGMOIDE, TipoAtivacao::TANH,
+                                  TipoAtivacao::RELU, TipoAtivacao::GAUSSIANA};
+    for(int i = 0; i < 5; i++) {
+        rede.setAtivacao(1, i, tipos[i]);
+        rede.setAtivacao(2, i, tipos[(i + 2) % 5]);
+    }
+    rede.setAtivacao(3, 1, TipoAtivacao::TANH);
+    std::mt19937 gerador(7);
+    std::uniform_real_distribution<double> distribuicao(-1.0, 1.0);
+    std::vector<double> pesos(rede.getQuantidadePesos());
+    for(double& peso : pesos) peso = distribuicao(gerador);
+    rede.copiarVetorParaCamadas(pesos);
+
+    const int numExemplos = 6;
+    std::vector<double> entradas(numExemplos * 3), alvos(numExemplos * 2);
+    for(double& x : entradas) x = distribuicao(gerador);
+    for(double& y : alvos) y = 0.5 + 0.5 * distribuicao(gerador);
+
+    TreinadorRede treinador(rede);
+    const std::vector<double> gradiente = treinador.calcularGradiente(entradas, alvos);
+    VERIFICAR(gradiente.size() == pesos.size());
+
+    const double h = 1e-6;
+    double maiorErroRelativo = 0;
+    for(size_t k = 0; k < pesos.size(); k++) {
+        std::vector<double> perturbados = pesos;
+        perturbados[k] = pesos[k] + h;
+        RedeNeural mais = rede;
+        mais.copiarVetorParaCamadas(perturbados);
+        perturbados[k] = pesos[k] - h;
+        RedeNeural menos = rede;
+        menos.copiarVetorParaCamadas(perturbados);
+
+        double numerico = (TreinadorRede(mais).calcularErro(entradas, alvos) -
+                           TreinadorRede(menos).calcularErro(entradas, alvos)) / (2 * h);
+        double erroRelativo = std::abs(numerico - gradiente[k]) /
+                              std::max(1e-4, std::abs(numerico) + std::abs(gradiente[k]));
+        maiorErroRelativo = std::max(maiorErroRelativo, erroRelativo);
+    }
+    std::printf("gradiente: maior erro relativo %.2e em %zu pesos e bias\n", maiorErroRelativo, pesos.size());
+    VERIFICAR(maiorErroRelativo < 1e-5);
+}
+
+// Um passo de SGD sem momento move cada peso exatamente -taxa * gradiente
+static void testarPassoSGD() {
+    RedeNeural rede(1, 2, 4, 1);
+    std::vector<double> entradas = {0.1, 0.7, 0.4, 0.2, 0.9, 0.3};
+    std::vector<double> alvos = {0.9, 0.1, 0.4};
+
+    TreinadorRede::Configuracao config;
+    config.otimizador = TreinadorRede::Otimizador::SGD;
+    config.taxaAprendizado = 0.5;
+    config.tamanhoLote = 3;
+
+    std::vector<double> antes, depois;
+    rede.copiarCamadasParaVetor(antes);
+    TreinadorRede treinador(rede, config);
+    const std::vector<double> gradiente = treinador.calcularGradiente(entradas, alvos);
+    treinador.treinarLote(entradas.data(), alvos.data(), 3);
+    treinador.atualizarRede();
+    rede.copiarCamadasParaVetor(depois);
+
+    for(size_t k = 0; k < antes.size(); k++) {
+        VERIFICAR(std::abs(depois[k] - (antes[k] - 0.5 * gradiente[k])) < 1e-12);
+    }
+}
+
+// Alguns passos de Adam reduzem o erro num problema pequeno
+static void testarConvergencia() {
+    RedeNeural rede(1, 2, 6, 1);
+    std::vector<double> entradas = {0, 0, 0, 1, 1, 0, 1, 1};
+    std::vector<double> alvos = {0.1, 0.9, 0.9, 0.1};
+
+    TreinadorRede::Configuracao config;
+    config.taxaAprendizado = 0.05;
+    config.tamanhoLote = 4;
+    TreinadorRede treinador(rede, config);
+    double inicial = treinador.calcularErro(entradas, alvos);
+    treinador.treinar(entradas, alvos, 500);
+    VERIFICAR(treinador.calcularErro(entradas, alvos) < inicial * 0.5);
+}
+
+int main() {
+    testarGradiente();
+    testarPassoSGD();
+    testarConvergencia();
+    return resultado("teste_treinador");
+}